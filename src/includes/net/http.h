@@ -6,6 +6,9 @@
 #ifndef	__HTTP_H__
 #define	__HTTP_H__
 
+#include <stdbool.h>
+#include <time.h>
+
 /*
 ================================================================================
 
@@ -78,6 +81,7 @@
 #define	DEF_HTTPH_STATUS_UNSUPPORTED_MTYPE	(415)
 #define	DEF_HTTPH_STATUS_REQ_RANGE_NOT_SAT	(416)
 #define	DEF_HTTPH_STATUS_EXPECTATION_FAILED	(417)
+#define	DEF_HTTPH_STATUS_TOO_MANY_REQUESTS	(429)
 #define	DEF_HTTPH_STATUS_INTERNAL_SERV_ERR	(500)
 #define	DEF_HTTPH_STATUS_NOT_IMPLEMENTED	(501)
 #define	DEF_HTTPH_STATUS_BAD_GATEWAY		(502)
@@ -94,6 +98,7 @@
 #define	DEF_HTTPH_ACCEPT_ASTA				"Accept: */*"
 #define	DEF_HTTPH_ACCEPT_CHARSET			"Accept-Charset:"
 #define	DEF_HTTPH_ACCEPT_ENCODING			"Accept-Encoding:"
+#define	DEF_HTTPH_ACCEPT_ENCODING_GZIP		"Accept-Encoding: gzip"
 #define	DEF_HTTPH_ACCEPT_LANGUAGE			"Accept-Language:"
 #define	DEF_HTTPH_RES_ACCEPT_RANGES			"Accept-Ranges:"
 #define	DEF_HTTPH_AGE						"Age:"
@@ -104,7 +109,10 @@
 #define	DEF_HTTPH_CONNECTION				"Connection:"
 #define	DEF_HTTPH_CONNECTION_CLOSE			"Connection: close"
 #define	DEF_HTTPH_CONNECTION_ALIVE			"Connection: Keep-Alive"
+#define	DEF_HTTPH_CLOSE						"close"
 #define	DEF_HTTPH_CONTENT_ENCODING			"Content-Encoding:"
+#define	DEF_HTTPH_GZIP						"gzip"
+#define	DEF_HTTPH_CHUNKED					"chunked"
 #define	DEF_HTTPH_CONTENT_LANGUAGE			"Content-Language:"
 #define	DEF_HTTPH_CONTENT_LENGTH			"Content-Length:"
 #define	DEF_HTTPH_CONTENT_MD5				"Content-MD5:"
@@ -141,6 +149,9 @@
 #define	DEF_HTTPH_VARY						"Vary:"
 #define	DEF_HTTPH_VIA						"Via:"
 #define	DEF_HTTPH_WARNING					"Warning:"
+#define	DEF_HTTPH_RATE_LIMIT				"x-rate-limit-limit:"
+#define	DEF_HTTPH_RATE_REMAINING			"x-rate-limit-remaining:"
+#define	DEF_HTTPH_RATE_RESET				"x-rate-limit-reset:"
 
 #define	DEF_HTTPH_DELIMITOR					"\r\n"
 
@@ -161,7 +172,12 @@
 struct http_ctx
 {
 	int		status_code;
-	int		content_length;
+	int		content_length;		// length of inflated body after recvHttpHeader
+	bool	gzip;				// true:body is compressed by gzip
+	bool	chunked;			// true:body is sent in chunks
+	int		rate_limit;			// -1:not received
+	int		rate_remaining;		// -1:not received
+	time_t	rate_reset;			// epoch time when rate limit is reset
 };
 
 /*
@@ -196,7 +212,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < first body data block may be stored >
 	Return		:int
 				 < status >
-	Description	:receive headers of http and interpret them
+	Description	:receive headers of http and interpret them. body sent in
+				 chunks or compressed by gzip is received as a whole, and
+				 recvSSLMessage reads it as a plain body of content_length
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx );
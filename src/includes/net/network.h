@@ -6,6 +6,8 @@
 #ifndef	__NETWORK_H__
 #define	__NETWORK_H__
 
+#include <stdbool.h>
+
 /*
 ================================================================================
 
@@ -50,6 +52,8 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Return		:int
 				 < socket file descriptor >
 	Description	:connect a server
+				 < resolved addresses are cached for DEF_NET_DNS_TTL and
+				   ipv6/ipv4 addresses are raced as rfc 8305 >
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int connectServer( const char* hostname, char *port_num );
@@ -98,6 +102,8 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Return		:int
 				 < reconnected socket file descriptor >
 	Description	:reconnect a server
+				 < the server of last connectServer, starting from the
+				   address which won the last race >
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int reconnectServer( int sock_old );
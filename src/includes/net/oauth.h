@@ -15,6 +15,7 @@
 
 ================================================================================
 */
+struct ssl_session;
 
 
 /*
@@ -8,6 +8,8 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
 
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -251,10 +253,43 @@ struct ssl_session
 {
 	int			socket;
 	bool		connect;
+	bool		keep_alive;		// false:server will close after response
+	time_t		last_used;		// last time of sending or receiving
 	SSL			*ssl_handle;
-	SSL_CTX		*ssl_context;
+	SSL_CTX		*ssl_context;	// shared context of all sessions
+	SSL_SESSION	*resume;		// cached session for resumption
+	unsigned char
+				*cork_buf;		// not NULL:messages are stored to send at once
+	int			cork_len;
+	int			cork_size;
+	unsigned char
+				*pend_buf;		// not NULL:decoded data to be read before socket
+	int			pend_len;
+	int			pend_pos;
+	int			status_code;	// status of the last response, 0:no response
+	pthread_mutex_t
+				lock;			// one request and its response at a time
 };
 
+/*
+--------------------------------------------------------------------------------
+	Handshake Statistics
+--------------------------------------------------------------------------------
+*/
+struct ssl_handshake_stat
+{
+	unsigned long	full;		// number of full handshakes
+	unsigned long	resumed;	// number of abbreviated handshakes
+};
+
+/*
+--------------------------------------------------------------------------------
+	Connection Policy
+--------------------------------------------------------------------------------
+*/
+/* a connection idle longer than this is reopened before sending (seconds)	*/
+#define	DEF_SSL_IDLE_TIMEOUT			30
+
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -348,6 +383,8 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Return		:int
 				 < 0:connected -1:disconnected >
 	Description	:test whether connected to server or not
+				 < a connection which server will close or which has been
+				   idle over DEF_SSL_IDLE_TIMEOUT is treated as disconnected >
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int isSSLConnected( struct ssl_session *session );
@@ -361,6 +398,7 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Return		:int
 				 < status >
 	Description	:reopen a ssl session
+				 < resume the cached session if server accepts it >
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int reopenSSLSession( struct ssl_session *session );
@@ -390,6 +428,101 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 struct ssl_session* getCurrentSSLSession( void );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:lockSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:take a session to send requests and receive responses over it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void lockSSLSession( struct ssl_session *session );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:unlockSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:give back a session taken by lockSSLSession
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void unlockSSLSession( struct ssl_session *session );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getSSLHandshakeStat
+	Input		:struct ssl_handshake_stat *stat
+				 < statistics to be stored >
+	Output		:struct ssl_handshake_stat *stat
+				 < numbers of full and resumed handshakes >
+	Return		:void
+	Description	:get statistics of handshakes
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void getSSLHandshakeStat( struct ssl_handshake_stat *stat );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:corkSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:int
+				 < 1:corked now 0:already corked -1:error >
+	Description	:store messages of sendSSLMessage instead of sending them
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int corkSSLSession( struct ssl_session *session );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:uncorkSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 bool flush
+				 < true:send stored messages false:discard them >
+	Output		:void
+	Return		:int
+				 < size of send message >
+	Description	:send stored messages at once and stop storing
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int uncorkSSLSession( struct ssl_session *session, bool flush );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setSSLPendingMessage
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 unsigned char *message
+				 < message allocated by malloc. session frees it >
+				 int length
+				 < length of the message >
+	Output		:void
+	Return		:void
+	Description	:let recvSSLMessage read a message before the socket
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setSSLPendingMessage( struct ssl_session *session,
+						   unsigned char *message,
+						   int length );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:clearSSLPendingMessage
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:discard a message which is not read by recvSSLMessage yet
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void clearSSLPendingMessage( struct ssl_session *session );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:destroySSLResources
@@ -494,6 +494,7 @@
 #define	DEF_REST_LISTS_SUBS_DSTRY_SLUG		DEF_REST_LISTS_STS_SLUG
 // POST lists/members/create_all
 #define	DEF_REST_LISTS_MEMS_CREATE_ALL		"create_all.json"
+#define	DEF_REST_LISTS_MEMS_ALL_MAX_USERS	100
 // GET lists/members/show
 #define	DEF_REST_LISTS_MEMS_SHOW			"show.json"
 // GET lists/members
@@ -1629,6 +1630,68 @@ int postTwapiListsDestroyMembers( struct ssl_session *session,
 								  const char *owner_screen_name,
 								  const char *owner_id );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:postTwapiListsCreateAllMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *list_id
+				 < id of lists >
+				 const char *slug
+				 < slug of list >
+				 const char *user_ids
+				 < ids of users to add, separated by comma >
+				 const char *screen_names
+				 < screen names of users to add, separated by comma >
+				 const char *owner_screen_name
+				 < screen name of owner >
+				 const char *owner_id
+				 < id of owner >
+	Output		:void
+	Return		:int
+				 < result >
+	Description	:post lists/members/create_all
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int postTwapiListsCreateAllMembers( struct ssl_session *session,
+									const char *list_id,
+									const char *slug,
+									const char *user_ids,
+									const char *screen_names,
+									const char *owner_screen_name,
+									const char *owner_id );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:postTwapiListsDestroyAllMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *list_id
+				 < id of lists >
+				 const char *slug
+				 < slug of list >
+				 const char *user_ids
+				 < ids of users to remove, separated by comma >
+				 const char *screen_names
+				 < screen names of users to remove, separated by comma >
+				 const char *owner_screen_name
+				 < screen name of owner >
+				 const char *owner_id
+				 < id of owner >
+	Output		:void
+	Return		:int
+				 < result >
+	Description	:post lists/members/destroy_all
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int postTwapiListsDestroyAllMembers( struct ssl_session *session,
+									 const char *list_id,
+									 const char *slug,
+									 const char *user_ids,
+									 const char *screen_names,
+									 const char *owner_screen_name,
+									 const char *owner_id );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:postTwapiListsCreateSubscribers
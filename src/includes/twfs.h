@@ -8,6 +8,7 @@
 
 #include <limits.h>
 
+#include "twfs_flush.h"
 //#include "twfs_internal.h"
 //#include "net/twitter_api.h"
 
@@ -179,6 +180,21 @@
 #define	DEF_TWFS_PATH_PROFILE			"profile"
 #define	DEF_TWFS_PATH_SETTINGS			"settings"
 
+/* ---------------------------------------------------------------------------- */
+/* extended attribute of timeline file to set number of tweets to get at once	*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_XATTR_PAGE_COUNT		"user.twfs.page_count"
+
+/* ---------------------------------------------------------------------------- */
+/* extended attribute of list file to show its generation						*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_XATTR_LIST_GEN			"user.twfs.generation"
+
+/* ---------------------------------------------------------------------------- */
+/* extended attribute of timeline file to keep time older tweets are got last	*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_XATTR_BACKFILL			"user.twfs.backfill"
+
 
 /*
 ---------------------------------------------------------------------------------
@@ -193,6 +209,9 @@ struct twfs_file
 	size_t	size;			// atcual file size of timeline file
 	size_t	tl_size;		// timline file size over twfs
 	int		fd;				// timeline file descritpor
+	struct twfs_map	*map;	// mapping shared by handles of the file
+	size_t	history;		// tl size saved before oldest record at open
+	size_t	inserted;		// size of records saved before oldest record
 };
 
 /* ---------------------------------------------------------------------------- */
@@ -710,11 +729,43 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:start twfs
+	Description	:start twfs with low-level api, or with high-level api when
+				 --high-level is given
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int startTwfs( int argc, char *argv[ ] );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsWorkers
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < number of threads serving requests, -1:not a number >
+	Description	:get number of threads given by --threads=
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsWorkers( int argc, char *argv[ ] );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsDurability
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < E_TWFS_DURABILITY of files written by fetches,
+				   -1:unknown name >
+	Description	:get durability given by --durability=
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsDurability( int argc, char *argv[ ] );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:getRootAbsPath
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ File:twfs_flush.h
+ Description:Definitions of flusher of files written by fetches
+
+*******************************************************************************/
+#ifndef	__TWFS_FLUSH_H__
+#define	__TWFS_FLUSH_H__
+
+#include <sys/types.h>
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+/* ---------------------------------------------------------------------------- */
+/* durability of files written by fetches. anything lost by a crash is got		*/
+/* from twitter again, so fetches never wait for disk							*/
+/* ---------------------------------------------------------------------------- */
+typedef enum
+{
+	E_TWFS_DURABILITY_NONE,			// left to writeback of kernel
+	E_TWFS_DURABILITY_PERIODIC,		// flushed every DEF_TWFS_FLUSH_INTERVAL
+	E_TWFS_DURABILITY_GROUP,		// flushed together shortly after fetches
+	E_TWFS_DURABILITY_NUM,
+} E_TWFS_DURABILITY;
+
+#define	DEF_TWFS_DURABILITY				E_TWFS_DURABILITY_GROUP
+
+#define	DEF_TWFS_FLUSH_INTERVAL			30		// sec, periodic
+#define	DEF_TWFS_FLUSH_WINDOW			200		// msec, group commit
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsDurabilityByName
+	Input		:const char *name
+				 < none, periodic or group >
+	Output		:void
+	Return		:int
+				 < E_TWFS_DURABILITY, -1:unknown name >
+	Description	:get durability by its name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsDurabilityByName( const char *name );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsFlusher
+	Input		:E_TWFS_DURABILITY durability
+				 < durability of files >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:start to flush files in background by the durability
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsFlusher( E_TWFS_DURABILITY durability );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsFlusher
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:flush files queued so far and stop flusher
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsFlusher( void );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:queueTwfsFlush
+	Input		:int fd
+				 < file written by a fetch >
+				 off_t offset
+				 < offset of written range >
+				 size_t len
+				 < length of written range >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:queue a written range of a file to flusher. ranges of a file
+				 queued before it is flushed are merged when they overlap
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int queueTwfsFlush( int fd, off_t offset, size_t len );
+
+#endif	//__TWFS_FLUSH_H__
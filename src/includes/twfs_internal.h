@@ -6,6 +6,7 @@
 #ifndef	__TWFS_INTERNAL_H__
 #define	__TWFS_INTERNAL_H__
 
+#include <stddef.h>
 #include <stdbool.h>
 
 /*
@@ -18,6 +19,7 @@
 struct twfs_file;
 struct twfs_read;
 struct ssl_session;
+struct stat;
 
 
 /*
@@ -323,21 +325,27 @@ typedef	enum
 /*
 --------------------------------------------------------------------------------
 
-	Twfs List File Type
+	Twfs Path Captures
 
 --------------------------------------------------------------------------------
 */
-/* read and write operation type for list file									*/
-typedef enum
+#define	DEF_TWFS_PATH_CAPTURES			3
+
+/* a name in a path; it is not null-terminated									*/
+struct twfs_path_span
+{
+	const char		*name;
+	size_t			len;
+};
+
+/* names captured by classifyTwfsPath											*/
+struct twfs_path_capture
 {
-	E_LIST_TYPE_ERROR,
-	E_LIST_TYPE_W_DOT_R_NORM,	// read tweet and write them to dot file
-								// open a normal list file as read file
-	E_LIST_TYPE_W_NORM_R_DOT,	// read tweet and write them to normal list
-								// open a dot list file as read file
-	E_LIST_TYPE_W_NORM_R_NORM,
-	E_LIST_TYPE_W_DOT_R_DOT,
-} E_LIST_TYPE;
+	/* [0]:first screen name													*/
+	/* [1]:second screen name, list slug, tweet id or direct message id		*/
+	/* [2]:third screen name( list members or subscribers )						*/
+	struct twfs_path_span	sname[ DEF_TWFS_PATH_CAPTURES ];
+};
 
 
 /*
@@ -420,6 +428,49 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int closeTwfsFile( struct twfs_file **close_twfs_file );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:lockTwfsFile
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:struct twfs_file *twfs_file
+				 < tl is updated to current mapping, and size to records
+				   appended by a builder or saved before the oldest one >
+	Return		:void
+	Description	:keep mapping of a file in place while reading it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void lockTwfsFile( struct twfs_file *twfs_file );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:unlockTwfsFile
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:void
+	Return		:void
+	Description	:let mapping of a file move
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void unlockTwfsFile( struct twfs_file *twfs_file );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsReadOffset
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information locked by lockTwfsFile >
+				 off_t offset
+				 < offset user requested >
+	Output		:void
+	Return		:off_t
+				 < offset over current records >
+	Description	:get offset of a read over records of a file. history saved
+				 before the oldest record after the handle is opened is not
+				 seen by the handle, so records it has read do not move
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+off_t getTwfsReadOffset( struct twfs_file *twfs_file, off_t offset );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:openTwfsFile
@@ -471,6 +522,23 @@ int openTwfsTweetFile( struct twfs_file **open_twfs_file,
 					   const char *slug,
 					   const char *owner );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:classifyTwfsPath
+	Input		:const char *path
+				 < path over twitter file system >
+				 struct twfs_path_capture *capture
+				 < names captured from path >
+	Output		:struct twfs_path_capture *capture
+				 < spans of screen names, slug and tweet id in path >
+	Return		:E_TWFS_FILE_TYPE
+				 < type of twfs special file >
+	Description	:classify a path without copying names in it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+E_TWFS_FILE_TYPE
+classifyTwfsPath( const char *path, struct twfs_path_capture *capture );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:whichTwfsPath
@@ -574,7 +642,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:read home or user timeline of authenticated user
+	Description	:read home or user timeline of authenticated user. number of
+				 tweets read at once can be set by DEF_TWFS_XATTR_PAGE_COUNT
+				 attribute of the file
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int readTweet( E_TWFS_REQ request,
@@ -584,6 +654,34 @@ int readTweet( E_TWFS_REQ request,
 			   const char *last,
 			   const char *slug );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:backfillTwfsTimeLine
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information of reader >
+				 const char *r_path
+				 < path to file over root directory >
+				 const char *screen_name
+				 < screen name in path to file >
+				 E_TWFS_FILE_TYPE file_type
+				 < twfs file type >
+				 const char *slug
+				 < slug used for only lists timelines >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:when a read reaches the end of a timeline file, that is the
+				 reader has gone through all the history in it, get older
+				 tweets in background and save them before the oldest record.
+				 it starts once in DEF_TWFS_BACKFILL_INTERVAL for a file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int backfillTwfsTimeLine( struct twfs_file *twfs_file,
+						  const char *r_path,
+						  const char *screen_name,
+						  E_TWFS_FILE_TYPE file_type,
+						  const char *slug );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:readDM
@@ -785,6 +883,60 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getTotalSizeOfTlFile( struct twfs_file *twfs_file );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsAttrCache
+	Input		:const struct stat *statbuf
+				 < statistics of backing file >
+				 size_t *tl_size
+				 < total size of timeline file >
+	Output		:size_t *tl_size
+				 < total size of timeline file >
+	Return		:int
+				 < -1 : not cached or backing file has been changed >
+	Description	:get total size of timeline file from attribute cache
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsAttrCache( const struct stat *statbuf, size_t *tl_size );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setTwfsAttrCache
+	Input		:const struct stat *statbuf
+				 < statistics of backing file >
+				 size_t tl_size
+				 < total size of timeline file >
+	Output		:void
+	Return		:void
+	Description	:cache total size of timeline file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setTwfsAttrCache( const struct stat *statbuf, size_t tl_size );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:updateTwfsAttrCache
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:void
+	Return		:void
+	Description	:cache total size of timeline file which has been updated
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void updateTwfsAttrCache( struct twfs_file *twfs_file );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:invalidateTwfsAttrCache
+	Input		:const char *r_path
+				 < path to file under root directory >
+	Output		:void
+	Return		:void
+	Description	:drop cached attributes of a file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void invalidateTwfsAttrCache( const char *r_path );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:getNextCursorOfListFileFromFd
@@ -899,4 +1051,20 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int makeUserListsSlugDir( const char *screen_name, const char *slug );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:makeUserHomeOnAccess
+	Input		:const char *path
+				 < path from mount directory >
+				 bool dir
+				 < true:path itself may be [screen_name] directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make the rest of user home when a user which has been made
+				 with status directory only is accessed first
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int makeUserHomeOnAccess( const char *path, bool dir );
+
 #endif	// __TWFS_INTERNAL_H__
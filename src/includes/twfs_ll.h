@@ -0,0 +1,120 @@
+/*******************************************************************************
+ File:twfs_ll.h
+ Description:Definitions of low-level frontend of twfs
+
+*******************************************************************************/
+#ifndef	__TWFS_LL_H__
+#define	__TWFS_LL_H__
+
+#include "twfs_internal.h"
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+struct stat;
+struct fuse_operations;
+struct fuse_args;
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+/* ---------------------------------------------------------------------------- */
+/* kernel cache of entries and attributes replied by low-level frontend (sec)	*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_LL_ENTRY_TIMEOUT		30.0
+#define	DEF_TWFS_LL_ATTR_TIMEOUT		3.0
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:startTwfsLowLevel
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:start twfs with fuse low-level api
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int startTwfsLowLevel( int argc, char *argv[ ] );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsAttributes
+	Input		:E_TWFS_FILE_TYPE file_type
+				 < type of file >
+				 const char *sname1
+				 < first screen name in path to file >
+				 const char *r_path
+				 < path to file over root directory >
+				 struct stat *statbuf
+				 < statistics information buffer >
+	Outpu		:struct stat *statbuf
+				 < statistics information buffer >
+	Return		:int
+				 < status >
+	Description	:get attributes of a file which is already classified
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsAttributes( E_TWFS_FILE_TYPE file_type,
+					   const char *sname1,
+					   const char *r_path,
+					   struct stat *statbuf );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsOperations
+	Input		:void
+	Output		:void
+	Return		:const struct fuse_operations*
+				 < operations of twfs >
+	Description	:get twfs operations
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+const struct fuse_operations* getTwfsOperations( void );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsFuseArgs
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+				 struct fuse_args *args
+				 < arguments for fuse >
+	Output		:struct fuse_args *args
+				 < program, mount point and options of fuse >
+	Return		:int
+				 < status >
+	Description	:get arguments for fuse. arguments after the mount point are
+				 options of fuse and passed through, except options of twfs.
+				 caller frees args
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsFuseArgs( int argc, char *argv[ ], struct fuse_args *args );
+
+#endif	//__TWFS_LL_H__
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ File:twfs_queue.h
+ Description:Definitions of outbound queue of mutations to twitter
+
+*******************************************************************************/
+#ifndef	__TWFS_QUEUE_H__
+#define	__TWFS_QUEUE_H__
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+/* ---------------------------------------------------------------------------- */
+/* journal of queued mutations under root directory. it is also read as status	*/
+/* of the queue at the top of twfs												*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_QUEUE_FILE				".twfs_queue"
+
+/* ---------------------------------------------------------------------------- */
+/* retry of a failed mutation. interval doubles from min to max (sec)			*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_QUEUE_MAX_ATTEMPTS		8
+#define	DEF_TWFS_QUEUE_RETRY_MIN		2
+#define	DEF_TWFS_QUEUE_RETRY_MAX		300
+
+/* ---------------------------------------------------------------------------- */
+/* mutations, arguments are kept in order of twitter operation to call			*/
+/* ---------------------------------------------------------------------------- */
+typedef enum
+{
+	E_TWFS_MUT_TWEET,				// tweetTwapi( message )
+	E_TWFS_MUT_DM,					// sendDirectMessage( to, message )
+	E_TWFS_MUT_REMOVE_TWEET,		// removeTweet( id )
+	E_TWFS_MUT_REMOVE_DM,			// removeDirectMessage( id )
+	E_TWFS_MUT_FOLLOW,				// requestFollow( screen_name )
+	E_TWFS_MUT_UNFOLLOW,			// requestUnfollow( screen_name )
+	E_TWFS_MUT_FAVORITE,			// requestFavorite( id )
+	E_TWFS_MUT_UNFAVORITE,			// requestUnFavorite( id )
+	E_TWFS_MUT_BLOCK,				// requestBlock( screen_name )
+	E_TWFS_MUT_UNBLOCK,				// requestUnblock( screen_name )
+	E_TWFS_MUT_ADD_MEMBER,			// createListsMembers( slug, owner, sname )
+	E_TWFS_MUT_REMOVE_MEMBER,		// destroyListsMembers( slug, owner, sname )
+	E_TWFS_MUT_SUBSCRIBE,			// subscribeLists( slug, owner )
+	E_TWFS_MUT_UNSUBSCRIBE,			// stopSubscribeLists( slug, owner )
+	E_TWFS_MUT_DELETE_LISTS,		// deleteLists( owner, slug )
+	E_TWFS_MUT_NUM,
+} E_TWFS_MUT;
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsQueue
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:open journal of the queue, queue mutations left in it and
+				 start to send them
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsQueue( const char *root_path );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsQueue
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:stop sending mutations. mutations not sent yet are kept in
+				 the journal for next mount
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsQueue( void );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:queueTwfsMutation
+	Input		:E_TWFS_MUT mut
+				 < mutation >
+				 const char *arg1
+				 < first argument of operation, NULL:none >
+				 const char *arg2
+				 < second argument of operation, NULL:none >
+				 const char *arg3
+				 < third argument of operation, NULL:none >
+				 const char *msg
+				 < message of tweet or direct message, NULL:none >
+				 int size
+				 < size of message >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:journal a mutation and queue it to be sent in order
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int queueTwfsMutation( E_TWFS_MUT mut,
+					   const char *arg1,
+					   const char *arg2,
+					   const char *arg3,
+					   const char *msg,
+					   int size );
+
+#endif	//__TWFS_QUEUE_H__
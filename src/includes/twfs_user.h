@@ -0,0 +1,106 @@
+/*******************************************************************************
+ File:twfs_user.h
+ Description:Definitions of dictionary of twitter users
+
+*******************************************************************************/
+#ifndef	__TWFS_USER_H__
+#define	__TWFS_USER_H__
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+/* ---------------------------------------------------------------------------- */
+/* dictionary of users under root directory. it maps user id to screen name	*/
+/* so that renames of screen name are followed								*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_USER_FILE				".twfs_users"
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsUserDict
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:map dictionary of users and hash users in it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsUserDict( const char *root_path );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsUserDict
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:unmap dictionary of users
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsUserDict( void );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:internTwfsUser
+	Input		:const char *user_id
+				 < user id >
+				 const char *screen_name
+				 < current screen name of the user >
+				 char *old_sname
+				 < buffer of DEF_TWAPI_MAX_SCREEN_NAME_LEN >
+	Output		:char *old_sname
+				 < previous screen name if the user is renamed, or empty >
+	Return		:int
+				 < status >
+	Description	:look up a user by user id, adding the user if it is not
+				 known yet, and follow a change of its screen name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int internTwfsUser( const char *user_id,
+					const char *screen_name,
+					char *old_sname );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsUserId
+	Input		:const char *screen_name
+				 < screen name >
+				 char *user_id
+				 < buffer of DEF_TWFS_ID_FIELD + 1 >
+	Output		:char *user_id
+				 < id of the user who has the screen name now >
+	Return		:int
+				 < status, -1:not known >
+	Description	:get id of a user by current screen name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsUserId( const char *screen_name, char *user_id );
+
+#endif	//__TWFS_USER_H__
@@ -6,6 +6,8 @@
 #ifndef	__TWITTER_OPERATION_H__
 #define	__TWITTER_OPERATION_H__
 
+#include <stdbool.h>
+
 #include "net/ssl.h"
 #include "net/http.h"
 
@@ -32,6 +34,39 @@ struct ssl_session;
 #define	DEF_TWOPE_MAX_FAV_COUNT			20
 #define	DEF_TWOPE_MAX_LISTS_TWEET_COUNT	DEF_TWOPE_MAX_TWEET_COUNT
 #define	DEF_TWOPE_MAX_LISTS_COUNT		20
+#define	DEF_TWOPE_MAX_TWEET_PAGE_COUNT	200		// maximum of timeline apis
+#define	DEF_TWOPE_MAX_FF_PAGE_COUNT		200		// maximum of follower/friends list
+
+/* ---------------------------------------------------------------------------- */
+/* rate limit of apis is written under root directory for monitoring			*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWOPE_LIMIT_FILE			".twfs_rate_limit"
+
+/* ---------------------------------------------------------------------------- */
+/* apis whose rate limit is kept												*/
+/* ---------------------------------------------------------------------------- */
+typedef enum
+{
+	E_TWOPE_LIMIT_HOME_TL,				// statuses/home_timeline
+	E_TWOPE_LIMIT_MENTIONS_TL,			// statuses/mentions_timeline
+	E_TWOPE_LIMIT_USER_TL,				// statuses/user_timeline
+	E_TWOPE_LIMIT_RTW_OF_ME,			// statuses/retweets_of_me
+	E_TWOPE_LIMIT_FRIENDS,				// friends/list
+	E_TWOPE_LIMIT_FOLLOWERS,			// followers/list
+	E_TWOPE_LIMIT_BLOCKS,				// blocks/list
+	E_TWOPE_LIMIT_USERS_SHOW,			// users/show
+	E_TWOPE_LIMIT_DM,					// direct_messages
+	E_TWOPE_LIMIT_DM_SENT,				// direct_messages/sent
+	E_TWOPE_LIMIT_FAV_LIST,				// favorites/list
+	E_TWOPE_LIMIT_LISTS_TL,				// lists/statuses
+	E_TWOPE_LIMIT_LISTS_OWNERSHIPS,		// lists/ownerships
+	E_TWOPE_LIMIT_LISTS_SUBSCRIPTIONS,	// lists/subscriptions
+	E_TWOPE_LIMIT_LISTS_MEMBERSHIPS,	// lists/memberships
+	E_TWOPE_LIMIT_LISTS_MEMBERS,		// lists/members
+	E_TWOPE_LIMIT_LISTS_SUBSCRIBERS,	// lists/subscribers
+	E_TWOPE_LIMIT_LISTS_SHOW,			// lists/show
+	E_TWOPE_LIMIT_NUM,
+} E_TWOPE_LIMIT;
 
 /*
 ================================================================================
@@ -59,6 +94,43 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 void initTwitterOperation( void );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwitterRateLimit
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:open the file to monitor rate limit of apis
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwitterRateLimit( const char *root_path );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwitterRateLimit
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:close the file to monitor rate limit of apis
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwitterRateLimit( void );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setTwitterOperationBackground
+	Input		:bool background
+				 < true:requests of the thread are for background >
+	Output		:void
+	Return		:void
+	Description	:background requests leave DEF_TWOPE_LIMIT_RESERVE calls of
+				 each rate limit window to opens by users
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setTwitterOperationBackground( bool background );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:setTwapiUserId
@@ -196,8 +268,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -206,7 +282,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getHomeTimeLine( struct ssl_session *session,
 					 struct http_ctx *hctx,
-					 const char *last );
+					 const int count,
+					 const char *last,
+					 const char *max_id );
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -215,8 +293,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -225,7 +307,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getMentionsTimeLine( struct ssl_session *session,
 						 struct http_ctx *hctx,
-						 const char *last );
+						 const int count,
+						 const char *last,
+						 const char *max_id );
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -236,8 +320,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < http context >
 				 const char *screen_name
 				 < screen name to get his timelin >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -247,7 +335,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 int getUserTimeLine( struct ssl_session *session,
 					 struct http_ctx *hctx,
 					 const char *screen_name,
-					 const char *last );
+					 const int count,
+					 const char *last,
+					 const char *max_id );
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -256,8 +346,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -266,7 +360,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getRetweetOfMeTimeLine( struct ssl_session *session,
 							struct http_ctx *hctx,
-							const char *last );
+							const int count,
+							const char *last,
+							const char *max_id );
 
 /*
 ================================================================================
@@ -602,8 +698,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx,
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < latest tweet id which already has been received >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -612,7 +712,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int	getFavoritesList( struct ssl_session *session,
 					  struct http_ctx *hctx,
-					  const char *last );
+					  const int count,
+					  const char *last,
+					  const char *max_id );
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -662,8 +764,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < slug for list >
 				 const char *owner
 				 < screen name for owner >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -674,7 +780,9 @@ int getListsTimeLine( struct ssl_session *session,
 					  struct http_ctx *hctx,
 					  const char *slug,
 					  const char *owner,
-					  const char *last );
+					  const int count,
+					  const char *last,
+					  const char *max_id );
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -836,6 +944,50 @@ int destroyListsMembers( struct ssl_session *session,
 						 const char *owner_screen_name,
 						 const char *screen_name );
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:createAllListsMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *slug
+				 < slug of list to create members >
+				 const char *owner_screen_name
+				 < owner of the list >
+				 const char *screen_names
+				 < screen names to create, separated by comma >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:create members of list at once
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int createAllListsMembers( struct ssl_session *session,
+						   const char *slug,
+						   const char *owner_screen_name,
+						   const char *screen_names );
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyAllListsMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *slug
+				 < slug of list to destroy members >
+				 const char *owner_screen_name
+				 < owner of the list >
+				 const char *screen_names
+				 < screen names to destroy, separated by comma >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:destroy members of list at once
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int destroyAllListsMembers( struct ssl_session *session,
+							const char *slug,
+							const char *owner_screen_name,
+							const char *screen_names );
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:subscribeLists
@@ -149,9 +149,19 @@ int main( int argc, char *argv[ ] )
 	int					result;
 	struct ssl_session	session;
 
-	if( argc != 4 )
+	/* ------------------------------------------------------------------------ */
+	/* threads and durability are not replaced by defaults when mistyped		*/
+	/* ------------------------------------------------------------------------ */
+	if( ( argc < 4 ) ||
+		( getTwfsWorkers( argc, argv ) < 0 ) ||
+		( getTwfsDurability( argc, argv ) < 0 ) )
 	{
-		printf( "twfs screen_name root_directory mount_point\n" );
+		printf( "twfs screen_name root_directory mount_point [options]\n"
+				"  --threads=N                       threads serving the kernel.\n"
+				"                                    fetches still use one session\n"
+				"  --durability=none|periodic|group  flush of fetched files\n"
+				"  --high-level                      use fuse high-level api\n"
+				"  other options are passed to fuse\n" );
 		return( -1 );
 	}
 	
@@ -326,6 +336,8 @@ int initFileSystemTw( int argc, char *argv[ ],
 	session->socket			= 0;
 	session->ssl_handle		= NULL;
 	session->ssl_context	= NULL;
+	session->resume			= NULL;
+	session->cork_buf		= NULL;
 
 
 	/* ------------------------------------------------------------------------ */
@@ -7,7 +7,10 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include <zlib.h>
+
 #include "lib/ascii.h"
+#include "lib/log.h"
 #include "net/ssl.h"
 #include "net/http.h"
 
@@ -21,6 +24,26 @@
 static int skipSpace( unsigned char *buffer, int *index, int max_size );
 static int skipToSpace( unsigned char *buffer, int *index, int max_size );
 void analyzeStatusCode( struct http_ctx *hctx, unsigned char *buffer );
+static int inflateHttpBody( struct ssl_session *session, struct http_ctx *hctx );
+static int recvHttpChunkedBody( struct ssl_session *session,
+								struct http_ctx *hctx );
+static int recvHttpLine( struct ssl_session *session,
+						 unsigned char *buffer,
+						 int size );
+static int storeHttpChunk( struct http_ctx *hctx,
+						   z_stream *strm,
+						   unsigned char *chunk,
+						   int length,
+						   unsigned char **body,
+						   int *body_len,
+						   int *body_size );
+static unsigned char* initHttpInflate( z_stream *strm,
+									   struct http_ctx *hctx,
+									   int *body_size );
+static int inflateHttpChunk( z_stream *strm,
+							 unsigned char **body,
+							 int *body_len,
+							 int *body_size );
 
 
 /*
@@ -31,6 +54,9 @@ void analyzeStatusCode( struct http_ctx *hctx, unsigned char *buffer );
 ================================================================================
 */
 #define	DEF_HTTP_MAX_LINE		1024
+#define	DEF_HTTP_INFLATE_CHUNK	4096			// compressed bytes read at once
+#define	DEF_HTTP_INFLATE_RATIO	8				// expected ratio of json by gzip
+#define	DEF_HTTP_GZIP_WBITS		( 16 + MAX_WBITS )	// decode gzip format only
 
 /*
 ================================================================================
@@ -45,6 +71,12 @@ typedef enum
 	E_HIS_HTTP_HEADER,
 }E_HTTP_INTERP_STATE;
 
+static int analyzeHttpHeaderLine( struct ssl_session *session,
+								  struct http_ctx *hctx,
+								  E_HTTP_INTERP_STATE *state,
+								  unsigned char *head_buffer,
+								  int len );
+
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -72,6 +104,11 @@ int initHttpContext( struct http_ctx *hctx )
 	}
 	hctx->status_code	= 0;
 	hctx->content_length= 0;
+	hctx->gzip			= false;
+	hctx->chunked		= false;
+	hctx->rate_limit	= -1;
+	hctx->rate_remaining= -1;
+	hctx->rate_reset	= 0;
 
 	return( 0 );
 }
@@ -82,7 +119,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < context of http received data >
-	Output		:struct http_ctx *hctx
+	Output		:struct ssl_session *session
+				 < status code of the response is kept >
+				 struct http_ctx *hctx
 				 < first body data block may be stored >
 	Return		:int
 				 < status >
@@ -92,7 +131,6 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx )
 {
 	int					result;
-	int					index;
 	int					len;
 	bool				finish;
 	unsigned char		head_buffer[ DEF_HTTP_MAX_LINE ];
@@ -101,6 +139,11 @@ int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx )
 	state			= E_HIS_HTTP_VER;
 	finish			= false;
 
+	/* body of the last response is not read any more							*/
+	clearSSLPendingMessage( session );
+
+	session->status_code = 0;
+
 	while( 1 )
 	{
 		len = 0;
@@ -109,7 +152,7 @@ int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx )
 		{
 			result = recvSSLMessage( session, &head_buffer[ len ], 1 );
 
-			if( result < 0 )
+			if( result <= 0 )
 			{
 				if( E_HIS_HTTP_HEADER <= state )
 				{
@@ -130,6 +173,16 @@ int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx )
 					if( finish )
 					{
 						/* reading headers is finished							*/
+						session->status_code = hctx->status_code;
+
+						if( hctx->chunked )
+						{
+							return( recvHttpChunkedBody( session, hctx ) );
+						}
+						if( hctx->gzip )
+						{
+							return( inflateHttpBody( session, hctx ) );
+						}
 						return( 0 );
 					}
 					/* set null terminator										*/
@@ -160,68 +213,14 @@ int recvHttpHeader( struct ssl_session *session, struct http_ctx *hctx )
 		/* -------------------------------------------------------------------- */
 		/* analyze headers														*/
 		/* -------------------------------------------------------------------- */
-		switch( state )
+		if( ( result = analyzeHttpHeaderLine( session, hctx, &state,
+											  head_buffer, len ) ) < 0 )
 		{
-		/* -------------------------------------------------------------------- */
-		/* interpret "HTTP/1.1 status code"										*/
-		/* -------------------------------------------------------------------- */
-		case	E_HIS_HTTP_VER:
-			if( strnCaseCmp( DEF_HTTPH_HTTP, ( const char* )head_buffer,
-							 sizeof( DEF_HTTPH_HTTP ) - 1 ) == 0 )
-			{
-				index = sizeof( DEF_HTTPH_HTTP ) - 1;
-				result = skipToSpace( head_buffer, &index, len );
-				if( result < 0 )
-				{
-					/* ilegal headers											*/
-					return( -1 );
-				}
-
-				result = skipSpace( head_buffer, &index, len );
-				if( result < 0 )
-				{
-					/* ilegal headers											*/
-					return( -1 );
-				}
-
-				analyzeStatusCode( hctx, &head_buffer[ index ] );
-				
-				if( hctx->status_code == DEF_HTTPH_STATUS_CONTINUE )
-				{
-					break;
-				}
-				else
-				{
-					state = E_HIS_HTTP_HEADER;
-				}
-			}
-			else
-			{
-				/* ilegal header												*/
-				return( -1 );
-			}
-			break;
-		/* -------------------------------------------------------------------- */
-		/* interpret Content-Length												*/
-		/* -------------------------------------------------------------------- */
-		case	E_HIS_HTTP_HEADER:
-			if( strnCaseCmp( DEF_HTTPH_CONTENT_LENGTH, ( const char* )head_buffer,
-							 sizeof( DEF_HTTPH_CONTENT_LENGTH ) - 1 ) == 0 )
-			{
-				index = sizeof( DEF_HTTPH_CONTENT_LENGTH );
-				result = skipSpace( head_buffer, &index, len );
-				if( result < 0 )
-				{
-					/* ilegal headers											*/
-					printf( "ilegal 4\n" );
-					return( -1 );
-				}
-				hctx->content_length = atoi( ( const char* )&head_buffer[ index ] );
-			}
-			break;
+			return( result );
 		}
 	}
 }
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:void
@@ -240,6 +239,212 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 */
 /*
+================================================================================
+	Function	:analyzeHttpHeaderLine
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 struct http_ctx *hctx
+				 < context of http received data >
+				 E_HTTP_INTERP_STATE *state
+				 < state of interpretation >
+				 unsigned char *head_buffer
+				 < a header line terminated by null >
+				 int len
+				 < length of the line >
+	Output		:struct http_ctx *hctx
+				 < updated context >
+				 E_HTTP_INTERP_STATE *state
+				 < next state >
+	Return		:int
+				 < status >
+	Description	:interpret a line of http headers
+================================================================================
+*/
+static int analyzeHttpHeaderLine( struct ssl_session *session,
+								  struct http_ctx *hctx,
+								  E_HTTP_INTERP_STATE *state,
+								  unsigned char *head_buffer,
+								  int len )
+{
+	int		result;
+	int		index;
+	int		length;
+
+	switch( *state )
+	{
+	/* -------------------------------------------------------------------- */
+	/* interpret "HTTP/1.1 status code"										*/
+	/* -------------------------------------------------------------------- */
+	case	E_HIS_HTTP_VER:
+		if( strnCaseCmp( DEF_HTTPH_HTTP, ( const char* )head_buffer,
+						 sizeof( DEF_HTTPH_HTTP ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_HTTP ) - 1;
+			result = skipToSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+
+			analyzeStatusCode( hctx, &head_buffer[ index ] );
+			
+			if( hctx->status_code == DEF_HTTPH_STATUS_CONTINUE )
+			{
+				break;
+			}
+			else
+			{
+				*state = E_HIS_HTTP_HEADER;
+			}
+		}
+		else
+		{
+			/* ilegal header												*/
+			return( -1 );
+		}
+		break;
+	/* -------------------------------------------------------------------- */
+	/* interpret Content-Length												*/
+	/* -------------------------------------------------------------------- */
+	case	E_HIS_HTTP_HEADER:
+		if( strnCaseCmp( DEF_HTTPH_CONTENT_LENGTH, ( const char* )head_buffer,
+						 sizeof( DEF_HTTPH_CONTENT_LENGTH ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_CONTENT_LENGTH );
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				printf( "ilegal 4\n" );
+				return( -1 );
+			}
+			hctx->content_length = atoi( ( const char* )&head_buffer[ index ] );
+		}
+		/* ---------------------------------------------------------------- */
+		/* interpret Connection												*/
+		/* ---------------------------------------------------------------- */
+		else if( strnCaseCmp( DEF_HTTPH_CONNECTION,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_CONNECTION ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_CONNECTION ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			if( strnCaseCmp( DEF_HTTPH_CLOSE,
+							 ( const char* )&head_buffer[ index ],
+							 sizeof( DEF_HTTPH_CLOSE ) - 1 ) == 0 )
+			{
+				/* server closes after this response, so reconnect		*/
+				session->keep_alive = false;
+			}
+		}
+		/* ---------------------------------------------------------------- */
+		/* interpret Content-Encoding										*/
+		/* ---------------------------------------------------------------- */
+		else if( strnCaseCmp( DEF_HTTPH_CONTENT_ENCODING,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_CONTENT_ENCODING ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_CONTENT_ENCODING ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			if( strnCaseCmp( DEF_HTTPH_GZIP,
+							 ( const char* )&head_buffer[ index ],
+							 sizeof( DEF_HTTPH_GZIP ) - 1 ) == 0 )
+			{
+				hctx->gzip = true;
+			}
+		}
+		/* ---------------------------------------------------------------- */
+		/* interpret Transfer-Encoding										*/
+		/* ---------------------------------------------------------------- */
+		else if( strnCaseCmp( DEF_HTTPH_TRANSFER_ENCODING,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_TRANSFER_ENCODING ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_TRANSFER_ENCODING ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			/* chunked is always the last of encodings						*/
+			length = ( int )strlen( ( const char* )head_buffer )
+				   - ( int )( sizeof( DEF_HTTPH_CHUNKED ) - 1 );
+			if( ( index <= length ) &&
+				( strnCaseCmp( DEF_HTTPH_CHUNKED,
+							   ( const char* )&head_buffer[ length ],
+							   sizeof( DEF_HTTPH_CHUNKED ) - 1 ) == 0 ) )
+			{
+				hctx->chunked = true;
+			}
+		}
+		/* ---------------------------------------------------------------- */
+		/* interpret x-rate-limit-*											*/
+		/* ---------------------------------------------------------------- */
+		else if( strnCaseCmp( DEF_HTTPH_RATE_LIMIT,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_RATE_LIMIT ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_RATE_LIMIT ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			hctx->rate_limit = atoi( ( const char* )&head_buffer[ index ] );
+		}
+		else if( strnCaseCmp( DEF_HTTPH_RATE_REMAINING,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_RATE_REMAINING ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_RATE_REMAINING ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			hctx->rate_remaining = atoi( ( const char* )&head_buffer[ index ] );
+		}
+		else if( strnCaseCmp( DEF_HTTPH_RATE_RESET,
+							  ( const char* )head_buffer,
+							  sizeof( DEF_HTTPH_RATE_RESET ) - 1 ) == 0 )
+		{
+			index = sizeof( DEF_HTTPH_RATE_RESET ) - 1;
+			result = skipSpace( head_buffer, &index, len );
+			if( result < 0 )
+			{
+				/* ilegal headers											*/
+				return( -1 );
+			}
+			hctx->rate_reset = ( time_t )strtoll( ( const char* )&head_buffer[ index ],
+												  NULL, 10 );
+		}
+		break;
+	}
+
+	return( 0 );
+}
+/*
 ================================================================================
 	Function	:analyzeStatusCode
 	Input		:unsigned char *buffer
@@ -316,7 +521,7 @@ void analyzeStatusCode( struct http_ctx *hctx, unsigned char *buffer )
 		}
 		break;
 	case	'4':
-		if( second != '0' && second != '1' )
+		if( second != '0' && second != '1' && second != '2' )
 		{
 			hctx->status_code = 400;
 			break;
@@ -354,6 +559,14 @@ void analyzeStatusCode( struct http_ctx *hctx, unsigned char *buffer )
 			default:     hctx->status_code = 400; break;
 			}
 		}
+		else if( second == '2' )
+		{
+			switch( third )
+			{
+			case	'9': hctx->status_code = 429; break;
+			default:     hctx->status_code = 400; break;
+			}
+		}
 		break;
 	case	'5':
 		if( second != '0' )
@@ -450,3 +663,486 @@ static int skipToSpace( unsigned char *buffer, int *index, int max_size )
 
 	return( 0 );
 }
+
+/*
+================================================================================
+	Function	:inflateHttpBody
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 struct http_ctx *hctx
+				 < context of http received data >
+	Output		:struct http_ctx *hctx
+				 < content_length is updated to inflated length >
+	Return		:int
+				 < status >
+	Description	:read a body compressed by gzip chunk by chunk and inflate it,
+				 then let recvSSLMessage read the inflated body
+================================================================================
+*/
+static int inflateHttpBody( struct ssl_session *session, struct http_ctx *hctx )
+{
+	z_stream		strm;
+	unsigned char	chunk[ DEF_HTTP_INFLATE_CHUNK ];
+	unsigned char	*body;
+	int				body_len;
+	int				body_size;
+	int				remain;
+	int				length;
+	int				result;
+
+	if( hctx->content_length <= 0 )
+	{
+		hctx->gzip = false;
+		return( 0 );
+	}
+
+	if( !( body = initHttpInflate( &strm, hctx, &body_size ) ) )
+	{
+		/* compressed body is left on the connection							*/
+		session->keep_alive = false;
+		return( -1 );
+	}
+
+	body_len	= 0;
+	remain		= hctx->content_length;
+	result		= Z_OK;
+
+	/* ------------------------------------------------------------------------ */
+	/* inflate while receiving, compressed body is never stored as a whole		*/
+	/* ------------------------------------------------------------------------ */
+	while( 0 < remain )
+	{
+		length = ( remain < ( int )sizeof( chunk ) ) ? remain : sizeof( chunk );
+
+		if( recvSSLMessage( session, chunk, length ) != length )
+		{
+			result = Z_STREAM_ERROR;
+			break;
+		}
+
+		remain			-= length;
+		strm.next_in	= chunk;
+		strm.avail_in	= length;
+
+		result = inflateHttpChunk( &strm, &body, &body_len, &body_size );
+
+		if( result != Z_OK )
+		{
+			break;
+		}
+	}
+
+	inflateEnd( &strm );
+
+	if( result != Z_STREAM_END )
+	{
+		logMessage( "cannot inflate body (%d)\n", result );
+		free( body );
+		/* rest of compressed body may be left on the connection				*/
+		session->keep_alive = false;
+		return( -1 );
+	}
+
+	body[ body_len ]		= '\0';
+	hctx->content_length	= body_len;
+	hctx->gzip				= false;
+
+	setSSLPendingMessage( session, body, body_len );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:initHttpInflate
+	Input		:z_stream *strm
+				 < stream of zlib >
+				 struct http_ctx *hctx
+				 < context of http received data >
+				 int *body_size
+				 < size of buffer to be allocated >
+	Output		:z_stream *strm
+				 < initialized stream to decode gzip >
+				 int *body_size
+				 < size of allocated buffer >
+	Return		:unsigned char*
+				 < buffer of inflated body. NULL:error >
+	Description	:prepare to inflate a body compressed by gzip
+================================================================================
+*/
+static unsigned char* initHttpInflate( z_stream *strm,
+									   struct http_ctx *hctx,
+									   int *body_size )
+{
+	unsigned char	*body;
+
+	strm->zalloc	= Z_NULL;
+	strm->zfree		= Z_NULL;
+	strm->opaque	= Z_NULL;
+	strm->next_in	= Z_NULL;
+	strm->avail_in	= 0;
+
+	if( inflateInit2( strm, DEF_HTTP_GZIP_WBITS ) != Z_OK )
+	{
+		return( NULL );
+	}
+
+	/* length of chunked body is not known in advance							*/
+	*body_size = ( ( 0 < hctx->content_length ) ? hctx->content_length
+												: DEF_HTTP_INFLATE_CHUNK )
+			   * DEF_HTTP_INFLATE_RATIO + 1;
+
+	if( !( body = malloc( *body_size ) ) )
+	{
+		inflateEnd( strm );
+		return( NULL );
+	}
+
+	return( body );
+}
+
+/*
+================================================================================
+	Function	:inflateHttpChunk
+	Input		:z_stream *strm
+				 < stream of zlib which has input >
+				 unsigned char **body
+				 < buffer of inflated body >
+				 int *body_len
+				 < length of inflated body >
+				 int *body_size
+				 < size of buffer >
+	Output		:unsigned char **body
+				 < buffer may be reallocated to be large >
+				 int *body_len
+				 < updated length >
+				 int *body_size
+				 < updated size >
+	Return		:int
+				 < Z_OK:need more input Z_STREAM_END:finished others:error >
+	Description	:inflate all of input, and leave a byte for null terminator
+================================================================================
+*/
+static int inflateHttpChunk( z_stream *strm,
+							 unsigned char **body,
+							 int *body_len,
+							 int *body_size )
+{
+	unsigned char	*new_body;
+	int				result;
+
+	while( 1 )
+	{
+		if( *body_size - 1 <= *body_len )
+		{
+			if( !( new_body = realloc( *body, *body_size * 2 ) ) )
+			{
+				return( Z_MEM_ERROR );
+			}
+
+			*body		= new_body;
+			*body_size	= *body_size * 2;
+		}
+
+		strm->next_out	= *body + *body_len;
+		strm->avail_out	= *body_size - 1 - *body_len;
+
+		result = inflate( strm, Z_NO_FLUSH );
+
+		*body_len = *body_size - 1 - strm->avail_out;
+
+		switch( result )
+		{
+		case	Z_STREAM_END:
+			return( Z_STREAM_END );
+		case	Z_BUF_ERROR:
+			/* no progress is possible without more input						*/
+			return( Z_OK );
+		case	Z_OK:
+			break;
+		default:
+			return( ( result < 0 ) ? result : Z_DATA_ERROR );
+		}
+
+		if( !strm->avail_in && strm->avail_out )
+		{
+			return( Z_OK );
+		}
+	}
+}
+
+/*
+================================================================================
+	Function	:recvHttpChunkedBody
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 struct http_ctx *hctx
+				 < context of http received data >
+	Output		:struct http_ctx *hctx
+				 < content_length is updated to length of whole body >
+	Return		:int
+				 < status >
+	Description	:read a body sent in chunks, inflating it if it is compressed
+				 by gzip, then let recvSSLMessage read the whole body
+================================================================================
+*/
+static int recvHttpChunkedBody( struct ssl_session *session,
+								struct http_ctx *hctx )
+{
+	z_stream		strm;
+	unsigned char	line[ DEF_HTTP_MAX_LINE ];
+	unsigned char	chunk[ DEF_HTTP_INFLATE_CHUNK ];
+	unsigned char	*body;
+	char			*end;
+	int				body_len;
+	int				body_size;
+	long			remain;
+	int				length;
+	int				result;
+
+	hctx->content_length = 0;
+
+	if( hctx->gzip )
+	{
+		body = initHttpInflate( &strm, hctx, &body_size );
+	}
+	else
+	{
+		body_size	= DEF_HTTP_INFLATE_CHUNK * DEF_HTTP_INFLATE_RATIO + 1;
+		body		= malloc( body_size );
+	}
+
+	if( !body )
+	{
+		/* chunks are left on the connection									*/
+		session->keep_alive = false;
+		return( -1 );
+	}
+
+	body_len	= 0;
+	result		= Z_OK;
+
+	while( 1 )
+	{
+		/* -------------------------------------------------------------------- */
+		/* size of a chunk in hex, which may be followed by extensions			*/
+		/* -------------------------------------------------------------------- */
+		if( recvHttpLine( session, line, sizeof( line ) ) < 0 )
+		{
+			result = Z_STREAM_ERROR;
+			break;
+		}
+
+		remain = strtol( ( const char* )line, &end, 16 );
+
+		if( ( end == ( char* )line ) || ( remain < 0 ) )
+		{
+			result = Z_STREAM_ERROR;
+			break;
+		}
+
+		/* last chunk															*/
+		if( remain == 0 )
+		{
+			break;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* store a chunk, data after end of gzip stream is discarded			*/
+		/* -------------------------------------------------------------------- */
+		while( 0 < remain )
+		{
+			length = ( remain < ( long )sizeof( chunk ) ) ? ( int )remain
+														  : sizeof( chunk );
+
+			if( recvSSLMessage( session, chunk, length ) != length )
+			{
+				result = Z_STREAM_ERROR;
+				break;
+			}
+
+			remain -= length;
+
+			if( result == Z_OK )
+			{
+				result = storeHttpChunk( hctx, &strm, chunk, length,
+										 &body, &body_len, &body_size );
+			}
+
+			if( ( result != Z_OK ) && ( result != Z_STREAM_END ) )
+			{
+				break;
+			}
+		}
+
+		if( ( result != Z_OK ) && ( result != Z_STREAM_END ) )
+		{
+			break;
+		}
+
+		/* chunk is terminated by \r\n											*/
+		if( recvHttpLine( session, line, sizeof( line ) ) != 0 )
+		{
+			result = Z_STREAM_ERROR;
+			break;
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* skip trailers until an empty line										*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result == Z_OK ) || ( result == Z_STREAM_END ) )
+	{
+		while( 0 < ( length = recvHttpLine( session, line, sizeof( line ) ) ) )
+		{
+			continue;
+		}
+
+		if( length < 0 )
+		{
+			result = Z_STREAM_ERROR;
+		}
+	}
+
+	if( hctx->gzip )
+	{
+		inflateEnd( &strm );
+
+		/* gzip stream must be complete											*/
+		if( result == Z_OK )
+		{
+			result = Z_BUF_ERROR;
+		}
+	}
+	else if( result == Z_OK )
+	{
+		result = Z_STREAM_END;
+	}
+
+	if( result != Z_STREAM_END )
+	{
+		logMessage( "cannot receive chunked body (%d)\n", result );
+		free( body );
+		/* rest of chunks may be left on the connection							*/
+		session->keep_alive = false;
+		return( -1 );
+	}
+
+	body[ body_len ]		= '\0';
+	hctx->content_length	= body_len;
+	hctx->gzip				= false;
+	hctx->chunked			= false;
+
+	setSSLPendingMessage( session, body, body_len );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:recvHttpLine
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 unsigned char *buffer
+				 < buffer of a line >
+				 int size
+				 < size of buffer >
+	Output		:unsigned char *buffer
+				 < a line without \r\n, terminated by null >
+	Return		:int
+				 < length of the line, -1:error or too long line >
+	Description	:receive a line terminated by \r\n
+================================================================================
+*/
+static int recvHttpLine( struct ssl_session *session,
+						 unsigned char *buffer,
+						 int size )
+{
+	int		len;
+
+	for( len = 0 ; len < size ; len++ )
+	{
+		if( recvSSLMessage( session, &buffer[ len ], 1 ) != 1 )
+		{
+			return( -1 );
+		}
+
+		if( buffer[ len ] == '\n' )
+		{
+			if( ( 0 < len ) && ( buffer[ len - 1 ] == '\r' ) )
+			{
+				len--;
+			}
+
+			buffer[ len ] = '\0';
+
+			return( len );
+		}
+	}
+
+	return( -1 );
+}
+
+/*
+================================================================================
+	Function	:storeHttpChunk
+	Input		:struct http_ctx *hctx
+				 < context of http received data >
+				 z_stream *strm
+				 < stream of zlib, used if body is compressed by gzip >
+				 unsigned char *chunk
+				 < data of a chunk >
+				 int length
+				 < length of data >
+				 unsigned char **body
+				 < buffer of body >
+				 int *body_len
+				 < length of body >
+				 int *body_size
+				 < size of buffer >
+	Output		:unsigned char **body
+				 < buffer may be reallocated to be large >
+				 int *body_len
+				 < updated length >
+				 int *body_size
+				 < updated size >
+	Return		:int
+				 < Z_OK:need more input Z_STREAM_END:finished others:error >
+	Description	:append data of a chunk to body, and leave a byte for null
+				 terminator
+================================================================================
+*/
+static int storeHttpChunk( struct http_ctx *hctx,
+						   z_stream *strm,
+						   unsigned char *chunk,
+						   int length,
+						   unsigned char **body,
+						   int *body_len,
+						   int *body_size )
+{
+	unsigned char	*new_body;
+
+	if( hctx->gzip )
+	{
+		strm->next_in	= chunk;
+		strm->avail_in	= length;
+
+		return( inflateHttpChunk( strm, body, body_len, body_size ) );
+	}
+
+	while( *body_size - 1 < *body_len + length )
+	{
+		if( !( new_body = realloc( *body, *body_size * 2 ) ) )
+		{
+			return( Z_MEM_ERROR );
+		}
+
+		*body		= new_body;
+		*body_size	= *body_size * 2;
+	}
+
+	memcpy( *body + *body_len, chunk, length );
+	*body_len += length;
+
+	return( Z_OK );
+}
@@ -10,7 +10,11 @@
 #include <string.h>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -27,6 +31,13 @@
 
 ================================================================================
 */
+struct resolver_cache;
+
+static int resolveServer( struct resolver_cache *cache );
+static int raceConnectServer( struct resolver_cache *cache );
+static int finishConnectServer( int soc );
+static long getElapsedMsec( const struct timespec *start );
+static int setSocketNonBlocking( int soc, bool non_block );
 
 
 /*
@@ -37,6 +48,12 @@
 ================================================================================
 */
 #define	DEF_NET_SEND_RETRY			3
+#define	DEF_NET_DNS_TTL				300		// sec, getaddrinfo gives no ttl
+#define	DEF_NET_MAX_ADDRESS			8
+#define	DEF_NET_ATTEMPT_DELAY		250		// msec, rfc 8305
+#define	DEF_NET_ATTEMPT_TIMEOUT		( 3 * 1000 )	// msec, for each address
+#define	DEF_NET_CONNECT_TIMEOUT		( 10 * 1000 )	// msec
+#define	DEF_NET_MAX_PORT			32
 
 /*
 ================================================================================
@@ -45,16 +62,27 @@
 
 ================================================================================
 */
-struct reconnect_info
+struct server_address
 {
-	int				ai_family;
-	int				ai_socktype;
-	int				ai_protocol;
-	socklen_t		ai_addrlen;
-	struct sockaddr	ai_addr;
+	int						ai_family;
+	int						ai_socktype;
+	int						ai_protocol;
+	socklen_t				ai_addrlen;
+	struct sockaddr_storage	ai_addr;
 };
 
-static struct reconnect_info reconnect_info;
+struct resolver_cache
+{
+	char					hostname[ DEF_NET_MAX_HOST_NAME ];
+	char					port[ DEF_NET_MAX_PORT ];
+	time_t					expire;		// re-resolve after this time
+	int						n_addr;
+	int						fastest;	// address won the last race
+	struct server_address	addr[ DEF_NET_MAX_ADDRESS ];
+};
+
+static struct resolver_cache	resolver_cache;
+static pthread_mutex_t			resolver_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -78,12 +106,9 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int connectServer( const char* hostname, char *port_num )
 {
-	int		result;
-	int		soc			= -1;
+	struct resolver_cache	cache;
 	bool	spec_port	= false;
 
-	struct addrinfo		hints, *res, *p;
-	char				ipstr[ INET6_ADDRSTRLEN ];
 	//char				def_port[ ] = "443";		// https
 	char				def_port[ ] = "https";		// https
 
@@ -118,135 +143,35 @@ int connectServer( const char* hostname, char *port_num )
 		}
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* get address information													*/
-	/* ------------------------------------------------------------------------ */
-	memset( &hints, 0x00, sizeof( hints ) );
-	hints.ai_family		= AF_UNSPEC;		// AF_INET or AF_INT6
-	hints.ai_socktype	= SOCK_STREAM;
-
-
-	if( spec_port )
-	{
-		/* get address information of specified port number		*/
-		result = getaddrinfo( hostname, port_num, &hints, &res );
-		//printf( "port_number:%s\n", port_num );
-	}
-	else
-	{
-		/* get address information of default port number		*/
-		result = getaddrinfo( hostname, def_port, &hints, &res );
-		//printf( "port_number:%s\n", def_port);
-	}
-	
-	if( result != 0 )
+	if( !hostname || ( DEF_NET_MAX_HOST_NAME <= strlen( hostname ) ) )
 	{
-		fprintf( stderr, "getaddrinfo: %s\n", gai_strerror( result ) );
 		return( -1 );
 	}
 
-	//printf( "%s\n", hostname );
+	pthread_mutex_lock( &resolver_lock );
 
 	/* ------------------------------------------------------------------------ */
-	/* try to connect each server												*/
+	/* forget cached addresses of another server								*/
 	/* ------------------------------------------------------------------------ */
-	for( p = res ; p != NULL ; p = p->ai_next )
+	if( strcmp( resolver_cache.hostname, hostname ) != 0 ||
+		strcmp( resolver_cache.port, spec_port ? port_num : def_port ) != 0 )
 	{
-
-		void	*addr;
-		char	*ipver;
-
-		/* -------------------------------------------------------------------- */
-		/* get the pointer to the address itself								*/
-		/* -------------------------------------------------------------------- */
-		if( p->ai_family == AF_INET )
-		{
-			/* for ipv4					*/
-			struct sockaddr_in	*ipv4 = ( struct sockaddr_in* )p->ai_addr;
-			addr	= &( ipv4->sin_addr );
-			ipver	= "IPv4";
-			//printf( "connected port=%d\n", ntohs( ipv4->sin_port ) );
-		}
-		else
-		{
-			/* for ipv6					*/
-			struct sockaddr_in6	*ipv6 = ( struct sockaddr_in6* )p->ai_addr;
-			addr	= &( ipv6->sin6_addr );
-			ipver	= "IPv6";
-		}
-		/* -------------------------------------------------------------------- */
-		/* convert the ip to a string and print it								*/
-		/* -------------------------------------------------------------------- */
-		inet_ntop( p->ai_family, addr, ipstr, sizeof( ipstr ) );
-		//printf( "  %s: %s\n", ipver, ipstr );
-
-		/* -------------------------------------------------------------------- */
-		/* create a socket														*/
-		/* -------------------------------------------------------------------- */
-		soc = socket( p->ai_family, p->ai_socktype, p->ai_protocol );
-
-		if( soc < 0 )
-		{
-			if( !p->ai_next )
-			{
-				perror( "socket" );
-				freeaddrinfo( res );
-				return( soc );
-			}
-
-			//printf( "soc:try next\n" );
-			/* ---------------------------------------------------------------- */
-			/* try next server													*/
-			/* ---------------------------------------------------------------- */
-			continue;
-		}
-
-		//printf( "sock fd = %d\n", soc );
-
-		/* -------------------------------------------------------------------- */
-		/* connect to a server													*/
-		/* -------------------------------------------------------------------- */
-		result = connect( soc, p->ai_addr, p->ai_addrlen );
-		if( result < 0 )
-		{
-			close( soc );
-
-			if( !p->ai_next )
-			{
-				perror( "connect" );
-				freeaddrinfo( res );
-				return( result );
-			}
-			/* ---------------------------------------------------------------- */
-			/* try next server													*/
-			/* ---------------------------------------------------------------- */
-			//printf( "connect:try next\n" );
-			continue;
-		}
-
-		//printf( "connection complete\n" );
-
-		/* -------------------------------------------------------------------- */
-		/* save reconnection information										*/
-		/* -------------------------------------------------------------------- */
-		reconnect_info.ai_family 	= p->ai_family;
-		reconnect_info.ai_socktype	= p->ai_socktype;
-		reconnect_info.ai_protocol	= p->ai_protocol;
-		reconnect_info.ai_addrlen	= p->ai_addrlen;
-
-		memcpy( ( void* )&reconnect_info.ai_addr,
-				( void* )p->ai_addr,
-				sizeof( struct sockaddr ) );
-
-		/* -------------------------------------------------------------------- */
-		/* connection completed													*/
-		/* -------------------------------------------------------------------- */
-		break;
+		snprintf( resolver_cache.hostname, sizeof( resolver_cache.hostname ),
+				  "%s", hostname );
+		snprintf( resolver_cache.port, sizeof( resolver_cache.port ),
+				  "%s", spec_port ? port_num : def_port );
+		resolver_cache.expire	= 0;
+		resolver_cache.n_addr	= 0;
 	}
 
-	freeaddrinfo( res );
+	/* ------------------------------------------------------------------------ */
+	/* resolve and connect on a copy, other connections do not wait for them	*/
+	/* ------------------------------------------------------------------------ */
+	cache = resolver_cache;
 
-	return( soc );
+	pthread_mutex_unlock( &resolver_lock );
+
+	return( raceConnectServer( &cache ) );
 }
 
 /*
@@ -262,30 +187,26 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int reconnectServer( int sock_old )
 {
-	int		result;
-	int		new_soc;
+	struct resolver_cache	cache;
 
-#if 1
+	( void )sock_old;
 
-	new_soc = socket( reconnect_info.ai_family,
-					   reconnect_info.ai_socktype,
-					   reconnect_info.ai_protocol );
-	
-	if( new_soc < 0 )
-	{
-		return( new_soc );
-	}
-	result = connect( new_soc,
-					  &reconnect_info.ai_addr,
-					  reconnect_info.ai_addrlen );
-#endif
-	
-	if( result < 0 )
+	/* ------------------------------------------------------------------------ */
+	/* connect to the server of connectServer again								*/
+	/* ------------------------------------------------------------------------ */
+	pthread_mutex_lock( &resolver_lock );
+
+	if( resolver_cache.hostname[ 0 ] == '\0' )
 	{
-		return( result );
+		pthread_mutex_unlock( &resolver_lock );
+		return( -1 );
 	}
 
-	return( new_soc );
+	cache = resolver_cache;
+
+	pthread_mutex_unlock( &resolver_lock );
+
+	return( raceConnectServer( &cache ) );
 }
 
 /*
@@ -463,6 +384,427 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 */
+/*
+================================================================================
+	Function	:resolveServer
+	Input		:struct resolver_cache *cache
+				 < copy of resolver cache >
+	Output		:struct resolver_cache *cache
+				 < resolved addresses >
+	Return		:int
+				 < status >
+	Description	:resolve addresses of cached server name if they are expired
+				 < ipv6 and ipv4 addresses are interleaved as rfc 8305 >
+================================================================================
+*/
+static int resolveServer( struct resolver_cache *cache )
+{
+	struct addrinfo		hints, *res, *p;
+	struct addrinfo		*family[ 2 ][ DEF_NET_MAX_ADDRESS ];
+	int					n_family[ 2 ];
+	int					result;
+	int					i;
+	int					f;
+	time_t				now;
+
+	now = time( NULL );
+
+	if( ( 0 < cache->n_addr ) && ( now < cache->expire ) )
+	{
+		return( 0 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* get address information													*/
+	/* ------------------------------------------------------------------------ */
+	memset( &hints, 0x00, sizeof( hints ) );
+	hints.ai_family		= AF_UNSPEC;		// AF_INET or AF_INT6
+	hints.ai_socktype	= SOCK_STREAM;
+
+	result = getaddrinfo( cache->hostname, cache->port,
+						  &hints, &res );
+
+	if( result != 0 )
+	{
+		fprintf( stderr, "getaddrinfo: %s\n", gai_strerror( result ) );
+		/* -------------------------------------------------------------------- */
+		/* stale addresses are better than nothing								*/
+		/* -------------------------------------------------------------------- */
+		if( 0 < cache->n_addr )
+		{
+			return( 0 );
+		}
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* split addresses into ipv6 and ipv4										*/
+	/* ------------------------------------------------------------------------ */
+	n_family[ 0 ] = 0;
+	n_family[ 1 ] = 0;
+
+	for( p = res ; p != NULL ; p = p->ai_next )
+	{
+		if( sizeof( struct sockaddr_storage ) < p->ai_addrlen )
+		{
+			continue;
+		}
+
+		f = ( p->ai_family == AF_INET6 ) ? 0 : 1;
+
+		if( n_family[ f ] < DEF_NET_MAX_ADDRESS )
+		{
+			family[ f ][ n_family[ f ]++ ] = p;
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* interleave them beginning with ipv6										*/
+	/* ------------------------------------------------------------------------ */
+	cache->n_addr	= 0;
+	cache->fastest	= 0;
+
+	for( i = 0 ; i < DEF_NET_MAX_ADDRESS ; i++ )
+	{
+		for( f = 0 ; f < 2 ; f++ )
+		{
+			struct server_address	*addr;
+
+			if( ( n_family[ f ] <= i ) ||
+				( DEF_NET_MAX_ADDRESS <= cache->n_addr ) )
+			{
+				continue;
+			}
+
+			p		= family[ f ][ i ];
+			addr	= &cache->addr[ cache->n_addr++ ];
+
+			addr->ai_family		= p->ai_family;
+			addr->ai_socktype	= p->ai_socktype;
+			addr->ai_protocol	= p->ai_protocol;
+			addr->ai_addrlen	= p->ai_addrlen;
+
+			memcpy( ( void* )&addr->ai_addr,
+					( void* )p->ai_addr,
+					p->ai_addrlen );
+		}
+	}
+
+	freeaddrinfo( res );
+
+	cache->expire = now + DEF_NET_DNS_TTL;
+
+	if( cache->n_addr <= 0 )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:raceConnectServer
+	Input		:struct resolver_cache *cache
+				 < copy of resolver cache >
+	Output		:void
+	Return		:int
+				 < socket file descriptor >
+	Description	:connect to cached addresses racing them
+				 < the address won last time starts first, and next address
+				   starts when previous ones do not connect in
+				   DEF_NET_ATTEMPT_DELAY. an address which does not connect
+				   in DEF_NET_ATTEMPT_TIMEOUT is given up >
+================================================================================
+*/
+static int raceConnectServer( struct resolver_cache *cache )
+{
+	struct server_address	*addr;
+	struct pollfd			pfd[ DEF_NET_MAX_ADDRESS ];
+	struct timespec			start;
+	long					begin[ DEF_NET_MAX_ADDRESS ];
+	long					elapsed;
+	int						indx[ DEF_NET_MAX_ADDRESS ];
+	int						order[ DEF_NET_MAX_ADDRESS ];
+	int						n_order;
+	int						n_pending;
+	int						next;
+	int						winner;
+	int						timeout;
+	int						result;
+	int						soc;
+	int						i;
+
+	if( resolveServer( cache ) < 0 )
+	{
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* try the fastest address first											*/
+	/* ------------------------------------------------------------------------ */
+	n_order				= 0;
+	order[ n_order++ ]	= cache->fastest;
+
+	for( i = 0 ; i < cache->n_addr ; i++ )
+	{
+		if( i != cache->fastest )
+		{
+			order[ n_order++ ] = i;
+		}
+	}
+
+	clock_gettime( CLOCK_MONOTONIC, &start );
+
+	soc			= -1;
+	winner		= -1;
+	n_pending	= 0;
+	next		= 0;
+
+	while( ( soc < 0 ) && ( ( next < n_order ) || ( 0 < n_pending ) ) )
+	{
+		/* -------------------------------------------------------------------- */
+		/* start next attempt													*/
+		/* -------------------------------------------------------------------- */
+		if( next < n_order )
+		{
+			addr = &cache->addr[ order[ next ] ];
+
+			pfd[ n_pending ].fd = socket( addr->ai_family,
+										  addr->ai_socktype,
+										  addr->ai_protocol );
+
+			if( 0 <= pfd[ n_pending ].fd )
+			{
+				if( setSocketNonBlocking( pfd[ n_pending ].fd, true ) < 0 )
+				{
+					close( pfd[ n_pending ].fd );
+				}
+				else if( connect( pfd[ n_pending ].fd,
+								  ( struct sockaddr* )&addr->ai_addr,
+								  addr->ai_addrlen ) == 0 )
+				{
+					soc		= pfd[ n_pending ].fd;
+					winner	= order[ next ];
+					break;
+				}
+				else if( errno == EINPROGRESS )
+				{
+					pfd[ n_pending ].events		= POLLOUT;
+					pfd[ n_pending ].revents	= 0;
+					indx[ n_pending ]			= order[ next ];
+					begin[ n_pending ]			= getElapsedMsec( &start );
+					n_pending++;
+				}
+				else
+				{
+					close( pfd[ n_pending ].fd );
+				}
+			}
+
+			next++;
+		}
+
+		if( n_pending == 0 )
+		{
+			continue;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* wait for attempts in flight											*/
+		/* -------------------------------------------------------------------- */
+		elapsed = getElapsedMsec( &start );
+		timeout = DEF_NET_CONNECT_TIMEOUT - elapsed;
+
+		if( timeout <= 0 )
+		{
+			break;
+		}
+
+		if( ( next < n_order ) && ( DEF_NET_ATTEMPT_DELAY < timeout ) )
+		{
+			timeout = DEF_NET_ATTEMPT_DELAY;
+		}
+
+		/* wake up when the oldest attempt times out							*/
+		for( i = 0 ; i < n_pending ; i++ )
+		{
+			if( begin[ i ] + DEF_NET_ATTEMPT_TIMEOUT - elapsed < timeout )
+			{
+				timeout = begin[ i ] + DEF_NET_ATTEMPT_TIMEOUT - elapsed;
+			}
+		}
+
+		if( timeout < 0 )
+		{
+			timeout = 0;
+		}
+
+		if( ( result = poll( pfd, n_pending, timeout ) ) < 0 )
+		{
+			continue;
+		}
+
+		elapsed = getElapsedMsec( &start );
+
+		for( i = 0 ; i < n_pending ; )
+		{
+			if( !pfd[ i ].revents &&
+				( elapsed < begin[ i ] + DEF_NET_ATTEMPT_TIMEOUT ) )
+			{
+				i++;
+				continue;
+			}
+
+			if( pfd[ i ].revents && ( soc < 0 ) &&
+				( finishConnectServer( pfd[ i ].fd ) == 0 ) )
+			{
+				soc		= pfd[ i ].fd;
+				winner	= indx[ i ];
+			}
+			else
+			{
+				close( pfd[ i ].fd );
+			}
+
+			/* remove it from attempts in flight								*/
+			n_pending--;
+			pfd[ i ]	= pfd[ n_pending ];
+			indx[ i ]	= indx[ n_pending ];
+			begin[ i ]	= begin[ n_pending ];
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* give up losers															*/
+	/* ------------------------------------------------------------------------ */
+	for( i = 0 ; i < n_pending ; i++ )
+	{
+		if( pfd[ i ].fd != soc )
+		{
+			close( pfd[ i ].fd );
+		}
+	}
+
+	if( soc < 0 )
+	{
+		/* resolve again at next time											*/
+		cache->expire = 0;
+		perror( "connect" );
+	}
+	else
+	{
+		cache->fastest = winner;
+		setSocketNonBlocking( soc, false );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* keep the result unless server is changed in the meantime					*/
+	/* ------------------------------------------------------------------------ */
+	pthread_mutex_lock( &resolver_lock );
+
+	if( ( strcmp( resolver_cache.hostname, cache->hostname ) == 0 ) &&
+		( strcmp( resolver_cache.port, cache->port ) == 0 ) )
+	{
+		resolver_cache = *cache;
+	}
+
+	pthread_mutex_unlock( &resolver_lock );
+
+	return( soc );
+}
+
+/*
+================================================================================
+	Function	:finishConnectServer
+	Input		:int soc
+				 < socket which connect is in progress >
+	Output		:void
+	Return		:int
+				 < 0:connected -1:failed >
+	Description	:test result of non-blocking connect
+================================================================================
+*/
+static int finishConnectServer( int soc )
+{
+	int			error;
+	socklen_t	len;
+
+	len = sizeof( error );
+
+	if( getsockopt( soc, SOL_SOCKET, SO_ERROR, &error, &len ) < 0 )
+	{
+		return( -1 );
+	}
+
+	if( error != 0 )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:getElapsedMsec
+	Input		:const struct timespec *start
+				 < start time >
+	Output		:void
+	Return		:long
+				 < elapsed time in msec >
+	Description	:get elapsed time from start
+================================================================================
+*/
+static long getElapsedMsec( const struct timespec *start )
+{
+	struct timespec	now;
+
+	clock_gettime( CLOCK_MONOTONIC, &now );
+
+	return( ( now.tv_sec - start->tv_sec ) * 1000
+			+ ( now.tv_nsec - start->tv_nsec ) / 1000000 );
+}
+
+/*
+================================================================================
+	Function	:setSocketNonBlocking
+	Input		:int soc
+				 < socket discriptor >
+				 bool non_block
+				 < true:non-blocking false:blocking >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:switch blocking mode of a socket
+================================================================================
+*/
+static int setSocketNonBlocking( int soc, bool non_block )
+{
+	int		flags;
+
+	if( ( flags = fcntl( soc, F_GETFL, 0 ) ) < 0 )
+	{
+		return( -1 );
+	}
+
+	if( non_block )
+	{
+		flags |= O_NONBLOCK;
+	}
+	else
+	{
+		flags &= ~O_NONBLOCK;
+	}
+
+	if( fcntl( soc, F_SETFL, flags ) < 0 )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
 /*
 ================================================================================
 	Function	:void
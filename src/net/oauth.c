@@ -32,6 +32,13 @@ static void setOauthTimeStamp( char *timestamp, int size );
 static void setOauthNonce( char *nonce, int size );
 static int
 encodePercent( const char *org, char *dst, int size, bool to_big );
+static int writeOauthMessage( struct ssl_session *session,
+							  const char *http_com,
+							  const char *api_grp,
+							  const char *request,
+							  struct req_param *req_param,
+							  int n_param,
+							  bool connection );
 
 /*
 ================================================================================
@@ -509,6 +516,94 @@ int sendOauthMessage( struct ssl_session *session,
 					  struct req_param *req_param,
 					  int n_param,
 					  bool connection )
+{
+	int		corked;
+	int		result;
+
+	if( !session )
+	{
+		logMessage( "invalid arguments\n" );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* store pieces of the request and send it by one write						*/
+	/* ------------------------------------------------------------------------ */
+	if( ( corked = corkSSLSession( session ) ) < 0 )
+	{
+		return( corked );
+	}
+
+	result = writeOauthMessage( session,
+								http_com,
+								api_grp,
+								request,
+								req_param,
+								n_param,
+								connection );
+
+	/* ------------------------------------------------------------------------ */
+	/* send it unless a caller has corked the session before us				*/
+	/* ------------------------------------------------------------------------ */
+	if( corked )
+	{
+		if( uncorkSSLSession( session, ( 0 <= result ) ) < 0 )
+		{
+			return( -1 );
+		}
+	}
+
+	return( result );
+}
+
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:void
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:void
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+================================================================================
+	Function	:writeOauthMessage
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *http_com
+				 < http requet command >
+				 const char *api_grp
+				 < api gropu for requesting >
+				 const char *request
+				 < api of the service >
+				 struct req_param *req_param
+				 < array of parameters of api >
+				 int n_param
+				 < number of array of parameters of api >
+				 bool connection
+				 < true:keep alive false:close >
+	Output		:void
+	Return		:int
+				 < result >
+	Description	:make oauth message and write it to ssl layer
+================================================================================
+*/
+static int writeOauthMessage( struct ssl_session *session,
+							  const char *http_com,
+							  const char *api_grp,
+							  const char *request,
+							  struct req_param *req_param,
+							  int n_param,
+							  bool connection )
 {
 	char	oauth_nonce[ 32 + 1 ],
 			oauth_timestamp[ DEF_TIMESTAMP_SIZE + 1 ],
@@ -1054,6 +1149,17 @@ int sendOauthMessage( struct ssl_session *session,
 		return( -1 );
 	}
 
+	/* send Accept-Encoding, json is compressed well	*/
+	length = snprintf( buffer, sizeof( buffer ),
+					   "%s\r\n", DEF_HTTPH_ACCEPT_ENCODING_GZIP );
+
+	if( sendSSLMessage( session, ( void* )buffer, length ) < 0 )
+	{
+		free( param );
+		free( oauth_signature );
+		return( -1 );
+	}
+
 	/* send Connection									*/
 	if( connection )
 	{
@@ -1064,6 +1170,8 @@ int sendOauthMessage( struct ssl_session *session,
 	{
 		length = snprintf( buffer, sizeof( buffer ),
 						   "%s\r\n", DEF_HTTPH_CONNECTION_CLOSE );
+		/* reconnect at next request										*/
+		session->keep_alive = false;
 	}
 
 	if( sendSSLMessage( session, ( void* )buffer, length ) < 0 )
@@ -1714,24 +1822,6 @@ int sendOauthMessage( struct ssl_session *session,
 	return( 0 );
 }
 
-
-/*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:void
-	Input		:void
-	Output		:void
-	Return		:void
-	Description	:void
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-*/
-
-/*
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-	< Local Functions >
-
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-*/
 /*
 ================================================================================
 	Function	:setOauthTimeStamp
@@ -1775,6 +1865,7 @@ static void setOauthTimeStamp( char *timestamp, int size )
 static void setOauthNonce( char *nonce, int size )
 {
 	static unsigned int count = 0;
+	unsigned int	seq;
 	int		i;
 	
 	for( i = 0 ; i < size ; i++ )
@@ -1784,10 +1875,11 @@ static void setOauthNonce( char *nonce, int size )
 
 	srand( ( int )time( NULL ) );
 
-	//sprintf( nonce, "%ld%d", ( long int )rand( ), count++ );
-	sprintf( nonce, "%016d%016d", ( int )rand( ), count++ );
+	/* sessions may sign requests on different threads at the same time		*/
+	seq = __sync_fetch_and_add( &count, 2 );
 
-	count++;
+	//sprintf( nonce, "%ld%d", ( long int )rand( ), count++ );
+	sprintf( nonce, "%016d%016d", ( int )rand( ), seq );
 }
 /*
 ================================================================================
@@ -1,9 +1,11 @@
 /*******************************************************************************
  File:ssl.c
- Description:Procedures of SSL 3.1
+ Description:Procedures of TLS
 
 *******************************************************************************/
 #include <string.h>
+#include <time.h>
+#include <poll.h>
 #include <pthread.h>
 
 #include "net/ssl.h"
@@ -20,6 +22,7 @@
 
 ================================================================================
 */
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
 static int initSSLThreadMutex( void );
 static void lockSSLThreadMutex( int mode, int type, const char *file, int line );
 static struct CRYPTO_dynlock_value *
@@ -34,6 +37,13 @@ static void
 destroySSLDynamicThreadMutex( struct CRYPTO_dynlock_value *dl,
 							  const char *file,
 							  int line );
+#endif
+static int connectSSLHandle( struct ssl_session *session );
+static int writeSSLMessage( struct ssl_session *session,
+							const unsigned char *message,
+							int size );
+static int waitSSLSocket( struct ssl_session *session, int ssl_result );
+static int storeSSLSession( SSL *ssl, SSL_SESSION *ssl_session );
 #if 0
 static int sslPrf( const unsigned char *secret,
 				   int secret_size,
@@ -53,11 +63,20 @@ static int sslPrf( const unsigned char *secret,
 */
 #define	DEF_SSL_SEND_RETRY			50
 #define	DEF_SSL_RECV_RETRY			50
+#define	DEF_SSL_IO_TIMEOUT			( 30 * 1000 )	// msec
+#define	DEF_SSL_CORK_SIZE			2048
+
+/* ---------------------------------------------------------------------------- */
+/* openssl older than 1.1.0 needs locking callbacks and has no TLS_client_method	*/
+/* ---------------------------------------------------------------------------- */
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+#define	TLS_client_method			SSLv23_client_method
 
 struct CRYPTO_dynlock_value
 {
 	pthread_mutex_t		mutex;
 };
+#endif
 
 /*
 ================================================================================
@@ -67,7 +86,13 @@ struct CRYPTO_dynlock_value
 ================================================================================
 */
 static struct ssl_session	*current;
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
 static pthread_mutex_t		*mutex_locks;
+#endif
+static SSL_CTX				*ssl_context;
+
+static struct ssl_handshake_stat	hs_stat;
+static pthread_mutex_t				hs_stat_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -89,6 +114,7 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int initSSL( void )
 {
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
 	int		result;
 	/* ------------------------------------------------------------------------ */
 	/* register the error strings for libcrypto & libssl						*/
@@ -105,6 +131,47 @@ int initSSL( void )
 	/* register the available ciphers and digests								*/
 	/* ------------------------------------------------------------------------ */
 	SSL_library_init( );
+#else
+	/* ------------------------------------------------------------------------ */
+	/* load error strings, ciphers and digests.									*/
+	/* locking is built in the library, so no callbacks are needed				*/
+	/* ------------------------------------------------------------------------ */
+	if( !OPENSSL_init_ssl( OPENSSL_INIT_LOAD_SSL_STRINGS |
+						   OPENSSL_INIT_LOAD_CRYPTO_STRINGS, NULL ) )
+	{
+		ERR_print_errors_fp( stderr );
+		return( -1 );
+	}
+#endif
+
+	/* ------------------------------------------------------------------------ */
+	/* new context shared by all sessions										*/
+	/* ------------------------------------------------------------------------ */
+	ssl_context = SSL_CTX_new( TLS_client_method( ) );
+
+	if( !ssl_context )
+	{
+		ERR_print_errors_fp( stderr );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* api server accepts tls 1.2 or later										*/
+	/* ------------------------------------------------------------------------ */
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+	SSL_CTX_set_options( ssl_context, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 |
+									  SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 );
+#else
+	SSL_CTX_set_min_proto_version( ssl_context, TLS1_2_VERSION );
+#endif
+
+	/* ------------------------------------------------------------------------ */
+	/* cache client sessions to resume them at reconnection						*/
+	/* ------------------------------------------------------------------------ */
+	SSL_CTX_set_session_cache_mode( ssl_context,
+									SSL_SESS_CACHE_CLIENT |
+									SSL_SESS_CACHE_NO_INTERNAL_STORE );
+	SSL_CTX_sess_set_new_cb( ssl_context, storeSSLSession );
 
 	return( 0 );
 }
@@ -122,45 +189,29 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int openSSLSession( struct ssl_session *session )
 {
-	/* ------------------------------------------------------------------------ */
-	/* new context saying we are a client, and using ssl 2 or 3					*/
-	/* ------------------------------------------------------------------------ */
-	session->ssl_context = SSL_CTX_new( TLSv1_1_client_method( ) );
-
-	if( !session->ssl_context )
-	{
-		ERR_print_errors_fp( stderr );
-		return( -1 );
-	}
-
-	//SSL_CTX_set_options( session->ssl_context, SSL_OP_ALL );
-
-	/* ------------------------------------------------------------------------ */
-	/* create an ssl struct for the session										*/
-	/* ------------------------------------------------------------------------ */
-	session->ssl_handle = SSL_new( session->ssl_context );
-
-	if( !session->ssl_handle )
+	if( !ssl_context )
 	{
-		ERR_print_errors_fp( stderr );
 		return( -1 );
 	}
 
-	session->connect = true;
+	session->ssl_context	= ssl_context;
+	session->ssl_handle		= NULL;
+	session->resume			= NULL;
+	session->cork_buf		= NULL;
+	session->cork_len		= 0;
+	session->cork_size		= 0;
+	session->pend_buf		= NULL;
+	session->pend_len		= 0;
+	session->pend_pos		= 0;
+	session->status_code	= 0;
+	session->connect		= true;
 
-	/* ------------------------------------------------------------------------ */
-	/* set fd																	*/
-	/* ------------------------------------------------------------------------ */
-	if( !SSL_set_fd( session->ssl_handle, session->socket ) )
-	{
-		ERR_print_errors_fp( stderr );
-		return( -1 );
-	}
+	pthread_mutex_init( &session->lock, NULL );
 
 	/* ------------------------------------------------------------------------ */
-	/* connect ssl																*/
+	/* create an ssl struct for the session and connect							*/
 	/* ------------------------------------------------------------------------ */
-	if( SSL_connect( session->ssl_handle ) != 1 )
+	if( connectSSLHandle( session ) < 0 )
 	{
 		ERR_print_errors_fp( stderr );
 		return( -1 );
@@ -187,14 +238,21 @@ void closeSSLSession( struct ssl_session *session )
 	{
 		SSL_shutdown( session->ssl_handle );
 		SSL_free( session->ssl_handle );
+		session->ssl_handle = NULL;
 	}
 
-	if( session->ssl_context )
+	if( session->resume )
 	{
-		SSL_CTX_free( session->ssl_context );
+		SSL_SESSION_free( session->resume );
+		session->resume = NULL;
 	}
 
-	ERR_free_strings( );
+	clearSSLPendingMessage( session );
+
+	/* context is shared, and freed at destroySSLResources						*/
+	session->ssl_context = NULL;
+
+	pthread_mutex_destroy( &session->lock );
 }
 
 /*
@@ -208,6 +266,7 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 void destroySSLResources( void )
 {
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
 	int		i;
 
 	CRYPTO_set_locking_callback( NULL );
@@ -218,6 +277,17 @@ void destroySSLResources( void )
 	}
 
 	free( mutex_locks );
+#endif
+
+	if( ssl_context )
+	{
+		SSL_CTX_free( ssl_context );
+		ssl_context = NULL;
+	}
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+	ERR_free_strings( );
+#endif
 }
 
 /*
@@ -239,11 +309,8 @@ int sendSSLMessage( struct ssl_session *session,
 					const unsigned char *message,
 					int size )
 {
-	int		retry;
-	int		length;
-	int		org_size;
-
-	int i;
+	unsigned char	*cork_buf;
+	int				i;
 
 	for( i = 0 ; i < size ; i++ )
 	{
@@ -260,49 +327,30 @@ int sendSSLMessage( struct ssl_session *session,
 		}
 	}
 
-	org_size = size;
-
-	length = 0;
-	
-	length = SSL_write( session->ssl_handle,
-						( void* )message,
-						size );
-	
-	if( length < 0 )
-	{
-		logMessage( "[SSL:%s]", ERR_reason_error_string( ERR_get_error( ) ) );
-	}
-
-	return( length );
-
-#if 0
 	/* ------------------------------------------------------------------------ */
-	/* send and retry															*/
+	/* corked session stores message to send it at once							*/
 	/* ------------------------------------------------------------------------ */
-	for( retry = 0 ; retry < DEF_SSL_SEND_RETRY ; retry++ )
+	if( session->cork_buf )
 	{
-		length = SSL_write( session->ssl_handle,
-							( void* )&message[ length ],
-							size );
-
-		if( length < 0 )
+		if( session->cork_size < session->cork_len + size )
 		{
-			perror( "send ssl message" );
-
-			return( length );
+			cork_buf = realloc( session->cork_buf,
+								( session->cork_len + size ) * 2 );
+			if( !cork_buf )
+			{
+				return( -1 );
+			}
+			session->cork_buf	= cork_buf;
+			session->cork_size	= ( session->cork_len + size ) * 2;
 		}
 
-		if( size <= length )
-		{
-			return( org_size );
-		}
+		memcpy( session->cork_buf + session->cork_len, message, size );
+		session->cork_len += size;
 
-		size = size - length;
+		return( size );
 	}
-#endif
 
-	/* all retries are failed													*/
-	return( -1 );
+	return( writeSSLMessage( session, message, size ) );
 }
 
 /*
@@ -332,8 +380,33 @@ int recvSSLMessage( struct ssl_session *session,
 
 	org_size	= size;
 	r_indx		= 0;
+	retry		= 0;
+
+	/* ------------------------------------------------------------------------ */
+	/* decoded data of the last response is read before the socket				*/
+	/* ------------------------------------------------------------------------ */
+	if( session->pend_buf )
+	{
+		length = session->pend_len - session->pend_pos;
 
-	for( retry = 0 ; retry < DEF_SSL_RECV_RETRY ; retry++ )
+		if( size < length )
+		{
+			length = size;
+		}
+
+		memcpy( message, session->pend_buf + session->pend_pos, length );
+
+		session->pend_pos	+= length;
+		size				-= length;
+		r_indx				+= length;
+
+		if( session->pend_len <= session->pend_pos )
+		{
+			clearSSLPendingMessage( session );
+		}
+	}
+
+	while( 0 < size )
 	{
 		length = SSL_read( session->ssl_handle,
 						   &message[ r_indx ],
@@ -341,31 +414,34 @@ int recvSSLMessage( struct ssl_session *session,
 
 		if( length < 0 )
 		{
+			/* ---------------------------------------------------------------- */
+			/* socket is not ready, wait for it									*/
+			/* ---------------------------------------------------------------- */
+			if( ( retry++ < DEF_SSL_RECV_RETRY ) &&
+				( waitSSLSocket( session, length ) == 0 ) )
+			{
+				continue;
+			}
+
 			logMessage( "[SSL:%s]", ERR_reason_error_string( ERR_get_error( ) ) );
 			perror( "receive ssl message" );
 
 			return( length );
 		}
-#if 1
 		else if( length == 0 )
 		{
+			/* peer closed the connection									*/
+			session->keep_alive = false;
 			return( length );
 		}
-#endif
 
-		if( size <= length )
-		{
-			return( org_size );
-		}
+		session->last_used = time( NULL );
 
 		size	-= length;
 		r_indx	+= length;
 	}
 
-	logMessage( "recv retry error:%d %d\n", length, size );
-
-	/* failure to receive														*/
-	return( -1 );
+	return( org_size );
 }
 
 /*
@@ -381,6 +457,22 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int isSSLConnected( struct ssl_session *session )
 {
+	/* ------------------------------------------------------------------------ */
+	/* server has announced to close the connection								*/
+	/* ------------------------------------------------------------------------ */
+	if( !session->keep_alive )
+	{
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* server may have closed idle connection silently							*/
+	/* ------------------------------------------------------------------------ */
+	if( DEF_SSL_IDLE_TIMEOUT < ( time( NULL ) - session->last_used ) )
+	{
+		return( -1 );
+	}
+
 	return( isServerConnected( session->socket ) );
 }
 
@@ -397,15 +489,18 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int reopenSSLSession( struct ssl_session *session )
 {
-	if( session->ssl_handle )
-	{
-		//SSL_clear( session->ssl_handle );
-		//SSL_free( session->ssl_handle );
-	}
+	/* data of the old connection is never read								*/
+	clearSSLPendingMessage( session );
 
-	if( session->ssl_context )
+	/* ------------------------------------------------------------------------ */
+	/* discard old handle. peer may be gone, so do not wait for close_notify	*/
+	/* ------------------------------------------------------------------------ */
+	if( session->ssl_handle )
 	{
-		//SSL_CTX_free( session->ssl_context );
+		SSL_set_quiet_shutdown( session->ssl_handle, 1 );
+		SSL_shutdown( session->ssl_handle );
+		SSL_free( session->ssl_handle );
+		session->ssl_handle = NULL;
 	}
 
 	if( session->connect )
@@ -424,18 +519,9 @@ int reopenSSLSession( struct ssl_session *session )
 	session->connect = true;
 
 	/* ------------------------------------------------------------------------ */
-	/* set fd																	*/
+	/* connect ssl with the cached session										*/
 	/* ------------------------------------------------------------------------ */
-	if( !SSL_set_fd( session->ssl_handle, session->socket ) )
-	{
-		logMessage( "cannot set socket fd to ssl\n" );
-		return( -1 );
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* connect ssl																*/
-	/* ------------------------------------------------------------------------ */
-	if( SSL_connect( session->ssl_handle ) != 1 )
+	if( connectSSLHandle( session ) < 0 )
 	{
 		logMessage( "cannot connect ssl\n" );
 		return( -1 );
@@ -482,6 +568,173 @@ struct ssl_session* getCurrentSSLSession( void )
 {
 	return( current );
 }
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:lockSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:take a session to send requests and receive responses over it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void lockSSLSession( struct ssl_session *session )
+{
+	pthread_mutex_lock( &session->lock );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:unlockSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:give back a session taken by lockSSLSession
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void unlockSSLSession( struct ssl_session *session )
+{
+	pthread_mutex_unlock( &session->lock );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:corkSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:int
+				 < 1:corked now 0:already corked -1:error >
+	Description	:store messages of sendSSLMessage instead of sending them
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int corkSSLSession( struct ssl_session *session )
+{
+	if( session->cork_buf )
+	{
+		return( 0 );
+	}
+
+	if( !( session->cork_buf = malloc( DEF_SSL_CORK_SIZE ) ) )
+	{
+		return( -1 );
+	}
+
+	session->cork_len	= 0;
+	session->cork_size	= DEF_SSL_CORK_SIZE;
+
+	return( 1 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:uncorkSSLSession
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 bool flush
+				 < true:send stored messages false:discard them >
+	Output		:void
+	Return		:int
+				 < size of send message >
+	Description	:send stored messages at once and stop storing
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int uncorkSSLSession( struct ssl_session *session, bool flush )
+{
+	unsigned char	*cork_buf;
+	int				cork_len;
+
+	cork_buf	= session->cork_buf;
+	cork_len	= session->cork_len;
+
+	session->cork_buf	= NULL;
+	session->cork_len	= 0;
+	session->cork_size	= 0;
+
+	if( !cork_buf )
+	{
+		return( 0 );
+	}
+
+	if( flush && 0 < cork_len )
+	{
+		cork_len = writeSSLMessage( session, cork_buf, cork_len );
+	}
+
+	free( cork_buf );
+
+	return( cork_len );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setSSLPendingMessage
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 unsigned char *message
+				 < message allocated by malloc. session frees it >
+				 int length
+				 < length of the message >
+	Output		:void
+	Return		:void
+	Description	:let recvSSLMessage read a message before the socket
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setSSLPendingMessage( struct ssl_session *session,
+						   unsigned char *message,
+						   int length )
+{
+	clearSSLPendingMessage( session );
+
+	if( length <= 0 )
+	{
+		free( message );
+		return;
+	}
+
+	session->pend_buf	= message;
+	session->pend_len	= length;
+	session->pend_pos	= 0;
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:clearSSLPendingMessage
+	Input		:struct ssl_session *session
+				 < session of ssl >
+	Output		:void
+	Return		:void
+	Description	:discard a message which is not read by recvSSLMessage yet
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void clearSSLPendingMessage( struct ssl_session *session )
+{
+	free( session->pend_buf );
+
+	session->pend_buf	= NULL;
+	session->pend_len	= 0;
+	session->pend_pos	= 0;
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getSSLHandshakeStat
+	Input		:struct ssl_handshake_stat *stat
+				 < statistics to be stored >
+	Output		:struct ssl_handshake_stat *stat
+				 < numbers of full and resumed handshakes >
+	Return		:void
+	Description	:get statistics of handshakes
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void getSSLHandshakeStat( struct ssl_handshake_stat *stat )
+{
+	pthread_mutex_lock( &hs_stat_lock );
+	*stat = hs_stat;
+	pthread_mutex_unlock( &hs_stat_lock );
+}
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:void
@@ -499,6 +752,202 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 */
 /*
+================================================================================
+	Function	:connectSSLHandle
+	Input		:struct ssl_session *session
+				 < session of ssl to connect >
+	Output		:struct ssl_session *session
+				 < ssl_handle is created and connected >
+	Return		:int
+				 < status >
+	Description	:create a ssl handle on the shared context and do handshake
+				 < offer the cached session to resume it >
+================================================================================
+*/
+static int connectSSLHandle( struct ssl_session *session )
+{
+	session->ssl_handle = SSL_new( session->ssl_context );
+
+	if( !session->ssl_handle )
+	{
+		return( -1 );
+	}
+
+	SSL_set_app_data( session->ssl_handle, session );
+
+	/* ------------------------------------------------------------------------ */
+	/* offer cached session														*/
+	/* ------------------------------------------------------------------------ */
+	if( session->resume )
+	{
+		if( !SSL_set_session( session->ssl_handle, session->resume ) )
+		{
+			SSL_SESSION_free( session->resume );
+			session->resume = NULL;
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* set fd																	*/
+	/* ------------------------------------------------------------------------ */
+	if( !SSL_set_fd( session->ssl_handle, session->socket ) )
+	{
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* connect ssl																*/
+	/* ------------------------------------------------------------------------ */
+	if( SSL_connect( session->ssl_handle ) != 1 )
+	{
+		return( -1 );
+	}
+
+	pthread_mutex_lock( &hs_stat_lock );
+	if( SSL_session_reused( session->ssl_handle ) )
+	{
+		hs_stat.resumed++;
+	}
+	else
+	{
+		hs_stat.full++;
+	}
+	pthread_mutex_unlock( &hs_stat_lock );
+
+	session->keep_alive	= true;
+	session->last_used	= time( NULL );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:writeSSLMessage
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 const unsgined char *message
+				 < message to send >
+				 int size
+				 < size of message >
+	Output		:void
+	Return		:int
+				 < size of send message >
+	Description	:write a message to ssl layer until all of it is sent
+================================================================================
+*/
+static int writeSSLMessage( struct ssl_session *session,
+							const unsigned char *message,
+							int size )
+{
+	int		retry;
+	int		length;
+	int		w_indx;
+
+	w_indx	= 0;
+	retry	= 0;
+
+	while( w_indx < size )
+	{
+		length = SSL_write( session->ssl_handle,
+							( void* )&message[ w_indx ],
+							size - w_indx );
+
+		if( length <= 0 )
+		{
+			if( ( retry++ < DEF_SSL_SEND_RETRY ) &&
+				( waitSSLSocket( session, length ) == 0 ) )
+			{
+				continue;
+			}
+
+			logMessage( "[SSL:%s]", ERR_reason_error_string( ERR_get_error( ) ) );
+			return( -1 );
+		}
+
+		w_indx += length;
+	}
+
+	session->last_used = time( NULL );
+
+	return( size );
+}
+
+/*
+================================================================================
+	Function	:waitSSLSocket
+	Input		:struct ssl_session *session
+				 < session of ssl >
+				 int ssl_result
+				 < result of SSL_read or SSL_write >
+	Output		:void
+	Return		:int
+				 < 0:socket is ready -1:error or timeout >
+	Description	:wait until socket is ready when ssl wants to read or write
+================================================================================
+*/
+static int waitSSLSocket( struct ssl_session *session, int ssl_result )
+{
+	struct pollfd	pfd;
+
+	switch( SSL_get_error( session->ssl_handle, ssl_result ) )
+	{
+	case	SSL_ERROR_WANT_READ:
+		pfd.events = POLLIN;
+		break;
+	case	SSL_ERROR_WANT_WRITE:
+		pfd.events = POLLOUT;
+		break;
+	default:
+		return( -1 );
+	}
+
+	pfd.fd		= session->socket;
+	pfd.revents	= 0;
+
+	if( poll( &pfd, 1, DEF_SSL_IO_TIMEOUT ) <= 0 )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:storeSSLSession
+	Input		:SSL *ssl
+				 < ssl handle which got a new session >
+				 SSL_SESSION *ssl_session
+				 < new session issued by server >
+	Output		:void
+	Return		:int
+				 < 1:we keep the reference of ssl_session >
+	Description	:callback of new session to cache it for resumption
+================================================================================
+*/
+static int storeSSLSession( SSL *ssl, SSL_SESSION *ssl_session )
+{
+	struct ssl_session	*session;
+
+	session = ( struct ssl_session* )SSL_get_app_data( ssl );
+
+	if( !session )
+	{
+		return( 0 );
+	}
+
+	if( session->resume )
+	{
+		SSL_SESSION_free( session->resume );
+	}
+
+	session->resume = ssl_session;
+
+	return( 1 );
+}
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+/*
 ================================================================================
 	Function	:initSSLThreadMutex
 	Input		:void
@@ -701,6 +1150,8 @@ static void getThreadId( CRYPTO_THREADID *id )
 {
 	CRYPTO_THREADID_set_numeric( id, ( unsigned long )pthread_self( ) );
 }
+#endif	// OPENSSL_VERSION_NUMBER < 0x10100000L
+
 /*
 ================================================================================
 	Function	:sslPrf
@@ -1117,10 +1117,7 @@ int postDirectMessagesDestroy( struct ssl_session *session,
 	/* ------------------------------------------------------------------------ */
 	/* receive body																*/
 	/* ------------------------------------------------------------------------ */
-	//recvDiscard( session, &hctx );
-	commonRecvTimeLine( session );
-
-	return( 0 );
+	return( commonRecvTimeLine( session ) );
 }
 
 /*
@@ -2159,9 +2156,7 @@ int postTwapiListsCreateMembers( struct ssl_session *session,
 	/* ------------------------------------------------------------------------ */
 	/* receive body																*/
 	/* ------------------------------------------------------------------------ */
-	commonRecvTimeLine( session );
-
-	return( 0 );
+	return( commonRecvTimeLine( session ) );
 }
 
 /*
@@ -2215,9 +2210,115 @@ int postTwapiListsDestroyMembers( struct ssl_session *session,
 	/* ------------------------------------------------------------------------ */
 	/* receive body																*/
 	/* ------------------------------------------------------------------------ */
-	commonRecvTimeLine( session );
+	return( commonRecvTimeLine( session ) );
+}
 
-	return( 0 );
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:postTwapiListsCreateAllMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *list_id
+				 < id of lists >
+				 const char *slug
+				 < slug of list >
+				 const char *user_ids
+				 < ids of users to add, separated by comma >
+				 const char *screen_names
+				 < screen names of users to add, separated by comma >
+				 const char *owner_screen_name
+				 < screen name of owner >
+				 const char *owner_id
+				 < id of owner >
+	Output		:void
+	Return		:int
+				 < result >
+	Description	:post lists/members/create_all
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int postTwapiListsCreateAllMembers( struct ssl_session *session,
+									const char *list_id,
+									const char *slug,
+									const char *user_ids,
+									const char *screen_names,
+									const char *owner_screen_name,
+									const char *owner_id )
+{
+	int		result;
+
+	result = commonMembersCreateDestroy( DEF_REST_LISTS_MEMS_CREATE_ALL,
+									  session,
+									  list_id,
+									  slug,
+									  user_ids,
+									  screen_names,
+									  owner_screen_name,
+									  owner_id );
+
+	if( result < 0 )
+	{
+		logMessage( "fail to create list members at once\n" );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* receive body																*/
+	/* ------------------------------------------------------------------------ */
+	return( commonRecvTimeLine( session ) );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:postTwapiListsDestroyAllMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *list_id
+				 < id of lists >
+				 const char *slug
+				 < slug of list >
+				 const char *user_ids
+				 < ids of users to remove, separated by comma >
+				 const char *screen_names
+				 < screen names of users to remove, separated by comma >
+				 const char *owner_screen_name
+				 < screen name of owner >
+				 const char *owner_id
+				 < id of owner >
+	Output		:void
+	Return		:int
+				 < result >
+	Description	:post lists/members/destroy_all
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int postTwapiListsDestroyAllMembers( struct ssl_session *session,
+									 const char *list_id,
+									 const char *slug,
+									 const char *user_ids,
+									 const char *screen_names,
+									 const char *owner_screen_name,
+									 const char *owner_id )
+{
+	int		result;
+
+	result = commonMembersCreateDestroy( DEF_REST_LISTS_MEMS_DESTROY_ALL,
+									  session,
+									  list_id,
+									  slug,
+									  user_ids,
+									  screen_names,
+									  owner_screen_name,
+									  owner_id );
+
+	if( result < 0 )
+	{
+		logMessage( "fail to destroy list members at once\n" );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* receive body																*/
+	/* ------------------------------------------------------------------------ */
+	return( commonRecvTimeLine( session ) );
 }
 
 /*
@@ -2263,9 +2364,7 @@ int postTwapiListsCreateSubscribers( struct ssl_session *session,
 	/* ------------------------------------------------------------------------ */
 	/* receive body																*/
 	/* ------------------------------------------------------------------------ */
-	commonRecvTimeLine( session );
-
-	return( 0 );
+	return( commonRecvTimeLine( session ) );
 }
 
 /*
@@ -2311,9 +2410,7 @@ int postTwapiListsDestroySubscribers( struct ssl_session *session,
 	/* ------------------------------------------------------------------------ */
 	/* receive body																*/
 	/* ------------------------------------------------------------------------ */
-	commonRecvTimeLine( session );
-
-	return( 0 );
+	return( commonRecvTimeLine( session ) );
 }
 
 /*
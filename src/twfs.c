@@ -24,6 +24,10 @@
 
 #include "twfs.h"
 #include "twfs_internal.h"
+#include "twfs_ll.h"
+#include "twfs_queue.h"
+#include "twfs_user.h"
+#include "twfs_flush.h"
 #include "twitter_operation.h"
 #include "lib/log.h"
 #include "lib/utils.h"
@@ -60,6 +64,11 @@ static int twfsRead( const char *path,
 					 size_t size,
 					 off_t offset,
 					 struct fuse_file_info *fi );
+static int twfsReadBuffer( const char *path,
+						   struct fuse_bufvec **bufp,
+						   size_t size,
+						   off_t offset,
+						   struct fuse_file_info *fi );
 static int twfsWrite( const char *path,
 					  const char *buf,
 					  size_t size,
@@ -122,6 +131,38 @@ twfsFileGetAttributes( const char *path,
 */
 #define	DEF_LOGICAL_BLOCK_SIZE			512
 
+/* ---------------------------------------------------------------------------- */
+/* kernel cache of twfs. entries of the hierarchy hardly change, but size of	*/
+/* timeline files grows when they are opened so keep attributes short-lived	*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_ENTRY_TIMEOUT			"30"	// sec
+#define	DEF_TWFS_ATTR_TIMEOUT			"3"		// sec
+#define	DEF_TWFS_FUSE_CACHE_OPTS		"entry_timeout=" DEF_TWFS_ENTRY_TIMEOUT	\
+										",attr_timeout=" DEF_TWFS_ATTR_TIMEOUT
+
+/* ---------------------------------------------------------------------------- */
+/* threads serving requests of the kernel, 1:single threaded. fetches from		*/
+/* twitter take the one ssl session in turn, so more threads only keep reads	*/
+/* of files already fetched from waiting behind a fetch							*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_WORKERS				4
+#define	DEF_TWFS_MAX_WORKERS			64
+
+/* ---------------------------------------------------------------------------- */
+/* screen_name, root directory and mount point come first. options of twfs		*/
+/* are taken by name, and the other arguments are passed to fuse				*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_ARGC					4
+#define	DEF_TWFS_OPT_THREADS			"--threads="
+#define	DEF_TWFS_OPT_DURABILITY			"--durability="
+#define	DEF_TWFS_OPT_HIGH_LEVEL			"--high-level"
+
+/* ---------------------------------------------------------------------------- */
+/* size of a write request negotiated at initTwfs. fuse clips it to the size	*/
+/* of its channel buffer														*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_MAX_WRITE				( 128 * 1024 )
+
 
 /*
 ================================================================================
@@ -145,7 +186,34 @@ struct mount_dir
 };
 static struct mount_dir mount_dir;
 static void ( *destroy )( void );
-static struct fuse_operations* getTwfsOperations( void );
+static E_TWFS_DURABILITY twfs_durability = DEF_TWFS_DURABILITY;
+
+/* file opened by twfsOpen or twfsCreate; it is kept in fuse_file_info.fh		*/
+struct twfs_handle
+{
+	E_TWFS_FILE_TYPE	file_type;
+	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
+	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char				r_path[ DEF_TWFS_PATH_MAX ];
+	int					fd;				// -1:not opened as a regular file
+	struct twfs_file	*twfs_file;		// NULL:not opened as a twfs file
+};
+
+static struct twfs_handle* allocTwfsHandle( const char *path );
+static void freeTwfsHandle( struct twfs_handle *handle );
+static int getTwfsHandleFd( const struct twfs_handle *handle );
+static int getTwfsPassThroughFd( const struct twfs_handle *handle );
+static int openTwfsTimeLine( struct twfs_file **twfs_file,
+							 const char *r_path,
+							 const char *screen_name,
+							 E_TWFS_FILE_TYPE file_type,
+							 const char *slug,
+							 const char *owner );
+static int postTwfsTweet( const char *mention, int size );
+static int postTwfsDirectMessage( const char *to, const char *message, int size );
+static const char* getTwfsOption( int argc, char *argv[ ], const char *name );
+static bool isTwfsOption( const char *arg );
 
 /*
 ==================================================================================
@@ -173,6 +241,7 @@ struct fuse_operations twfs_operations =
 	.utime			= twfsUtime,
 	.open			= twfsOpen,
 	.read			= twfsRead,
+	.read_buf		= twfsReadBuffer,
 	.write			= twfsWrite,
 	.statfs			= twfsStatisticsFileSystem,
 	.flush			= twfsFlush,
@@ -247,24 +316,125 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:start twfs
+	Description	:start twfs with low-level api, or with high-level api when
+				 --high-level is given
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int startTwfs( int argc, char *argv[ ] )
 {
-	int		result;
+	int					result;
+	struct fuse_args	args = FUSE_ARGS_INIT( 0, NULL );
 
 	printf( "mount dir : %s\n" , argv[ 3 ] );
 
-	argv[ 1 ] = argv[ 3 ];
-	argv[ 2 ] = argv[ 3 ] = NULL;
-	argc = argc - 2;
+	/* arguments are checked by main already									*/
+	twfs_durability = ( E_TWFS_DURABILITY )getTwfsDurability( argc, argv );
+
+	if( !getTwfsOption( argc, argv, DEF_TWFS_OPT_HIGH_LEVEL ) )
+	{
+		return( startTwfsLowLevel( argc, argv ) );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* high-level api is either single threaded or multi threaded. fuse_main	*/
+	/* of fuse 2 takes no number of threads; fuse_loop_mt starts a thread		*/
+	/* whenever all of them are busy and there is no way to bound it. so		*/
+	/* --threads only chooses -s here, the number itself is honored by the		*/
+	/* low-level frontend alone													*/
+	/* ------------------------------------------------------------------------ */
+	if( getTwfsFuseArgs( argc, argv, &args ) < 0 )
+	{
+		fuse_opt_free_args( &args );
+		return( -1 );
+	}
+
+	/* cache options go before the ones of user so that they can override	*/
+	if( ( fuse_opt_insert_arg( &args, 2, "-o" ) < 0 ) ||
+		( fuse_opt_insert_arg( &args, 3, DEF_TWFS_FUSE_CACHE_OPTS ) < 0 ) )
+	{
+		fuse_opt_free_args( &args );
+		return( -1 );
+	}
+
+	if( ( getTwfsWorkers( argc, argv ) <= 1 ) &&
+		( fuse_opt_add_arg( &args, "-s" ) < 0 ) )
+	{
+		fuse_opt_free_args( &args );
+		return( -1 );
+	}
+
+	result =  fuse_main( args.argc, args.argv, &twfs_operations, NULL );
 
-	result =  fuse_main( argc, argv, &twfs_operations, NULL );
+	fuse_opt_free_args( &args );
 
 	return( result );
 }
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsWorkers
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < number of threads serving requests, -1:not a number >
+	Description	:get number of threads given by --threads=
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsWorkers( int argc, char *argv[ ] )
+{
+	const char	*value;
+	long		workers;
+	char		*end;
+
+	if( !( value = getTwfsOption( argc, argv, DEF_TWFS_OPT_THREADS ) ) )
+	{
+		return( DEF_TWFS_WORKERS );
+	}
+
+	workers = strtol( value, &end, 10 );
+
+	if( ( *value == '\0' ) || ( *end != '\0' ) || ( workers < 1 ) )
+	{
+		return( -1 );
+	}
+
+	if( DEF_TWFS_MAX_WORKERS < workers )
+	{
+		return( DEF_TWFS_MAX_WORKERS );
+	}
+
+	return( ( int )workers );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsDurability
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < E_TWFS_DURABILITY of files written by fetches,
+				   -1:unknown name >
+	Description	:get durability given by --durability=
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsDurability( int argc, char *argv[ ] )
+{
+	const char	*value;
+
+	if( !( value = getTwfsOption( argc, argv, DEF_TWFS_OPT_DURABILITY ) ) )
+	{
+		return( DEF_TWFS_DURABILITY );
+	}
+
+	return( getTwfsDurabilityByName( value ) );
+}
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:getRootAbsPath
@@ -442,45 +612,35 @@ int getMountDirLength( void )
 }
 
 /*
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-	< Local Functions >
-
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-*/
-/*
-==================================================================================
-	Function	:twfsGetAttributes
-	Input		:const char *path
-				 < path to file >
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsAttributes
+	Input		:E_TWFS_FILE_TYPE file_type
+				 < type of file >
+				 const char *sname1
+				 < first screen name in path to file >
+				 const char *r_path
+				 < path to file over root directory >
 				 struct stat *statbuf
 				 < statistics information buffer >
 	Outpu		:struct stat *statbuf
 				 < statistics information buffer >
 	Return		:int
 				 < status >
-	Description	:get file attributes
-==================================================================================
+	Description	:get attributes of a file which is already classified
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
-static int twfsGetAttributes( const char *path, struct stat *statbuf )
+int getTwfsAttributes( E_TWFS_FILE_TYPE file_type,
+					   const char *sname1,
+					   const char *r_path,
+					   struct stat *statbuf )
 {
 	int					result;
 	int					fd;
 	size_t				total_size;
 	int					at_name_len;
-	char				r_path[ DEF_TWFS_PATH_MAX ];
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	E_TWFS_FILE_TYPE	file_type;
 	blkcnt_t	phys_blks;
 	blksize_t	phys_blksize;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
-	
-	getRootAbsPath( r_path, path );
-
 	result = lstat( r_path, statbuf );
 
 	logMessage( "getattr:%s\n", r_path );
@@ -538,19 +698,29 @@ static int twfsGetAttributes( const char *path, struct stat *statbuf )
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		fd = openFile( r_path, O_RDONLY, 0600 );
-
 		logMessage( "file type[%d]\n", file_type );
 
-		if( fd < 0 )
+		/* -------------------------------------------------------------------- */
+		/* read header of the file only if its size is not cached yet			*/
+		/* -------------------------------------------------------------------- */
+		if( getTwfsAttrCache( statbuf, &total_size ) < 0 )
 		{
-			result = -errno;
-			break;
-		}
+			fd = openFile( r_path, O_RDONLY, 0600 );
 
-		if( getTotalSizeOfTlFileFromFd( fd, &total_size ) < 0 )
-		{
-			total_size = 1;
+			if( fd < 0 )
+			{
+				result = -errno;
+				break;
+			}
+
+			if( getTotalSizeOfTlFileFromFd( fd, &total_size ) < 0 )
+			{
+				total_size = 1;
+			}
+
+			closeFile( fd );
+
+			setTwfsAttrCache( statbuf, total_size );
 		}
 
 		if( total_size == 0 )
@@ -559,8 +729,6 @@ static int twfsGetAttributes( const char *path, struct stat *statbuf )
 		}
 		logMessage( "total_size:%zu\n", total_size );
 
-		closeFile( fd );
-
 		statbuf->st_size = total_size;
 		phys_blks = ( statbuf->st_size + ( statbuf->st_blksize - 1 ) )
 					/ statbuf->st_blksize;
@@ -602,6 +770,106 @@ static int twfsGetAttributes( const char *path, struct stat *statbuf )
 	return( result );
 }
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsOperations
+	Input		:void
+	Output		:void
+	Return		:const struct fuse_operations*
+				 < operations of twfs >
+	Description	:get twfs operations
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+const struct fuse_operations* getTwfsOperations( void )
+{
+	return( &twfs_operations );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsFuseArgs
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+				 struct fuse_args *args
+				 < arguments for fuse >
+	Output		:struct fuse_args *args
+				 < program, mount point and options of fuse >
+	Return		:int
+				 < status >
+	Description	:get arguments for fuse. arguments after the mount point are
+				 options of fuse and passed through, except options of twfs.
+				 caller frees args
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsFuseArgs( int argc, char *argv[ ], struct fuse_args *args )
+{
+	int		i;
+
+	if( ( fuse_opt_add_arg( args, argv[ 0 ] ) < 0 ) ||
+		( fuse_opt_add_arg( args, argv[ 3 ] ) < 0 ) )
+	{
+		return( -1 );
+	}
+
+	for( i = DEF_TWFS_ARGC ; i < argc ; i++ )
+	{
+		/* option of twfs itself												*/
+		if( isTwfsOption( argv[ i ] ) )
+		{
+			continue;
+		}
+
+		if( fuse_opt_add_arg( args, argv[ i ] ) < 0 )
+		{
+			return( -1 );
+		}
+	}
+
+	return( 0 );
+}
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+==================================================================================
+	Function	:twfsGetAttributes
+	Input		:const char *path
+				 < path to file >
+				 struct stat *statbuf
+				 < statistics information buffer >
+	Outpu		:struct stat *statbuf
+				 < statistics information buffer >
+	Return		:int
+				 < status >
+	Description	:get file attributes
+==================================================================================
+*/
+static int twfsGetAttributes( const char *path, struct stat *statbuf )
+{
+	char				r_path[ DEF_TWFS_PATH_MAX ];
+	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
+	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	E_TWFS_FILE_TYPE	file_type;
+
+	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
+	
+	getRootAbsPath( r_path, path );
+
+	/* user home is made when something under it is looked up first			*/
+	makeUserHomeOnAccess( path, false );
+
+	return( getTwfsAttributes( file_type, sname1, r_path, statbuf ) );
+}
+
 /*
 ==================================================================================
 	Function	:twfsReadLink
@@ -742,10 +1010,12 @@ static int twfsMakeDirectory( const char *path, mode_t mode )
 							NULL,
 							sname2 );
 #endif
+		lockSSLSession( getCurrentSSLSession( ) );
 		result = makeLists( E_TWFS_REQ_CREATE_LISTS,
 							getCurrentSSLSession( ),
 							sname1,
 							sname2 );
+		unlockSSLSession( getCurrentSSLSession( ) );
 		if( result < 0 )
 		{
 			return( -EACCES );
@@ -790,41 +1060,48 @@ static int twfsUnlink( const char *path )
 	case	E_TWFS_FILE_AUTH_STATUS:
 		logMessage( "auth status file![%s]\n", sname2 );
 		/* sname2 has tweet id which is status file name						*/
-		result = removeTweet( getCurrentSSLSession( ), sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_REMOVE_TWEET,
+									sname2, NULL, NULL, NULL, 0 );
 
 		break;
 	case	E_TWFS_FILE_AUTH_DM_FR_STATUS:
 		logMessage( "auth dm to friends status[%s]\n", sname2 );
 		/* sname2 is saved as direct message at whichTwfsPath					*/
-		result = removeDirectMessage( getCurrentSSLSession( ), sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_REMOVE_DM,
+									sname2, NULL, NULL, NULL, 0 );
 
 		break;
 	case	E_TWFS_DIR_AUTH_FR_FR:
 		if( sname2[ 0 ] != '\0' )
 		{
-			result = requestUnfollow( getCurrentSSLSession( ), sname2 );
+			result = queueTwfsMutation( E_TWFS_MUT_UNFOLLOW,
+										sname2, NULL, NULL, NULL, 0 );
 		}
 		break;
 	case	E_TWFS_FILE_AUTH_FAV_TWEET:
 		logMessage( "auth fav tweet[%s]\n", sname2 );
 		/* sname2 is saved as tweet id at whichTwfsPath							*/
-		result = requestUnFavorite( getCurrentSSLSession( ), sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_UNFAVORITE,
+									sname2, NULL, NULL, NULL, 0 );
 		break;
 	case	E_TWFS_FILE_AUTH_RTW:
 		logMessage( "auth rettweet[%s]\n", sname2 );
 		/* sname2 is saved as tweet id at whichTwfsPath							*/
-		result = removeTweet( getCurrentSSLSession( ), sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_REMOVE_TWEET,
+									sname2, NULL, NULL, NULL, 0 );
 		break;
 	case	E_TWFS_FILE_AUTH_BLOCKS:
 		logMessage( "auth blocks[%s]\n", sname2 );
 		/* sname2 is saved as screen name at whichTwfsPath						*/
-		result = requestUnblock( getCurrentSSLSession( ), sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_UNBLOCK,
+									sname2, NULL, NULL, NULL, 0 );
 		break;
 	case	E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_MEM_SNAME:
-		result = destroyListsMembers( getCurrentSSLSession( ),
-									  sname2,
-									  sname1,
-									  sname3 );
+		result = queueTwfsMutation( E_TWFS_MUT_REMOVE_MEMBER,
+									sname2,
+									sname1,
+									sname3,
+									NULL, 0 );
 		break;
 	case	E_TWFS_DIR_LISTS_SUB_LNAME:
 		result = 0;
@@ -832,19 +1109,22 @@ static int twfsUnlink( const char *path )
 					 getTwapiScreenName( ),
 					 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
 		{
-			result = stopSubscribeLists( getCurrentSSLSession( ),
-										 sname2,
-										 sname1 );
+			result = queueTwfsMutation( E_TWFS_MUT_UNSUBSCRIBE,
+										sname2,
+										sname1,
+										NULL, NULL, 0 );
 		}
 
 		break;
 	default:
 		break;
 	}
-	
+
 	getRootAbsPath( r_path, path );
 
 	logMessage( "unlink:%s\n", r_path );
+
+	invalidateTwfsAttrCache( r_path );
 	
 	result = unlink( r_path );
 	
@@ -884,7 +1164,8 @@ static int twfsRemoveDirectory( const char *path )
 	{
 	case	E_TWFS_DIR_AUTH_LISTS_OWN_LNAME:
 		/* sname2 = slug														*/
-		result = deleteLists( getCurrentSSLSession( ), sname1, sname2 );
+		result = queueTwfsMutation( E_TWFS_MUT_DELETE_LISTS,
+									sname1, sname2, NULL, NULL, 0 );
 		break;
 	default:
 		break;
@@ -987,7 +1268,8 @@ static int twfsSymbolicLink( const char *path, const char *link )
 		{
 			logMessage( "link_sname1:%s\n", link_sname1 );
 			logMessage( "link_sname2:%s\n", link_sname2 );
-			result = requestFollow( getCurrentSSLSession( ), link_sname2 );
+			result = queueTwfsMutation( E_TWFS_MUT_FOLLOW,
+										link_sname2, NULL, NULL, NULL, 0 );
 		}
 		break;
 	case	E_TWFS_FILE_AUTH_FAV_TWEET:
@@ -997,7 +1279,8 @@ static int twfsSymbolicLink( const char *path, const char *link )
 		{
 			logMessage( "link_sname2:%s\n", link_sname2 );
 			/* link_sname2 has teet id at whichTwfsPath							*/
-			result = requestFavorite( getCurrentSSLSession( ), link_sname2 );
+			result = queueTwfsMutation( E_TWFS_MUT_FAVORITE,
+										link_sname2, NULL, NULL, NULL, 0 );
 		}
 		break;
 	//case	E_TWFS_FILE_AUTH_STATUS:
@@ -1013,7 +1296,10 @@ static int twfsSymbolicLink( const char *path, const char *link )
 			/* sname2 has teet id at whichTwfsPath								*/
 			getRootAbsPath( link_r_path, link );
 			//result = retweet( getCurrentSSLSession( ), sname2 );
+			/* retweet makes local files from its response, it is not queued	*/
+			lockSSLSession( getCurrentSSLSession( ) );
 			result = symlinkRetweet( getCurrentSSLSession( ), sname2 );
+			unlockSSLSession( getCurrentSSLSession( ) );
 #if 0
 			if( result < 0 )
 			{
@@ -1028,7 +1314,8 @@ static int twfsSymbolicLink( const char *path, const char *link )
 		//if( symlink_ok )
 		if( file_type == E_TWFS_FILE_FIRST_SNAME )
 		{
-			result = requestBlock( getCurrentSSLSession( ), link_sname2 );
+			result = queueTwfsMutation( E_TWFS_MUT_BLOCK,
+										link_sname2, NULL, NULL, NULL, 0 );
 		}
 		break;
 	case	E_TWFS_DIR_LISTS_SUB_LNAME:
@@ -1039,9 +1326,10 @@ static int twfsSymbolicLink( const char *path, const char *link )
 						 getTwapiScreenName( ),
 						 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
 			{
-				result = subscribeLists( getCurrentSSLSession( ),
-										 link_sname2,
-										 sname1 );
+				result = queueTwfsMutation( E_TWFS_MUT_SUBSCRIBE,
+											link_sname2,
+											sname1,
+											NULL, NULL, 0 );
 			}
 			else
 			{
@@ -1057,10 +1345,11 @@ static int twfsSymbolicLink( const char *path, const char *link )
 						 getTwapiScreenName( ),
 						 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
 			{
-				result = createListsMembers( getCurrentSSLSession( ),
-											 link_sname2,
-											 link_sname1,
-											 sname1 );
+				result = queueTwfsMutation( E_TWFS_MUT_ADD_MEMBER,
+											link_sname2,
+											link_sname1,
+											sname1,
+											NULL, 0 );
 			}
 			
 		}
@@ -1113,6 +1402,9 @@ static int twfsRename( const char *path, const char *newpath )
 	getRootAbsPath( new_r_path, newpath );
 
 	logMessage( "rename:%s %s\n", r_path, new_r_path );
+
+	invalidateTwfsAttrCache( r_path );
+	invalidateTwfsAttrCache( new_r_path );
 	
 	result = rename( r_path, new_r_path );
 	
@@ -1225,6 +1517,8 @@ static int twfsTruncate( const char *path, off_t new_size )
 	getRootAbsPath( r_path, path );
 	
 	logMessage( "truncate:%s %d\n", r_path, new_size );
+
+	invalidateTwfsAttrCache( r_path );
 	
 	result = truncate( r_path, new_size );
 	
@@ -1274,18 +1568,21 @@ static int twfsUtime( const char *path, struct utimbuf *ubuf )
 static int twfsOpen( const char *path, struct fuse_file_info *fi )
 {
 	int					fd;
-	char				r_path[ DEF_TWFS_PATH_MAX ];
 	int					result;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
 	E_TWFS_FILE_TYPE	file_type;
 	struct twfs_file	*twfs_file;
+	struct twfs_handle	*handle;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
+	/* ------------------------------------------------------------------------ */
+	/* classify the path once; read, write and release use the handle			*/
+	/* ------------------------------------------------------------------------ */
+	if( !( handle = allocTwfsHandle( path ) ) )
+	{
+		return( -ENOMEM );
+	}
 
-	getRootAbsPath( r_path, path );
+	file_type	= handle->file_type;
+	result		= 0;
 
 	logMessage( "flags: %o\n", fi->flags );
 	logMessage( "O_ACCMODE:%o\n", O_ACCMODE );
@@ -1307,23 +1604,24 @@ static int twfsOpen( const char *path, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_TL:
 		if( ( fi->flags & O_ACCMODE ) != O_WRONLY )
 		{
-			result = openTwfsTweetFile( &twfs_file,
-										r_path,
-										sname1,
-										file_type,
-										sname2,
-										sname3 );
+			result = openTwfsTimeLine( &twfs_file,
+									   handle->r_path,
+									   handle->sname1,
+									   file_type,
+									   handle->sname2,
+									   handle->sname3 );
 			if( result < 0 )
 			{
-				return( -ENOMEM );
+				result = -ENOMEM;
+				break;
 			}
-			fi->fh = ( unsigned long long )twfs_file;
+			handle->twfs_file = twfs_file;
 		}
 		else
 		{
-			logMessage( "open:%s\n", r_path );
-			fd = openFile( r_path, fi->flags, 0000 );
-			fi->fh = fd;
+			logMessage( "open:%s\n", handle->r_path );
+			fd = openFile( handle->r_path, fi->flags, 0000 );
+			handle->fd = fd;
 		}
 		break;
 	case	E_TWFS_FILE_FL_LIST:
@@ -1355,21 +1653,23 @@ static int twfsOpen( const char *path, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
 		if( ( fi->flags & O_ACCMODE ) != O_WRONLY )
 		{
-			result = openTwfsTweetFile( &twfs_file,
-										r_path,
-										sname1,
-										file_type,
-										sname2,		// for slug
-										sname3 );	// for owner
+			result = openTwfsTimeLine( &twfs_file,
+									   handle->r_path,
+									   handle->sname1,
+									   file_type,
+									   handle->sname2,	// for slug
+									   handle->sname3 );	// for owner
 			if( result < 0 )
 			{
-				return( -ENOMEM );
+				result = -ENOMEM;
+				break;
 			}
-			fi->fh = ( unsigned long long )twfs_file;
+			handle->twfs_file = twfs_file;
 		}
 		else
 		{
-			return( -EACCES );
+			result = -EACCES;
+			break;
 		}
 		break;
 	case	E_TWFS_FILE_TL:
@@ -1381,42 +1681,49 @@ static int twfsOpen( const char *path, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_BLOCKS_LIST:
 	case	E_TWFS_FILE_DOT_BLOCKS_LIST:
 		/* the user does not have the read permission						*/
-		fi->fh = 0;
-		return( -EACCES );
+		result = -EACCES;
+		break;
 	case	E_TWFS_FILE_LISTS_SUB_LNAME_LDESC:
 	case	E_TWFS_FILE_LISTS_OWN_LNAME_LDESC:
 	case	E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_LDESC:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_LDESC:
+		lockSSLSession( getCurrentSSLSession( ) );
 		result = makeLists( E_TWFS_REQ_SHOW_LISTS,
 							getCurrentSSLSession( ),
-							sname1,
-							sname2 );
+							handle->sname1,
+							handle->sname2 );
+		unlockSSLSession( getCurrentSSLSession( ) );
 		if( result < 0 )
 		{
 			result = 0;
 		}
-		logMessage( "open:%s\n", r_path );
-		fd = openFile( r_path, fi->flags, 0000 );
-		fi->fh = fd;
+		logMessage( "open:%s\n", handle->r_path );
+		fd = openFile( handle->r_path, fi->flags, 0000 );
+		handle->fd = fd;
 		if( fd < 0 )
 		{
-			return( -errno );
+			result = -errno;
+			break;
 		}
 		break;
 	
 	case	E_TWFS_FILE_ACC_PROFILE:
 	case	E_TWFS_FILE_AUTH_ACC_PROFILE:
-		result = readProfile( getCurrentSSLSession( ), sname1 );
+		lockSSLSession( getCurrentSSLSession( ) );
+		result = readProfile( getCurrentSSLSession( ), handle->sname1 );
+		unlockSSLSession( getCurrentSSLSession( ) );
 
 		if( result < 0 )
 		{
-			return( -EACCES );
+			result = -EACCES;
+			break;
 		}
-		fd = openFile( r_path, fi->flags, 0000 );
-		fi->fh = fd;
+		fd = openFile( handle->r_path, fi->flags, 0000 );
+		handle->fd = fd;
 		if( fd < 0 )
 		{
-			return( -errno );
+			result = -errno;
+			break;
 		}
 		break;
 
@@ -1428,16 +1735,25 @@ static int twfsOpen( const char *path, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_DM_FR_SEND_TO:
 	case	E_TWFS_FILE_AUTH_DM_FR_SEND_TO:
 	default:
-		logMessage( "open:%s\n", r_path );
-		fd = openFile( r_path, fi->flags, 0000 );
-		fi->fh = fd;
+		logMessage( "open:%s\n", handle->r_path );
+		fd = openFile( handle->r_path, fi->flags, 0000 );
+		handle->fd = fd;
 		if( fd < 0 )
 		{
-			return( -errno );
+			result = -errno;
+			break;
 		}
 		break;
 	}
 
+	if( result < 0 )
+	{
+		freeTwfsHandle( handle );
+		return( result );
+	}
+
+	fi->fh = ( uintptr_t )handle;
+
 	return( 0 );
 }
 
@@ -1469,16 +1785,16 @@ static int twfsRead( const char *path,
 	int					i;
 	int					result;
 	int					sname_len;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	const char			*sname1;
 	E_TWFS_FILE_TYPE	file_type;
 	struct twfs_file	*twfs_file;
 	struct twfs_read	twfs_read;
 	size_t				read_size;
+	struct twfs_handle	*handle;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
+	handle		= ( struct twfs_handle* )( uintptr_t )fi->fh;
+	file_type	= handle->file_type;
+	sname1		= handle->sname1;
 
 	logMessage( "twfsRead:%s [%d]\n", path, file_type );
 
@@ -1525,7 +1841,12 @@ static int twfsRead( const char *path,
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		twfs_file = ( struct twfs_file* )fi->fh;
+		twfs_file = handle->twfs_file;
+
+		/* mapping is shared with other handles, keep it while reading.		*/
+		/* size grows while .list is built in background					*/
+		lockTwfsFile( twfs_file );
+
 		logMessage( "read:twfs_file->size : %lu\n", twfs_file->size );
 		switch( file_type )
 		{
@@ -1558,17 +1879,21 @@ static int twfsRead( const char *path,
 		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
 			if( twfs_file->size < DEF_TWFS_HEAD_FF_LEN )
 			{
+				unlockTwfsFile( twfs_file );
 				return( 0 );
 			}
 			break;
 		default:
 			if( twfs_file->size < DEF_TWFS_HEAD_TL_SIZE_FIELD )
 			{
+				unlockTwfsFile( twfs_file );
 				return( 0 );
 			}
 			break;
 		}
 
+		offset = getTwfsReadOffset( twfs_file, offset );
+
 		result = getTwfsFileOffset( twfs_file, &twfs_read, file_type, offset );
 		logMessage( "twfs_read.twfs_offset : %lu\n", twfs_read.twfs_offset );
 		logMessage( "twfs_read.file_size : %lu\n", twfs_read.file_size );
@@ -1577,16 +1902,32 @@ static int twfsRead( const char *path,
 		{
 			logMessage( "EOF(1)\n" );
 			/* EOF															*/
-			return( 0 );
+			read_size = 0;
+		}
+		else
+		{
+			logMessage( "size : %lu\n", size );
+			logMessage( "offset : %lu\n", offset );
+			read_size = readTimeLineFile( twfs_file,
+										  &twfs_read,
+										  file_type,
+										  buf,
+										  size,
+										  offset );
+		}
+
+		unlockTwfsFile( twfs_file );
+
+		/* reader has gone through the file, get older history in background	*/
+		if( read_size < size )
+		{
+			backfillTwfsTimeLine( twfs_file,
+								  handle->r_path,
+								  sname1,
+								  file_type,
+								  handle->sname2 );
 		}
-		logMessage( "size : %lu\n", size );
-		logMessage( "offset : %lu\n", offset );
-		read_size = readTimeLineFile( twfs_file,
-									  &twfs_read,
-									  file_type,
-									  buf,
-									  size,
-									  offset );
+
 		if( read_size == 0 )
 		{
 			logMessage( "EOF(2)\n" );
@@ -1654,7 +1995,7 @@ static int twfsRead( const char *path,
 	default:
 		logMessage( " pread:\n" );
 		logMessage( " size : %zu offset : %zu\n", size, offset );
-		result = pread( fi->fh, buf, size, offset );
+		result = pread( handle->fd, buf, size, offset );
 		break;
 	}
 
@@ -1663,7 +2004,86 @@ static int twfsRead( const char *path,
 
 /*
 ==================================================================================
-	Function	:twfsWrite
+	Function	:twfsReadBuffer
+	Input		:const char *path
+				 < path to file >
+				 struct fuse_bufvec **bufp
+				 < buffer to be allocated >
+				 size_t size
+				 < size to read >
+				 off_t offset
+				 < read position >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Outpu		:struct fuse_bufvec **bufp
+				 < contents of file or file descriptor to read from >
+	Return		:int
+				 < status >
+	Description	:read a file without copying it if it is served as it is
+==================================================================================
+*/
+static int twfsReadBuffer( const char *path,
+						   struct fuse_bufvec **bufp,
+						   size_t size,
+						   off_t offset,
+						   struct fuse_file_info *fi )
+{
+	int					result;
+	int					fd;
+	char				*mem;
+	struct fuse_bufvec	*bufv;
+
+	if( !( bufv = malloc( sizeof( struct fuse_bufvec ) ) ) )
+	{
+		return( -ENOMEM );
+	}
+
+	*bufv = FUSE_BUFVEC_INIT( size );
+
+	fd = getTwfsPassThroughFd( ( struct twfs_handle* )( uintptr_t )fi->fh );
+
+	/* ------------------------------------------------------------------------ */
+	/* status, profile and description files are backing files as they are,		*/
+	/* so fuse can splice them to the kernel									*/
+	/* ------------------------------------------------------------------------ */
+	if( 0 <= fd )
+	{
+		bufv->buf[ 0 ].flags	= FUSE_BUF_IS_FD | FUSE_BUF_FD_SEEK;
+		bufv->buf[ 0 ].fd		= fd;
+		bufv->buf[ 0 ].pos		= offset;
+
+		*bufp = bufv;
+
+		return( 0 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* contents of timeline files are made up at reading						*/
+	/* ------------------------------------------------------------------------ */
+	if( !( mem = malloc( size ) ) )
+	{
+		free( bufv );
+		return( -ENOMEM );
+	}
+
+	if( ( result = twfsRead( path, mem, size, offset, fi ) ) < 0 )
+	{
+		free( mem );
+		free( bufv );
+		return( result );
+	}
+
+	bufv->buf[ 0 ].mem	= mem;
+	bufv->buf[ 0 ].size	= result;
+
+	*bufp = bufv;
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:twfsWrite
 	Input		:const char *path
 				 < path to file >
 				 const char *buf
@@ -1689,15 +2109,18 @@ static int twfsWrite( const char *path,
 	int					result;
 	int					tweet_len;
 	int					at_name_len;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	const char			*sname1;
+	const char			*sname2;
+	char				dm_sname[ DEF_TWAPI_MAX_SCREEN_NAME_LEN + 1 ];
 	E_TWFS_FILE_TYPE	file_type;
+	struct twfs_handle	*handle;
 
 	result		= size;
-	
-	file_type	= whichTwfsPath( path, sname1, sname2, sname3 );
+
+	handle		= ( struct twfs_handle* )( uintptr_t )fi->fh;
+	file_type	= handle->file_type;
+	sname1		= handle->sname1;
+	sname2		= handle->sname2;
 	
 	switch( file_type )
 	{
@@ -1723,13 +2146,11 @@ static int twfsWrite( const char *path,
 
 		if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < size )
 		{
-			tweetTwapi( getCurrentSSLSession( ),
-						buf,
-						DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+			postTwfsTweet( buf, DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 		}
 		else
 		{
-			tweetTwapi( getCurrentSSLSession( ), buf, size );
+			postTwfsTweet( buf, size );
 		}
 		return( size );
 	/* ------------------------------------------------------------------------ */
@@ -1761,15 +2182,13 @@ static int twfsWrite( const char *path,
 			{
 				char	to_buf[ DEF_REST_ACTUAL_TWEETS_MAX_LEN + 1 ];
 				snprintf( to_buf, sizeof( to_buf ), "@%s %s", sname1, buf );
-				tweetTwapi( getCurrentSSLSession( ),
-							to_buf,
-							DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+				postTwfsTweet( to_buf, DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 			}
 			else
 			{
 				char	to_buf[ DEF_REST_ACTUAL_TWEETS_MAX_LEN + 1 ];
 				snprintf( to_buf, sizeof( to_buf ), "@%s %s", sname1, buf );
-				tweetTwapi( getCurrentSSLSession( ), to_buf, size + at_name_len );
+				postTwfsTweet( to_buf, size + at_name_len );
 			}
 		}
 		else
@@ -1781,15 +2200,11 @@ static int twfsWrite( const char *path,
 			
 			if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < size )
 			{
-				tweetTwapi( getCurrentSSLSession( ),
-							buf,
-							DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+				postTwfsTweet( buf, DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 			}
 			else
 			{
-				tweetTwapi( getCurrentSSLSession( ),
-							buf,
-							size );
+				postTwfsTweet( buf, size );
 			}
 		}
 		return( size );
@@ -1797,7 +2212,9 @@ static int twfsWrite( const char *path,
 	/* [authorized]/direct_message/send_to										*/
 	/* ------------------------------------------------------------------------ */
 	case	E_TWFS_FILE_AUTH_DM_SEND_TO:
-		result = clipTwopeScreenNameFromMsg( buf, sname1 );
+		/* the handle keeps the name of path; clip the name to a local copy	*/
+		memcpy( dm_sname, handle->sname1, sizeof( handle->sname1 ) );
+		result = clipTwopeScreenNameFromMsg( buf, dm_sname );
 		if( result < 0 )
 		{
 			return( size );
@@ -1833,39 +2250,35 @@ static int twfsWrite( const char *path,
 		{
 			return( size );
 		}
-		logMessage( "direct message : %s(%d)\n", sname1, result );
+		logMessage( "direct message : %s(%d)\n", dm_sname, result );
 		if( result != 0 )
 		{
 			if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < ( size - result - 1 ) )
 			{
-				sendDirectMessage( getCurrentSSLSession( ),
-								   sname1,
-								   &buf[ result + 1 ],
-								   DEF_REST_ACTUAL_TWEETS_MAX_LEN - result - 1 );
+				postTwfsDirectMessage( dm_sname,
+									   &buf[ result + 1 ],
+									   DEF_REST_ACTUAL_TWEETS_MAX_LEN - result - 1 );
 			}
 			else
 			{
-				sendDirectMessage( getCurrentSSLSession( ),
-								   sname1,
-								   &buf[ result + 1 ],
-								   size - result - 1 );
+				postTwfsDirectMessage( dm_sname,
+									   &buf[ result + 1 ],
+									   size - result - 1 );
 			}
 		}
 		else
 		{
 			if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < size )
 			{
-				sendDirectMessage( getCurrentSSLSession( ),
-								   sname1,
-								   buf,
-								   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+				postTwfsDirectMessage( dm_sname,
+									   buf,
+									   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 			}
 			else
 			{
-				sendDirectMessage( getCurrentSSLSession( ),
-								   sname1,
-								   buf,
-								   size - 1 );
+				postTwfsDirectMessage( dm_sname,
+									   buf,
+									   size - 1 );
 			}
 		}
 		return( size );
@@ -1891,14 +2304,13 @@ static int twfsWrite( const char *path,
 
 		if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < size )
 		{
-			sendDirectMessage( getCurrentSSLSession( ),
-							   sname2,
-							   buf,
-							   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+			postTwfsDirectMessage( sname2,
+								   buf,
+								   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 		}
 		else
 		{
-			sendDirectMessage( getCurrentSSLSession( ), sname2, buf, size );
+			postTwfsDirectMessage( sname2, buf, size );
 		}
 		return( size );
 	/* ------------------------------------------------------------------------ */
@@ -1924,14 +2336,13 @@ static int twfsWrite( const char *path,
 
 		if( DEF_REST_ACTUAL_TWEETS_MAX_LEN < size )
 		{
-			sendDirectMessage( getCurrentSSLSession( ),
-							   sname1,
-							   buf,
-							   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
+			postTwfsDirectMessage( sname1,
+								   buf,
+								   DEF_REST_ACTUAL_TWEETS_MAX_LEN );
 		}
 		else
 		{
-			sendDirectMessage( getCurrentSSLSession( ), sname1, buf, size );
+			postTwfsDirectMessage( sname1, buf, size );
 		}
 		return( size );
 	case	E_TWFS_FILE_USER_TL:
@@ -1985,7 +2396,7 @@ static int twfsWrite( const char *path,
 		logMessage( "write normal:%d\n", file_type );
 		if( file_type == E_TWFS_FILE_REG )
 		{
-			result = pwrite( fi->fh, buf, size, offset );
+			result = pwrite( handle->fd, buf, size, offset );
 			logMessage( "pwrite(%d)\n", result );
 		}
 		else
@@ -2105,100 +2516,33 @@ static int twfsFlush( const char *path, struct fuse_file_info *fi )
 static int twfsRelease( const char *path, struct fuse_file_info *fi )
 {
 	int					result;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	E_TWFS_FILE_TYPE	file_type;
-	struct twfs_file	*twfs_file;
+	struct twfs_handle	*handle;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
+	handle	= ( struct twfs_handle* )( uintptr_t )fi->fh;
+	result	= 0;
 
-	switch( file_type )
+	if( !handle )
 	{
-	case	E_TWFS_FILE_TL:
-	case	E_TWFS_FILE_AUTH_TL:
-	case	E_TWFS_FILE_AUTH_NOTI_AT_TW:
-	case	E_TWFS_FILE_AUTH_NOTI_RTW:
-	case	E_TWFS_FILE_AUTH_DM_MSG:
-	case	E_TWFS_FILE_AUTH_DM_FR_MSG:
-	case	E_TWFS_FILE_FL_LIST:
-	case	E_TWFS_FILE_FL_DOT_LIST:
-	case	E_TWFS_FILE_FR_LIST:
-	case	E_TWFS_FILE_FR_DOT_LIST:
-	case	E_TWFS_FILE_FAV_LIST:
-	case	E_TWFS_FILE_AUTH_FAV_LIST:
-	case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-	
-	case	E_TWFS_FILE_LISTS_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_TL:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+		return( 0 );
+	}
 
-	case	E_TWFS_FILE_LISTS_OWN_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_TL:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+	/* ------------------------------------------------------------------------ */
+	/* close what twfsOpen or twfsCreate opened									*/
+	/* ------------------------------------------------------------------------ */
+	if( handle->twfs_file )
+	{
+		logMessage( "twfs = %p\n", handle->twfs_file );
+		closeTwfsFile( &handle->twfs_file );
+	}
 
-	case	E_TWFS_FILE_LISTS_ADD_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_TL:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		if( ( fi->flags & O_ACCMODE ) != O_WRONLY )
-		{
-			twfs_file = ( struct twfs_file* )fi->fh;
-			logMessage( "twfs = %d\n", twfs_file );
-			result = closeTwfsFile( &twfs_file );
-		}
-		else
-		{
-			if( fi->fh )
-			{
-				result = closeFile( fi->fh );
-				fi->fh = 0;
-			}
-			else
-			{
-				result = 0;
-			}
-		}
-		return( 0 );
-		break;
-	case	E_TWFS_FILE_TWEET:
-	case	E_TWFS_FILE_AUTH_TWEET:
-	case	E_TWFS_FILE_NOTI_AT_TW:
-	case	E_TWFS_FILE_NOTI_RTW:
-	case	E_TWFS_FILE_DM_SEND_TO:
-	case	E_TWFS_FILE_AUTH_DM_SEND_TO:
-	case	E_TWFS_FILE_DM_FR_SEND_TO:
-	case	E_TWFS_FILE_AUTH_DM_FR_SEND_TO:
-	case	E_TWFS_FILE_BLOCKS_LIST:
-	case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-	default:
-		//result = closeFile( fi->fh );
-#if 1
-		if( fi->fh )
-		{
-			result = closeFile( fi->fh );
-			fi->fh = 0;
-		}
-		else
-		{
-			result = 0;
-		}
-#endif
-		break;
+	if( 0 <= handle->fd )
+	{
+		result = closeFile( handle->fd );
 	}
 
+	freeTwfsHandle( handle );
+	fi->fh = 0;
+
 	logMessage( "release:%s\n", path );
 	
 	return( result );
@@ -2223,15 +2567,18 @@ static int
 twfsFileSync( const char *path, int datasync, struct fuse_file_info *fi )
 {
 	int		result;
+	int		fd;
+
+	fd = getTwfsHandleFd( ( struct twfs_handle* )( uintptr_t )fi->fh );
 	
 	if( datasync )
 	{
-		result = fdatasync( fi->fh );
+		result = fdatasync( fd );
 		logMessage( "fdatasync:%s\n", path );
 	}
 	else
 	{
-		result = fsync( fi->fh );
+		result = fsync( fd );
 		logMessage( "fsync:%s\n", path );
 	}
 	
@@ -2396,6 +2743,8 @@ twfsOpenDirectory( const char *path, struct fuse_file_info *fi )
 	getRootAbsPath( r_path, path );
 
 	logMessage( "opendir:%s\n", r_path );
+
+	makeUserHomeOnAccess( path, true );
 	
 	dp = opendir( r_path );
 	
@@ -2429,7 +2778,7 @@ twfsOpenDirectory( const char *path, struct fuse_file_info *fi )
 	Outpu		:void
 	Return		:int
 				 < status >
-	Description	:read a directory fiel
+	Description	:read entries of a directory from the offset
 ==================================================================================
 */
 static int twfsReadDirectory( const char *path,
@@ -2440,25 +2789,41 @@ static int twfsReadDirectory( const char *path,
 {
 	DIR				*dp;
 	struct dirent	*de;
+	off_t			nextoff;
+	struct stat		statbuf;
 	
 	dp = ( DIR* )( uintptr_t )fi->fh;
 
-	de = readdir( dp );
-	
-	logMessage( "readdir:%s\n", de->d_name );
-	
-	if( !de )
+	/* ------------------------------------------------------------------------ */
+	/* offset is a cookie of telldir. seek back when an entry did not fit in	*/
+	/* the last reply, or when the kernel does not continue from it				*/
+	/* ------------------------------------------------------------------------ */
+	if( offset != telldir( dp ) )
 	{
-		return( -1 );
+		seekdir( dp, offset );
 	}
-	
-	do
+
+	memset( &statbuf, 0x00, sizeof( statbuf ) );
+
+	for( ; ; )
 	{
-		if( filler( buf, de->d_name, NULL, 0 ) != 0 )
+		errno = 0;
+
+		if( !( de = readdir( dp ) ) )
+		{
+			return( -errno );
+		}
+
+		nextoff			= telldir( dp );
+		statbuf.st_ino	= de->d_ino;
+		statbuf.st_mode	= DTTOIF( de->d_type );
+
+		if( filler( buf, de->d_name, &statbuf, nextoff ) != 0 )
 		{
-			return( -ENOMEM );
+			/* reply is full, the entry is read again by next request			*/
+			break;
 		}
-	} while( ( de = readdir( dp ) ) != NULL );
+	}
 	
 	return( 0 );
 }
@@ -2527,6 +2892,69 @@ twfsFileSyncDirectory ( const char *path,
 */
 static void* initTwfs( struct fuse_conn_info *conn )
 {
+	/* ------------------------------------------------------------------------ */
+	/* read timelines in large requests, and ahead while a reader parses them.	*/
+	/* max_readahead is offered by the kernel at its maximum, so it is kept		*/
+	/* ------------------------------------------------------------------------ */
+	if( conn->capable & FUSE_CAP_ASYNC_READ )
+	{
+		conn->want |= FUSE_CAP_ASYNC_READ;
+	}
+
+	if( conn->capable & FUSE_CAP_BIG_WRITES )
+	{
+		conn->want		|= FUSE_CAP_BIG_WRITES;
+		conn->max_write	= DEF_TWFS_MAX_WRITE;
+	}
+
+	/* status files replied as file descriptors are spliced to the kernel		*/
+	if( conn->capable & FUSE_CAP_SPLICE_WRITE )
+	{
+		conn->want |= FUSE_CAP_SPLICE_WRITE | FUSE_CAP_SPLICE_MOVE;
+	}
+
+#ifdef FUSE_CAP_WRITEBACK_CACHE
+	if( conn->capable & FUSE_CAP_WRITEBACK_CACHE )
+	{
+		conn->want |= FUSE_CAP_WRITEBACK_CACHE;
+	}
+#endif
+
+	logMessage( "max_write:%u max_readahead:%u want:0x%x\n",
+				conn->max_write, conn->max_readahead, conn->want );
+
+	/* ------------------------------------------------------------------------ */
+	/* mutations are sent behind the requests, ones left at last mount first	*/
+	/* ------------------------------------------------------------------------ */
+	if( initTwfsQueue( getRootDirPath( ) ) < 0 )
+	{
+		logMessage( "cannot start queue of mutations\n" );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* rate limit of apis can be monitored under root directory				*/
+	/* ------------------------------------------------------------------------ */
+	if( initTwitterRateLimit( getRootDirPath( ) ) < 0 )
+	{
+		logMessage( "cannot open file of rate limit\n" );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* users are known by id over renames of screen name						*/
+	/* ------------------------------------------------------------------------ */
+	if( initTwfsUserDict( getRootDirPath( ) ) < 0 )
+	{
+		logMessage( "cannot open dictionary of users\n" );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* fetches do not wait for disk, files written by them are flushed behind	*/
+	/* ------------------------------------------------------------------------ */
+	if( initTwfsFlusher( twfs_durability ) < 0 )
+	{
+		logMessage( "cannot start flusher of files\n" );
+	}
+
 	return( NULL );
 }
 
@@ -2546,6 +2974,10 @@ static void destroyTwfs( void *userdata )
 	/* ------------------------------------------------------------------------ */
 	/* destroy internals and twfs main resource									*/
 	/* ------------------------------------------------------------------------ */
+	destroyTwfsQueue( );
+	destroyTwitterRateLimit( );
+	destroyTwfsUserDict( );
+	destroyTwfsFlusher( );
 	destroyTwfsInternal( );
 
 	destroy( );
@@ -2602,20 +3034,20 @@ static int
 twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 {
 	int					fd;
-	char				r_path[ DEF_TWFS_PATH_MAX ];
 	int					result;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
 	E_TWFS_FILE_TYPE	file_type;
 	struct twfs_file	*twfs_file;
+	struct twfs_handle	*handle;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
-	
-	getRootAbsPath( r_path, path );
+	if( !( handle = allocTwfsHandle( path ) ) )
+	{
+		return( -ENOMEM );
+	}
+
+	file_type	= handle->file_type;
+	result		= 0;
 
-	logMessage( "create:%s %o\n", r_path, mode );
+	logMessage( "create:%s %o\n", handle->r_path, mode );
 	logMessage( "flags:%X\n", fi->flags );
 
 	switch( file_type )
@@ -2635,21 +3067,22 @@ twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_TL:
 		if( ( fi->flags & O_RDONLY ) != O_WRONLY )
 		{
-			result = openTwfsTweetFile( &twfs_file,
-										r_path,
-										sname1,
-										file_type,
-										NULL,
-										NULL );
+			result = openTwfsTimeLine( &twfs_file,
+									   handle->r_path,
+									   handle->sname1,
+									   file_type,
+									   NULL,
+									   NULL );
 			if( result < 0 )
 			{
-				return( result );
+				break;
 			}
-			fi->fh = ( unsigned long long )twfs_file;
+			handle->twfs_file = twfs_file;
 		}
 		else
 		{
-			return( -EACCES );
+			result = -EACCES;
+			break;
 		}
 		break;
 	case	E_TWFS_FILE_FL_LIST:
@@ -2681,21 +3114,23 @@ twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
 		if( ( fi->flags & O_RDONLY ) != O_WRONLY )
 		{
-			result = openTwfsTweetFile( &twfs_file,
-										r_path,
-										sname1,
-										file_type,
-										sname2,		// for slug
-										sname3 );	// for owner
+			result = openTwfsTimeLine( &twfs_file,
+									   handle->r_path,
+									   handle->sname1,
+									   file_type,
+									   handle->sname2,	// for slug
+									   handle->sname3 );	// for owner
 			if( result < 0 )
 			{
-				return( -ENOMEM );
+				result = -ENOMEM;
+				break;
 			}
-			fi->fh = ( unsigned long long )twfs_file;
+			handle->twfs_file = twfs_file;
 		}
 		else
 		{
-			return( -EACCES );
+			result = -EACCES;
+			break;
 		}
 		break;
 	case	E_TWFS_FILE_TL:
@@ -2706,8 +3141,8 @@ twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_NOTI_RTW:
 	case	E_TWFS_FILE_BLOCKS_LIST:
 	case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-		fi->fh = 0;
-		return( -EACCES );
+		result = -EACCES;
+		break;
 	case	E_TWFS_FILE_TWEET:
 	case	E_TWFS_FILE_AUTH_TWEET:
 	case	E_TWFS_FILE_DM_SEND_TO:
@@ -2718,17 +3153,25 @@ twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 	case	E_TWFS_FILE_LISTS_OWN_LNAME_LDESC:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_LDESC:
 	default:
-		fd = creat( r_path, mode );
+		fd = creat( handle->r_path, mode );
 
-		fi->fh = fd;
+		handle->fd = fd;
 
 		if( fd < 0 )
 		{
-			return( -errno );
+			result = -errno;
+			break;
 		}
 		break;
 	}
 
+	if( result < 0 )
+	{
+		freeTwfsHandle( handle );
+		return( result );
+	}
+
+	fi->fh = ( uintptr_t )handle;
 
 	return( 0 );
 }
@@ -2750,11 +3193,16 @@ twfsCreate( const char *path, mode_t mode, struct fuse_file_info *fi )
 static int
 twfsFileTruncate( const char *path, off_t offset, struct fuse_file_info *fi )
 {
-	int		result;
+	int					result;
+	struct twfs_handle	*handle;
+
+	handle = ( struct twfs_handle* )( uintptr_t )fi->fh;
 
 	logMessage( "ftruncate:%s\n", path );
+
+	invalidateTwfsAttrCache( handle->r_path );
 	
-	result = ftruncate( fi->fh, offset );
+	result = ftruncate( getTwfsHandleFd( handle ), offset );
 	
 	return( result );
 }
@@ -2780,17 +3228,17 @@ twfsFileGetAttributes( const char *path,
 					   struct fuse_file_info *fi )
 {
 	int					result;
-	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	//char				sname2[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
-	char				sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
-	char				sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	const char			*sname1;
 	E_TWFS_FILE_TYPE	file_type;
+	struct twfs_handle	*handle;
 	struct twfs_file	*twfs_file;
 	size_t				total_size;
 	blkcnt_t			phys_blks;
 	blksize_t			phys_blksize;
 
-	file_type = whichTwfsPath( path, sname1, sname2, sname3 );
+	handle		= ( struct twfs_handle* )( uintptr_t )fi->fh;
+	file_type	= handle->file_type;
+	sname1		= handle->sname1;
 
 	logMessage( "fstat:%s\n", path );
 
@@ -2842,7 +3290,7 @@ twfsFileGetAttributes( const char *path,
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		twfs_file = ( struct twfs_file* )fi->fh;
+		twfs_file = handle->twfs_file;
 
 		result = fstat( twfs_file->fd, statbuf );
 
@@ -2884,7 +3332,7 @@ twfsFileGetAttributes( const char *path,
 	case	E_TWFS_FILE_AUTH_DM_SEND_TO:
 	case	E_TWFS_FILE_DM_FR_SEND_TO:
 	case	E_TWFS_FILE_AUTH_DM_FR_SEND_TO:
-		result = fstat( fi->fh, statbuf );
+		result = fstat( handle->fd, statbuf );
 		if( ( fi->flags & O_ACCMODE ) == O_WRONLY )
 		{
 			statbuf->st_size	= 1;
@@ -2909,11 +3357,11 @@ twfsFileGetAttributes( const char *path,
 		logMessage( "st_blksize : %zu\n", statbuf->st_blksize );
 		break;
 	case	E_TWFS_FILE_AUTH_TWEET:
-		result = fstat( fi->fh, statbuf );
+		result = fstat( handle->fd, statbuf );
 		statbuf->st_size = 0;
 		break;
 	default:
-		result = fstat( fi->fh, statbuf );
+		result = fstat( handle->fd, statbuf );
 		if( result < 0 )
 		{
 			result = -errno;
@@ -2932,17 +3380,262 @@ twfsFileGetAttributes( const char *path,
 
 /*
 ================================================================================
-	Function	:getTwfsOperations
-	Input		:void
+	Function	:allocTwfsHandle
+	Input		:const char *path
+				 < path to file >
 	Output		:void
-	Return		:struct fuse_operations*
-				 < operations of twfs >
-	Description	:get twfs operations
+	Return		:struct twfs_handle*
+				 < handle of file, NULL:no memory >
+	Description	:allocate a handle and classify the path for it
 ================================================================================
 */
-static struct fuse_operations* getTwfsOperations( void )
+static struct twfs_handle* allocTwfsHandle( const char *path )
 {
-	return( &twfs_operations );
+	struct twfs_handle	*handle;
+
+	if( !( handle = malloc( sizeof( struct twfs_handle ) ) ) )
+	{
+		return( NULL );
+	}
+
+	handle->file_type	= whichTwfsPath( path,
+										 handle->sname1,
+										 handle->sname2,
+										 handle->sname3 );
+	handle->fd			= -1;
+	handle->twfs_file	= NULL;
+
+	getRootAbsPath( handle->r_path, path );
+
+	return( handle );
+}
+
+/*
+================================================================================
+	Function	:freeTwfsHandle
+	Input		:struct twfs_handle *handle
+				 < handle of file >
+	Output		:void
+	Return		:void
+	Description	:free a handle. files of the handle must be closed before
+================================================================================
+*/
+static void freeTwfsHandle( struct twfs_handle *handle )
+{
+	free( handle );
+}
+
+/*
+================================================================================
+	Function	:getTwfsHandleFd
+	Input		:const struct twfs_handle *handle
+				 < handle of file >
+	Output		:void
+	Return		:int
+				 < file descriptor of the handle >
+	Description	:get file descriptor of regular file or twfs file
+================================================================================
+*/
+static int getTwfsHandleFd( const struct twfs_handle *handle )
+{
+	if( !handle )
+	{
+		return( -1 );
+	}
+
+	if( handle->twfs_file )
+	{
+		return( handle->twfs_file->fd );
+	}
+
+	return( handle->fd );
+}
+
+/*
+================================================================================
+	Function	:getTwfsPassThroughFd
+	Input		:const struct twfs_handle *handle
+				 < handle of file >
+	Output		:void
+	Return		:int
+				 < file descriptor, -1:contents are made by twfsRead >
+	Description	:get file descriptor of a file whose contents are its backing
+				 file as it is
+================================================================================
+*/
+static int getTwfsPassThroughFd( const struct twfs_handle *handle )
+{
+	if( !handle || handle->twfs_file )
+	{
+		return( -1 );
+	}
+
+	switch( handle->file_type )
+	{
+	case	E_TWFS_FILE_TWEET:
+	case	E_TWFS_FILE_TL:
+	case	E_TWFS_FILE_AUTH_TWEET:
+	case	E_TWFS_FILE_NOTI_AT_TW:
+	case	E_TWFS_FILE_NOTI_RTW:
+	case	E_TWFS_FILE_DM_MSG:
+	case	E_TWFS_FILE_DM_FR_MSG:
+	case	E_TWFS_FILE_DM_FR_STATUS:
+	case	E_TWFS_FILE_BLOCKS_LIST:
+	case	E_TWFS_FILE_DOT_BLOCKS_LIST:
+		return( -1 );
+	default:
+		return( handle->fd );
+	}
+}
+
+/*
+================================================================================
+	Function	:openTwfsTimeLine
+	Input		:struct twfs_file **twfs_file
+				 < twfs file to open >
+				 const char *r_path
+				 < path to file over root directory >
+				 const char *screen_name
+				 < screen name in path to file >
+				 E_TWFS_FILE_TYPE file_type
+				 < type of file >
+				 const char *slug
+				 < slug of lists >
+				 const char *owner
+				 < owner of lists >
+	Output		:struct twfs_file **twfs_file
+				 < opened twfs file >
+	Return		:int
+				 < status >
+	Description	:open a timeline or list file and bring it up to date.
+				 the session is held while the file is updated, so the same
+				 file is not updated by two opens at once
+================================================================================
+*/
+static int openTwfsTimeLine( struct twfs_file **twfs_file,
+							 const char *r_path,
+							 const char *screen_name,
+							 E_TWFS_FILE_TYPE file_type,
+							 const char *slug,
+							 const char *owner )
+{
+	int		result;
+
+	lockSSLSession( getCurrentSSLSession( ) );
+
+	result = openTwfsTweetFile( twfs_file,
+								r_path,
+								screen_name,
+								file_type,
+								slug,
+								owner );
+
+	unlockSSLSession( getCurrentSSLSession( ) );
+
+	return( result );
+}
+
+/*
+================================================================================
+	Function	:postTwfsTweet
+	Input		:const char *mention
+				 < tweet to post >
+				 int size
+				 < size of tweet >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:queue a tweet to post. it is posted after write returns
+================================================================================
+*/
+static int postTwfsTweet( const char *mention, int size )
+{
+	return( queueTwfsMutation( E_TWFS_MUT_TWEET,
+							   NULL, NULL, NULL,
+							   mention, size ) );
+}
+
+/*
+================================================================================
+	Function	:postTwfsDirectMessage
+	Input		:const char *to
+				 < screen name to send to >
+				 const char *message
+				 < message to send >
+				 int size
+				 < size of message >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:queue a direct message to send. it is sent after write returns
+================================================================================
+*/
+static int postTwfsDirectMessage( const char *to, const char *message, int size )
+{
+	return( queueTwfsMutation( E_TWFS_MUT_DM,
+							   to, NULL, NULL,
+							   message, size ) );
+}
+
+/*
+================================================================================
+	Function	:getTwfsOption
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+				 const char *name
+				 < name of option, ending with '=' when it takes a value >
+	Output		:void
+	Return		:const char*
+				 < value of the option, "" for a flag. NULL:not given >
+	Description	:find an option of twfs after the mount point. the last one
+				 given wins
+================================================================================
+*/
+static const char* getTwfsOption( int argc, char *argv[ ], const char *name )
+{
+	const char	*value;
+	size_t		len;
+	int			i;
+
+	value	= NULL;
+	len		= strlen( name );
+
+	for( i = DEF_TWFS_ARGC ; i < argc ; i++ )
+	{
+		if( strncmp( argv[ i ], name, len ) != 0 )
+		{
+			continue;
+		}
+
+		if( ( name[ len - 1 ] == '=' ) || ( argv[ i ][ len ] == '\0' ) )
+		{
+			value = argv[ i ] + len;
+		}
+	}
+
+	return( value );
+}
+
+/*
+================================================================================
+	Function	:isTwfsOption
+	Input		:const char *arg
+				 < an argument after the mount point >
+	Output		:void
+	Return		:bool
+				 < true:option of twfs, false:option of fuse >
+	Description	:tell options of twfs from the ones passed to fuse
+================================================================================
+*/
+static bool isTwfsOption( const char *arg )
+{
+	return( ( strncmp( arg, DEF_TWFS_OPT_THREADS,
+					   sizeof( DEF_TWFS_OPT_THREADS ) - 1 ) == 0 ) ||
+			( strncmp( arg, DEF_TWFS_OPT_DURABILITY,
+					   sizeof( DEF_TWFS_OPT_DURABILITY ) - 1 ) == 0 ) ||
+			( strcmp( arg, DEF_TWFS_OPT_HIGH_LEVEL ) == 0 ) );
 }
 
 /*
@@ -0,0 +1,409 @@
+/*******************************************************************************
+ File:twfs_flush.c
+ Description:Flusher of files written by fetches
+
+ fetches queue ranges they have written and return without waiting for disk.
+ flusher starts writeback of every queued range first, and then waits for
+ them by fdatasync, so files written together go to disk together.
+*******************************************************************************/
+#define	_GNU_SOURCE		// sync_file_range
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "twfs.h"
+#include "twfs_flush.h"
+#include "lib/log.h"
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+struct twfs_flush_file;
+
+static void* runTwfsFlusher( void *arg );
+static void flushTwfsFiles( struct twfs_flush_file *files );
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+/* range of a file waiting to be flushed										*/
+struct twfs_flush_file
+{
+	struct twfs_flush_file	*next;
+	dev_t					dev;
+	ino_t					ino;
+	int						fd;			// own descriptor of the file
+	off_t					offset;
+	off_t					end;
+};
+
+struct twfs_flusher
+{
+	pthread_mutex_t			lock;		// protects all members below
+	pthread_cond_t			cond;		// signaled when queued or stopped
+	pthread_t				thread;
+	bool					running;
+	bool					stop;
+	E_TWFS_DURABILITY		durability;
+	struct twfs_flush_file	*head;
+};
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+static struct twfs_flusher twfs_flusher =
+{
+	.lock		= PTHREAD_MUTEX_INITIALIZER,
+	.cond		= PTHREAD_COND_INITIALIZER,
+	.durability	= DEF_TWFS_DURABILITY,
+};
+
+static const char *twfs_durability_names[ E_TWFS_DURABILITY_NUM ] =
+{
+	[ E_TWFS_DURABILITY_NONE ]		= "none",
+	[ E_TWFS_DURABILITY_PERIODIC ]	= "periodic",
+	[ E_TWFS_DURABILITY_GROUP ]		= "group",
+};
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsDurabilityByName
+	Input		:const char *name
+				 < none, periodic or group >
+	Output		:void
+	Return		:int
+				 < E_TWFS_DURABILITY, -1:unknown name >
+	Description	:get durability by its name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsDurabilityByName( const char *name )
+{
+	int		durability;
+
+	for( durability = 0 ; durability < E_TWFS_DURABILITY_NUM ; durability++ )
+	{
+		if( strcmp( twfs_durability_names[ durability ], name ) == 0 )
+		{
+			return( durability );
+		}
+	}
+
+	return( -1 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsFlusher
+	Input		:E_TWFS_DURABILITY durability
+				 < durability of files >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:start to flush files in background by the durability
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsFlusher( E_TWFS_DURABILITY durability )
+{
+	if( twfs_flusher.running )
+	{
+		return( 0 );
+	}
+
+	twfs_flusher.durability	= durability;
+	twfs_flusher.head		= NULL;
+	twfs_flusher.stop		= false;
+
+	logMessage( "durability:%s\n", twfs_durability_names[ durability ] );
+
+	/* ------------------------------------------------------------------------ */
+	/* files are left to kernel, nothing is queued								*/
+	/* ------------------------------------------------------------------------ */
+	if( durability == E_TWFS_DURABILITY_NONE )
+	{
+		return( 0 );
+	}
+
+	if( pthread_create( &twfs_flusher.thread, NULL, runTwfsFlusher, NULL ) != 0 )
+	{
+		return( -1 );
+	}
+
+	twfs_flusher.running = true;
+
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsFlusher
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:flush files queued so far and stop flusher
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsFlusher( void )
+{
+	if( !twfs_flusher.running )
+	{
+		return;
+	}
+
+	pthread_mutex_lock( &twfs_flusher.lock );
+	twfs_flusher.stop = true;
+	pthread_cond_broadcast( &twfs_flusher.cond );
+	pthread_mutex_unlock( &twfs_flusher.lock );
+
+	pthread_join( twfs_flusher.thread, NULL );
+
+	twfs_flusher.running = false;
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:queueTwfsFlush
+	Input		:int fd
+				 < file written by a fetch >
+				 off_t offset
+				 < offset of written range >
+				 size_t len
+				 < length of written range >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:queue a written range of a file to flusher. ranges of a file
+				 queued before it is flushed are merged when they overlap
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int queueTwfsFlush( int fd, off_t offset, size_t len )
+{
+	struct twfs_flush_file	*file;
+	struct stat				statbuf;
+
+	if( !twfs_flusher.running || ( len == 0 ) )
+	{
+		return( 0 );
+	}
+
+	if( fstat( fd, &statbuf ) < 0 )
+	{
+		return( -1 );
+	}
+
+	pthread_mutex_lock( &twfs_flusher.lock );
+
+	/* ------------------------------------------------------------------------ */
+	/* range waiting already overlaps or touches the new one. header and		*/
+	/* appended records of a file are kept apart, records between them are		*/
+	/* not written																*/
+	/* ------------------------------------------------------------------------ */
+	for( file = twfs_flusher.head ; file ; file = file->next )
+	{
+		if( ( file->dev == statbuf.st_dev ) &&
+			( file->ino == statbuf.st_ino ) &&
+			( offset <= file->end ) &&
+			( file->offset <= ( off_t )( offset + len ) ) )
+		{
+			if( offset < file->offset )
+			{
+				file->offset = offset;
+			}
+
+			if( file->end < ( off_t )( offset + len ) )
+			{
+				file->end = offset + len;
+			}
+
+			pthread_mutex_unlock( &twfs_flusher.lock );
+			return( 0 );
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* flusher has own descriptor, the file may be closed before it is flushed	*/
+	/* ------------------------------------------------------------------------ */
+	if( !( file = malloc( sizeof( struct twfs_flush_file ) ) ) )
+	{
+		pthread_mutex_unlock( &twfs_flusher.lock );
+		return( -1 );
+	}
+
+	if( ( file->fd = dup( fd ) ) < 0 )
+	{
+		pthread_mutex_unlock( &twfs_flusher.lock );
+		free( file );
+		return( -1 );
+	}
+
+	file->dev			= statbuf.st_dev;
+	file->ino			= statbuf.st_ino;
+	file->offset		= offset;
+	file->end			= offset + len;
+	file->next			= twfs_flusher.head;
+	twfs_flusher.head	= file;
+
+	pthread_cond_signal( &twfs_flusher.cond );
+
+	pthread_mutex_unlock( &twfs_flusher.lock );
+
+	return( 0 );
+}
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+================================================================================
+	Function	:runTwfsFlusher
+	Input		:void *arg
+				 < not used >
+	Output		:void
+	Return		:void*
+				 < NULL >
+	Description	:flush queued files at once when the interval or the window
+				 of group commit passes after the first of them is queued
+================================================================================
+*/
+static void* runTwfsFlusher( void *arg )
+{
+	struct twfs_flush_file	*files;
+	struct timespec			deadline;
+	bool					stop;
+
+	pthread_mutex_lock( &twfs_flusher.lock );
+
+	for( ; ; )
+	{
+		while( !twfs_flusher.head && !twfs_flusher.stop )
+		{
+			pthread_cond_wait( &twfs_flusher.cond, &twfs_flusher.lock );
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* gather files written until deadline										*/
+		/* -------------------------------------------------------------------- */
+		clock_gettime( CLOCK_REALTIME, &deadline );
+
+		if( twfs_flusher.durability == E_TWFS_DURABILITY_PERIODIC )
+		{
+			deadline.tv_sec += DEF_TWFS_FLUSH_INTERVAL;
+		}
+		else
+		{
+			deadline.tv_nsec += DEF_TWFS_FLUSH_WINDOW * 1000000L;
+
+			if( 1000000000L <= deadline.tv_nsec )
+			{
+				deadline.tv_sec++;
+				deadline.tv_nsec -= 1000000000L;
+			}
+		}
+
+		while( !twfs_flusher.stop )
+		{
+			if( pthread_cond_timedwait( &twfs_flusher.cond,
+										&twfs_flusher.lock,
+										&deadline ) == ETIMEDOUT )
+			{
+				break;
+			}
+		}
+
+		files				= twfs_flusher.head;
+		twfs_flusher.head	= NULL;
+		stop				= twfs_flusher.stop;
+
+		pthread_mutex_unlock( &twfs_flusher.lock );
+
+		flushTwfsFiles( files );
+
+		pthread_mutex_lock( &twfs_flusher.lock );
+
+		if( stop && !twfs_flusher.head )
+		{
+			break;
+		}
+	}
+
+	pthread_mutex_unlock( &twfs_flusher.lock );
+
+	return( NULL );
+}
+
+/*
+================================================================================
+	Function	:flushTwfsFiles
+	Input		:struct twfs_flush_file *files
+				 < files to flush >
+	Output		:void
+	Return		:void
+	Description	:start writeback of all ranges, and then wait for each file.
+				 files are freed
+================================================================================
+*/
+static void flushTwfsFiles( struct twfs_flush_file *files )
+{
+	struct twfs_flush_file	*file;
+	struct twfs_flush_file	*later;
+
+	for( file = files ; file ; file = file->next )
+	{
+		sync_file_range( file->fd,
+						 file->offset,
+						 file->end - file->offset,
+						 SYNC_FILE_RANGE_WRITE );
+	}
+
+	while( ( file = files ) )
+	{
+		files = file->next;
+
+		/* a file with several ranges is waited for once at its last range	*/
+		for( later = files ; later ; later = later->next )
+		{
+			if( ( later->dev == file->dev ) && ( later->ino == file->ino ) )
+			{
+				break;
+			}
+		}
+
+		if( !later && ( fdatasync( file->fd ) < 0 ) )
+		{
+			logMessage( "cannot flush file:%s\n", strerror( errno ) );
+		}
+
+		close( file->fd );
+		free( file );
+	}
+}
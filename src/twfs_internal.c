@@ -3,16 +3,21 @@
  Description:Operations of twfs internal
 
 *******************************************************************************/
+#define	_GNU_SOURCE		// mremap
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <pthread.h>
 #include <limits.h>
+#include <time.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/xattr.h>
 
 #include <unistd.h>
 #include <fcntl.h>
@@ -24,6 +29,8 @@
 #include "twfs.h"
 #include "twitter_operation.h"
 #include "twfs_internal.h"
+#include "twfs_user.h"
+#include "twfs_flush.h"
 #include "lib/utils.h"
 #include "lib/json.h"
 #include "lib/utf.h"
@@ -56,7 +63,56 @@ int makeUserFriendsDir( const char *screen_name, bool daemon );
 int makeUserListsDir( const char *screen_name, bool daemon );
 //int makeUserListsSlugDir( const char *screen_name, const char *slug );
 
-int mmapTwfsListFile( struct twfs_file *twfs_file );
+static const struct twfs_path_rule*
+findTwfsPathRule( E_TWFS_FILE_TYPE state,
+				  const char *name,
+				  size_t len,
+				  bool dir );
+static bool isTwitterIdSpan( const char *name, size_t len );
+static void copyTwfsPathSpan( char *dst,
+							  size_t size,
+							  const struct twfs_path_span *span );
+static struct twfs_attr_cache*
+getTwfsAttrCacheEntry( const struct stat *statbuf );
+static int attachTwfsMap( struct twfs_file *twfs_file );
+static void detachTwfsMap( struct twfs_file *twfs_file );
+static int growTwfsMap( struct twfs_file *twfs_file, size_t size );
+static int resizeTwfsFile( struct twfs_file *twfs_file, size_t size );
+static void shareTwfsFileSize( struct twfs_file *twfs_file );
+static void queueTwfsFileFlush( struct twfs_file *twfs_file,
+								size_t head_len,
+								size_t body_len );
+static int readTweetPage( E_TWFS_REQ request,
+						  struct ssl_session *session,
+						  struct twfs_file *twfs_file,
+						  const char *screen_name,
+						  const char *last,
+						  const char *max_id,
+						  const char *slug,
+						  int count,
+						  int depth,
+						  bool older );
+static int getTwfsPageCount( struct twfs_file *twfs_file, int def_count );
+static void* runTwfsBackfill( void *arg );
+struct twfs_list_gen;
+static int startTwfsListGeneration( struct twfs_list_gen *gen );
+static void* runTwfsListGeneration( void *arg );
+static int buildTwfsListGeneration( struct twfs_list_gen *gen );
+static int readTwfsListPage( struct twfs_list_gen *gen,
+							 struct twfs_file *twfs_file,
+							 const char *cursor );
+static int registerTwfsUser( const char *user_id, const char *screen_name );
+static void moveUserHomeDirectory( const char *old_sname, const char *new_sname );
+static void reclaimUserHomeDirectory( const char *user_id,
+									  const char *screen_name );
+static int getTwfsRecordScreenName( const char *field, char *sname );
+struct twfs_status;
+static int printTwfsStatus( struct twfs_status *status, const char *format, ... );
+struct twfs_user;
+static struct twfs_user* findTwfsUser( const char *screen_name );
+static struct twfs_user* addTwfsUser( const char *screen_name );
+static void removeTwfsUser( const char *screen_name );
+static unsigned int hashTwfsUser( const char *screen_name );
 
 /*
 ================================================================================
@@ -65,6 +121,146 @@ int mmapTwfsListFile( struct twfs_file *twfs_file );
 
 ================================================================================
 */
+/* ---------------------------------------------------------------------------- */
+/* twfs directory grammar														*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_CAP_NONE				-1
+#define	DEF_TWFS_CAP_SECOND				1		// second screen name, slug or id
+#define	DEF_TWFS_CAP_THIRD				2		// third screen name
+
+#define	DEF_TWFS_PATH_STATES			( E_TWFS_FILE_AUTH_LISTS_ADD_LNAME_SUB_SNAME + 1 )
+
+#define	DEF_TWFS_RULE_NAME( name )		E_TWFS_MATCH_NAME, name, sizeof( name ) - 1
+#define	DEF_TWFS_RULE_ID				E_TWFS_MATCH_ID, NULL, 0
+#define	DEF_TWFS_RULE_ANY				E_TWFS_MATCH_ANY, NULL, 0
+
+typedef enum
+{
+	E_TWFS_RULE_FILE,		/* path ends with the name						*/
+	E_TWFS_RULE_DIR,		/* go down to directory of the type				*/
+	E_TWFS_RULE_STOP,		/* names follow the name but type is decided	*/
+} E_TWFS_RULE;
+
+typedef enum
+{
+	E_TWFS_MATCH_NAME,		/* the name itself								*/
+	E_TWFS_MATCH_ID,		/* any twitter id								*/
+	E_TWFS_MATCH_ANY,		/* any name										*/
+} E_TWFS_MATCH;
+
+struct twfs_path_rule
+{
+	E_TWFS_RULE			kind;
+	E_TWFS_MATCH		match;
+	const char			*name;
+	size_t				len;
+	int					capture;	// DEF_TWFS_CAP_*
+	E_TWFS_FILE_TYPE	type;
+	E_TWFS_FILE_TYPE	auth_type;	// type under authorized user directory
+};
+
+struct twfs_path_state
+{
+	const struct twfs_path_rule	*rules;
+	int							n_rules;
+};
+
+/* ---------------------------------------------------------------------------- */
+/* pages of older tweets to get at most when a timeline is behind twitter		*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_CATCH_UP_PAGES			16
+
+/* ---------------------------------------------------------------------------- */
+/* older tweets are got in background when a read reaches the end of file		*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_BACKFILL_INTERVAL		( 10 * 60 )	// seconds
+#define	DEF_TWFS_BACKFILL_MAX_RECORDS	3200	// history kept at most
+
+struct twfs_backfill
+{
+	E_TWFS_REQ			request;
+	struct twfs_file	*twfs_file;		// own handle of the timeline file
+	char				screen_name[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char				slug[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
+};
+
+/* ---------------------------------------------------------------------------- */
+/* generation of list file. next one is built in .list through the cursor chain	*/
+/* and published by renaming it to list, when published one gets old			*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_LIST_GEN_INTERVAL		( 5 * 60 )	// seconds
+#define	DEF_TWFS_LIST_GEN_PAGES			100			// pages of a generation at most
+#define	DEF_TWFS_LIST_GEN_FIELD			20
+
+struct twfs_list_gen
+{
+	struct twfs_list_gen	*next;
+	char					list_path[ DEF_TWFS_PATH_MAX ];	// published one
+	char					work_path[ DEF_TWFS_PATH_MAX ];	// one being built
+	char					screen_name[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char					slug[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
+	E_TWFS_FILE_TYPE		file_type;
+};
+
+/* ---------------------------------------------------------------------------- */
+/* users seen in responses. only [screen_name]/status is made for a new user	*/
+/* and the rest of user home is made when the user is accessed first			*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_USER_HASH_SIZE			4096	// must be power of 2
+
+struct twfs_user
+{
+	struct twfs_user	*next;
+	bool				home;		// true:whole user home is made
+	char				screen_name[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+};
+
+/* ---------------------------------------------------------------------------- */
+/* body of a status file. parts of a tweet or a message are rendered here and	*/
+/* the file is written by a write at once										*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_STATUS_LEN				4096
+
+struct twfs_status
+{
+	int		len;
+	char	text[ DEF_TWFS_STATUS_LEN ];
+};
+
+/* ---------------------------------------------------------------------------- */
+/* attribute cache of timeline and list files									*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_ATTR_CACHE_SIZE		4096	// must be power of 2
+
+struct twfs_attr_cache
+{
+	bool			valid;
+	dev_t			dev;
+	ino_t			ino;
+	off_t			size;		// size of backing file when tl_size was read
+	struct timespec	mtime;		// mtime of backing file when tl_size was read
+	size_t			tl_size;	// total size recorded in header
+};
+
+/* ---------------------------------------------------------------------------- */
+/* mapping of a timeline or list file shared by every handle of the file. it	*/
+/* covers the file only, and grows with the file by mremap					*/
+/* ---------------------------------------------------------------------------- */
+struct twfs_map
+{
+	struct twfs_map		*next;
+	dev_t				dev;
+	ino_t				ino;
+	int					refs;		// handles of the file, under twfs_map_lock
+	pthread_rwlock_t	lock;		// held for write while mapping moves
+	char				*addr;		// NULL:not mapped yet
+	size_t				len;
+	bool				backfill;	// older records are being got
+	bool				oldest;		// twitter has no more older records
+	size_t				history;	// tl size saved before the oldest record
+	size_t				inserted;	// size of records saved before the oldest
+	size_t				size;		// size written by a builder, 0:none
+};
 
 /*
 ================================================================================
@@ -73,6 +269,458 @@ int mmapTwfsListFile( struct twfs_file *twfs_file );
 
 ================================================================================
 */
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/																*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_sname[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_TWEET ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_FILE_TWEET, E_TWFS_FILE_AUTH_TWEET },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_TL ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_FILE_TL, E_TWFS_FILE_AUTH_TL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_USER_TL ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_FILE_USER_TL, E_TWFS_FILE_AUTH_USER_TL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_BLOCKS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_BLOCKS, E_TWFS_DIR_BLOCKS },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_NOTI ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_NOTI, E_TWFS_DIR_NOTI },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FAV ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FAV, E_TWFS_DIR_FAV },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_RETWEET ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_RTW, E_TWFS_DIR_RTW },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_DM ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_DM, E_TWFS_DIR_DM },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FOLLOWERS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FL, E_TWFS_DIR_FL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FRIENDS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FR, E_TWFS_DIR_FR },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LISTS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_LISTS, E_TWFS_DIR_LISTS },
+
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_STATUS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_STATUS, E_TWFS_DIR_STATUS },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_DM ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_DM, E_TWFS_DIR_DM },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FOLLOWERS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FL, E_TWFS_DIR_FL },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FRIENDS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FR, E_TWFS_DIR_FR },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LISTS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_LISTS, E_TWFS_DIR_LISTS },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_NOTI ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_NOTI, E_TWFS_DIR_NOTI },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_RETWEET ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_RTW, E_TWFS_DIR_RTW },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_ACCOUNT ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_ACCOUNT, E_TWFS_DIR_ACCOUNT },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_FAV ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FAV, E_TWFS_DIR_FAV },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_BLOCKS ),
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_BLOCKS, E_TWFS_DIR_BLOCKS },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/status/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_status[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ID,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_STATUS, E_TWFS_FILE_AUTH_STATUS },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/retweet/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_rtw[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ID,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_RTW, E_TWFS_FILE_AUTH_RTW },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/notifications/													*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_noti[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_AT_TW ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_NOTI_AT_TW, E_TWFS_FILE_AUTH_NOTI_AT_TW },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_RTW ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_NOTI_RTW, E_TWFS_FILE_AUTH_NOTI_RTW },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/account/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_account[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_PROFILE ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_ACC_PROFILE, E_TWFS_FILE_AUTH_ACC_PROFILE },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_SETTINGS ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_ACC_SETTING, E_TWFS_FILE_AUTH_ACC_SETTING },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/favorites/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_fav[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_FAV_LIST ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_FAV_LIST, E_TWFS_FILE_AUTH_FAV_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ID,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_FAV_TWEET, E_TWFS_FILE_AUTH_FAV_TWEET },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/blocks/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_blocks[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_BLOCK_LIST ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_BLOCKS_LIST, E_TWFS_FILE_AUTH_BLOCKS_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DOT_BLOCK_LIST ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_DOT_BLOCKS_LIST, E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST },
+	/* [authorized]/blocks/[screen_name]									*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_REG, E_TWFS_FILE_AUTH_BLOCKS },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/direct_message/												*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_dm[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DM_MSG ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_DM_MSG, E_TWFS_FILE_AUTH_DM_MSG },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DM_SEND_TO ),
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_DM_SEND_TO, E_TWFS_FILE_AUTH_DM_SEND_TO },
+	/* [screen_name]/direct_message/[friends]/								*/
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_DM_FR, E_TWFS_DIR_DM_FR },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/direct_message/[friends]/										*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_dm_fr[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DM_MSG ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_DM_FR_MSG, E_TWFS_FILE_AUTH_DM_FR_MSG },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DM_SEND_TO ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_DM_FR_SEND_TO, E_TWFS_FILE_AUTH_DM_FR_SEND_TO },
+	/* direct message id overwrites friends name							*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ID,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_FILE_DM_FR_STATUS, E_TWFS_FILE_AUTH_DM_FR_STATUS },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/follower/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_fl[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_FF_LIST ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_FL_LIST, E_TWFS_FILE_FL_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_FF_DOT_LIST ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_FL_DOT_LIST, E_TWFS_FILE_FL_DOT_LIST },
+	/* [screen_name]/follower/[follower]									*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_FL_FL, E_TWFS_DIR_AUTH_FL_FL },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_FL_FL, E_TWFS_DIR_FL_FL },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/following/														*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_fr[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_FF_LIST ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_FR_LIST, E_TWFS_FILE_FR_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_FF_DOT_LIST ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_FILE_FR_DOT_LIST, E_TWFS_FILE_FR_DOT_LIST },
+	/* [screen_name]/following/[friends]									*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_FR_FR, E_TWFS_DIR_AUTH_FR_FR },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_FR_FR, E_TWFS_DIR_FR_FR },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/{follower, following}/[screen_name]/[any]/						*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_fl_fl[ ] =
+{
+	{ E_TWFS_RULE_STOP, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FL_FL, E_TWFS_DIR_FL_FL },
+};
+
+static const struct twfs_path_rule twfs_rules_fr_fr[ ] =
+{
+	{ E_TWFS_RULE_STOP, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_NONE, E_TWFS_DIR_FR_FR, E_TWFS_DIR_FR_FR },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/lists/															*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_lists[ ] =
+{
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_SUB ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_LISTS_SUB, E_TWFS_DIR_LISTS_SUB },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_OWN ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_LISTS_OWN, E_TWFS_DIR_LISTS_OWN },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_ADD ),
+	  DEF_TWFS_CAP_SECOND, E_TWFS_DIR_LISTS_ADD, E_TWFS_DIR_LISTS_ADD },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/lists/{subscriptions, my_list, added}/							*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_lists_sub[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_SUB_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_SUB_LIST, E_TWFS_FILE_LISTS_SUB_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_SUB_DOT_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_SUB_DOT_LIST, E_TWFS_FILE_LISTS_SUB_DOT_LIST },
+	/* list slug															*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_SUB_LNAME, E_TWFS_DIR_LISTS_SUB_LNAME },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_SUB_LNAME, E_TWFS_DIR_LISTS_SUB_LNAME },
+};
+
+static const struct twfs_path_rule twfs_rules_lists_own[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_OWN_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_OWN_LIST, E_TWFS_FILE_LISTS_OWN_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_OWN_DOT_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_OWN_DOT_LIST, E_TWFS_FILE_LISTS_OWN_DOT_LIST },
+	/* list slug															*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_OWN_LNAME, E_TWFS_DIR_AUTH_LISTS_OWN_LNAME },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_OWN_LNAME, E_TWFS_DIR_LISTS_OWN_LNAME },
+};
+
+static const struct twfs_path_rule twfs_rules_lists_add[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_ADD_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_ADD_LIST, E_TWFS_FILE_LISTS_ADD_LIST },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_ADD_DOT_LIST ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_ADD_DOT_LIST, E_TWFS_FILE_LISTS_ADD_DOT_LIST },
+	/* list slug															*/
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_ADD_LNAME, E_TWFS_DIR_LISTS_ADD_LNAME },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_ANY,
+	  DEF_TWFS_CAP_SECOND,
+	  E_TWFS_DIR_LISTS_ADD_LNAME, E_TWFS_DIR_LISTS_ADD_LNAME },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/lists/{subscriptions, my_list, added}/[lname]/					*/
+/* ---------------------------------------------------------------------------- */
+static const struct twfs_path_rule twfs_rules_sub_lname[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_LDESC ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_SUB_LNAME_LDESC, E_TWFS_FILE_LISTS_SUB_LNAME_LDESC },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_TL ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_SUB_LNAME_TL, E_TWFS_FILE_LISTS_SUB_LNAME_TL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_SUB_LNAME_SUB, E_TWFS_DIR_LISTS_SUB_LNAME_SUB },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_SUB_LNAME_MEM, E_TWFS_DIR_LISTS_SUB_LNAME_MEM },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_SUB_LNAME_SUB, E_TWFS_DIR_LISTS_SUB_LNAME_SUB },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_SUB_LNAME_MEM, E_TWFS_DIR_LISTS_SUB_LNAME_MEM },
+};
+
+static const struct twfs_path_rule twfs_rules_own_lname[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_LDESC ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_OWN_LNAME_LDESC,
+	  E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_LDESC },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_TL ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_OWN_LNAME_TL, E_TWFS_FILE_LISTS_OWN_LNAME_TL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_OWN_LNAME_SUB, E_TWFS_DIR_LISTS_OWN_LNAME_SUB },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_OWN_LNAME_MEM, E_TWFS_DIR_LISTS_OWN_LNAME_MEM },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_OWN_LNAME_SUB, E_TWFS_DIR_LISTS_OWN_LNAME_SUB },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_OWN_LNAME_MEM, E_TWFS_DIR_LISTS_OWN_LNAME_MEM },
+};
+
+static const struct twfs_path_rule twfs_rules_add_lname[ ] =
+{
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_LDESC ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_ADD_LNAME_LDESC, E_TWFS_FILE_LISTS_ADD_LNAME_LDESC },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_TL ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_FILE_LISTS_ADD_LNAME_TL, E_TWFS_FILE_LISTS_ADD_LNAME_TL },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_ADD_LNAME_SUB, E_TWFS_DIR_LISTS_ADD_LNAME_SUB },
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_ADD_LNAME_MEM, E_TWFS_DIR_LISTS_ADD_LNAME_MEM },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_SUB ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_ADD_LNAME_SUB, E_TWFS_DIR_LISTS_ADD_LNAME_SUB },
+	{ E_TWFS_RULE_DIR, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_DIR_LNAME_MEM ),
+	  DEF_TWFS_CAP_NONE,
+	  E_TWFS_DIR_LISTS_ADD_LNAME_MEM, E_TWFS_DIR_LISTS_ADD_LNAME_MEM },
+};
+
+/* ---------------------------------------------------------------------------- */
+/* [screen_name]/lists/{subscriptions, my_list, added}/[lname]/					*/
+/*											{subscribers, members}/				*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_RULES_LNAME_FF( list, dot_list, sname, auth_sname )			\
+{																				\
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_MEM_LIST ),		\
+	  DEF_TWFS_CAP_NONE, list, list },											\
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_NAME( DEF_TWFS_PATH_LNAME_MEM_DOT_LIST ),	\
+	  DEF_TWFS_CAP_NONE, dot_list, dot_list },									\
+	{ E_TWFS_RULE_FILE, DEF_TWFS_RULE_ANY,										\
+	  DEF_TWFS_CAP_THIRD, sname, auth_sname },									\
+	{ E_TWFS_RULE_STOP, DEF_TWFS_RULE_ANY,										\
+	  DEF_TWFS_CAP_THIRD, E_TWFS_FILE_REG, E_TWFS_FILE_REG },					\
+}
+
+static const struct twfs_path_rule twfs_rules_sub_lname_sub[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_SUB_SNAME,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_SUB_SNAME );
+static const struct twfs_path_rule twfs_rules_sub_lname_mem[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_MEM_SNAME,
+							 E_TWFS_FILE_LISTS_SUB_LNAME_MEM_SNAME );
+static const struct twfs_path_rule twfs_rules_own_lname_sub[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST,
+							 E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST,
+							 E_TWFS_FILE_LISTS_OWN_LNAME_SUB_SNAME,
+							 E_TWFS_FILE_LISTS_OWN_LNAME_SUB_SNAME );
+static const struct twfs_path_rule twfs_rules_own_lname_mem[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST,
+							 E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST,
+							 E_TWFS_FILE_LISTS_OWN_LNAME_MEM_SNAME,
+							 E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_MEM_SNAME );
+static const struct twfs_path_rule twfs_rules_add_lname_sub[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_SUB_SNAME,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_SUB_SNAME );
+static const struct twfs_path_rule twfs_rules_add_lname_mem[ ] =
+	DEF_TWFS_RULES_LNAME_FF( E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_MEM_SNAME,
+							 E_TWFS_FILE_LISTS_ADD_LNAME_MEM_SNAME );
+
+/* ---------------------------------------------------------------------------- */
+/* rules of each directory type													*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_STATE( rules )	{ rules, sizeof( rules ) / sizeof( rules[ 0 ] ) }
+
+static const struct twfs_path_state twfs_path_grammar[ DEF_TWFS_PATH_STATES ] =
+{
+	[ E_TWFS_FILE_FIRST_SNAME ]		= DEF_TWFS_STATE( twfs_rules_sname ),
+	[ E_TWFS_DIR_STATUS ]			= DEF_TWFS_STATE( twfs_rules_status ),
+	[ E_TWFS_DIR_RTW ]				= DEF_TWFS_STATE( twfs_rules_rtw ),
+	[ E_TWFS_DIR_NOTI ]				= DEF_TWFS_STATE( twfs_rules_noti ),
+	[ E_TWFS_DIR_ACCOUNT ]			= DEF_TWFS_STATE( twfs_rules_account ),
+	[ E_TWFS_DIR_FAV ]				= DEF_TWFS_STATE( twfs_rules_fav ),
+	[ E_TWFS_DIR_BLOCKS ]			= DEF_TWFS_STATE( twfs_rules_blocks ),
+	[ E_TWFS_DIR_DM ]				= DEF_TWFS_STATE( twfs_rules_dm ),
+	[ E_TWFS_DIR_DM_FR ]			= DEF_TWFS_STATE( twfs_rules_dm_fr ),
+	[ E_TWFS_DIR_FL ]				= DEF_TWFS_STATE( twfs_rules_fl ),
+	[ E_TWFS_DIR_FL_FL ]			= DEF_TWFS_STATE( twfs_rules_fl_fl ),
+	[ E_TWFS_DIR_FR ]				= DEF_TWFS_STATE( twfs_rules_fr ),
+	[ E_TWFS_DIR_FR_FR ]			= DEF_TWFS_STATE( twfs_rules_fr_fr ),
+	[ E_TWFS_DIR_LISTS ]			= DEF_TWFS_STATE( twfs_rules_lists ),
+	[ E_TWFS_DIR_LISTS_SUB ]		= DEF_TWFS_STATE( twfs_rules_lists_sub ),
+	[ E_TWFS_DIR_LISTS_OWN ]		= DEF_TWFS_STATE( twfs_rules_lists_own ),
+	[ E_TWFS_DIR_LISTS_ADD ]		= DEF_TWFS_STATE( twfs_rules_lists_add ),
+	[ E_TWFS_DIR_LISTS_SUB_LNAME ]	= DEF_TWFS_STATE( twfs_rules_sub_lname ),
+	[ E_TWFS_DIR_LISTS_OWN_LNAME ]	= DEF_TWFS_STATE( twfs_rules_own_lname ),
+	[ E_TWFS_DIR_LISTS_ADD_LNAME ]	= DEF_TWFS_STATE( twfs_rules_add_lname ),
+	[ E_TWFS_DIR_LISTS_SUB_LNAME_SUB ]
+								= DEF_TWFS_STATE( twfs_rules_sub_lname_sub ),
+	[ E_TWFS_DIR_LISTS_SUB_LNAME_MEM ]
+								= DEF_TWFS_STATE( twfs_rules_sub_lname_mem ),
+	[ E_TWFS_DIR_LISTS_OWN_LNAME_SUB ]
+								= DEF_TWFS_STATE( twfs_rules_own_lname_sub ),
+	[ E_TWFS_DIR_LISTS_OWN_LNAME_MEM ]
+								= DEF_TWFS_STATE( twfs_rules_own_lname_mem ),
+	[ E_TWFS_DIR_LISTS_ADD_LNAME_SUB ]
+								= DEF_TWFS_STATE( twfs_rules_add_lname_sub ),
+	[ E_TWFS_DIR_LISTS_ADD_LNAME_MEM ]
+								= DEF_TWFS_STATE( twfs_rules_add_lname_mem ),
+};
+
+/* ---------------------------------------------------------------------------- */
+/* attribute cache																*/
+/* ---------------------------------------------------------------------------- */
+static struct twfs_attr_cache	twfs_attr_cache[ DEF_TWFS_ATTR_CACHE_SIZE ];
+static pthread_mutex_t			twfs_attr_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ---------------------------------------------------------------------------- */
+/* mappings of opened files														*/
+/* ---------------------------------------------------------------------------- */
+static struct twfs_map			*twfs_maps;
+static pthread_mutex_t			twfs_map_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ---------------------------------------------------------------------------- */
+/* generations of list files being built in background							*/
+/* ---------------------------------------------------------------------------- */
+static struct twfs_list_gen		*twfs_list_gens;
+static pthread_mutex_t			twfs_list_gen_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ---------------------------------------------------------------------------- */
+/* users registered in responses or accesses									*/
+/* ---------------------------------------------------------------------------- */
+static struct twfs_user			*twfs_users[ DEF_TWFS_USER_HASH_SIZE ];
+static pthread_mutex_t			twfs_user_lock = PTHREAD_MUTEX_INITIALIZER;
+
 
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -114,6 +762,29 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 void destroyTwfsInternal( void )
 {
+	struct twfs_user			*user;
+	struct ssl_handshake_stat	hs_stat;
+	int							i;
+
+	/* ------------------------------------------------------------------------ */
+	/* leave how often tls sessions were resumed, to tell if resumption works	*/
+	/* ------------------------------------------------------------------------ */
+	getSSLHandshakeStat( &hs_stat );
+	logMessage( "tls handshakes:full=%lu resumed=%lu\n",
+				hs_stat.full, hs_stat.resumed );
+
+	pthread_mutex_lock( &twfs_user_lock );
+
+	for( i = 0 ; i < DEF_TWFS_USER_HASH_SIZE ; i++ )
+	{
+		while( ( user = twfs_users[ i ] ) )
+		{
+			twfs_users[ i ] = user->next;
+			free( user );
+		}
+	}
+
+	pthread_mutex_unlock( &twfs_user_lock );
 }
 
 /*
@@ -140,9 +811,12 @@ void* allocTwfsFile( void )
 	if( twfs_file )
 	{
 		twfs_file->tl		= NULL;
+		twfs_file->map		= NULL;
 		twfs_file->fd		= 0;
 		twfs_file->size		= 0;
 		twfs_file->tl_size	= 0;
+		twfs_file->history	= 0;
+		twfs_file->inserted	= 0;
 	}
 
 	return( ( void* )twfs_file );
@@ -183,10 +857,7 @@ int closeTwfsFile( struct twfs_file **close_twfs_file )
 
 	if( twfs_file )
 	{
-		if( twfs_file->tl && ( twfs_file != MAP_FAILED ) )
-		{
-			result = munmap( twfs_file->tl, twfs_file->size );
-		}
+		detachTwfsMap( twfs_file );
 
 		result = closeFile( twfs_file->fd );
 
@@ -198,6 +869,82 @@ int closeTwfsFile( struct twfs_file **close_twfs_file )
 	return( result );
 }
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:lockTwfsFile
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:struct twfs_file *twfs_file
+				 < tl is updated to current mapping, and size to records
+				   appended by a builder or saved before the oldest one >
+	Return		:void
+	Description	:keep mapping of a file in place while reading it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void lockTwfsFile( struct twfs_file *twfs_file )
+{
+	if( twfs_file->map )
+	{
+		pthread_rwlock_rdlock( &twfs_file->map->lock );
+		twfs_file->tl = twfs_file->map->addr;
+
+		if( twfs_file->size < twfs_file->map->size )
+		{
+			twfs_file->size = twfs_file->map->size;
+		}
+
+		/* records read so far are moved back by history saved since then	*/
+		if( twfs_file->inserted < twfs_file->map->inserted )
+		{
+			twfs_file->size		+= twfs_file->map->inserted - twfs_file->inserted;
+			twfs_file->inserted	= twfs_file->map->inserted;
+		}
+	}
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:unlockTwfsFile
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:void
+	Return		:void
+	Description	:let mapping of a file move
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void unlockTwfsFile( struct twfs_file *twfs_file )
+{
+	if( twfs_file->map )
+	{
+		pthread_rwlock_unlock( &twfs_file->map->lock );
+	}
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsReadOffset
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information locked by lockTwfsFile >
+				 off_t offset
+				 < offset user requested >
+	Output		:void
+	Return		:off_t
+				 < offset over current records >
+	Description	:get offset of a read over records of a file. history saved
+				 before the oldest record after the handle is opened is not
+				 seen by the handle, so records it has read do not move
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+off_t getTwfsReadOffset( struct twfs_file *twfs_file, off_t offset )
+{
+	if( !twfs_file->map )
+	{
+		return( offset );
+	}
+
+	return( offset + ( off_t )( twfs_file->map->history - twfs_file->history ) );
+}
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:openTwfsFile
@@ -219,7 +966,6 @@ int openTwfsFile( struct twfs_file *twfs_file,
 {
 	int				result;
 	struct stat		twfs_stat;
-	size_t			mmap_size;
 
 	if( ( twfs_file->fd = openFile( path, O_CREAT | O_RDWR, 0660 ) ) < 0 )
 	{
@@ -253,37 +999,12 @@ int openTwfsFile( struct twfs_file *twfs_file,
 	case	E_TWFS_FILE_LISTS_SUB_LNAME_TL:
 	case	E_TWFS_FILE_LISTS_OWN_LNAME_TL:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_TL:
-		if( twfs_file->size < DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN )
-		{
-			mmap_size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_TWEET_COUNT );
-		}
-		else
-		{
-			mmap_size = twfs_file->size
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_TWEET_COUNT );
-		}
-		
-		break;
+
 	case	E_TWFS_FILE_DM_MSG:
 	case	E_TWFS_FILE_AUTH_DM_MSG:
 	case	E_TWFS_FILE_DM_FR_MSG:
 	case	E_TWFS_FILE_AUTH_DM_FR_MSG:
-		if( twfs_file->size < DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN )
-		{
-			mmap_size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_DM_COUNT );
-		}
-		else
-		{
-			mmap_size = twfs_file->size
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_DM_COUNT );
-		}
-		break;
+
 	case	E_TWFS_FILE_FL_LIST:
 	case	E_TWFS_FILE_FL_DOT_LIST:
 	case	E_TWFS_FILE_FR_LIST:
@@ -311,31 +1032,17 @@ int openTwfsFile( struct twfs_file *twfs_file,
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		if( twfs_file->size < DEF_TWFS_HEAD_FF_LEN )
-		{
-			mmap_size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_FF_COUNT );
-		}
-		else
-		{
-			mmap_size = twfs_file->size
-						+ ( DEF_TWFS_TL_RECORD_LEN
-							* DEF_TWOPE_MAX_FF_COUNT );
-		}
 		break;
 	default:
-		mmap_size = 0;
 		twfs_file->size = 0;
 		freeTwfsFile( twfs_file );
 		return( 0 );
 	}
 
-	twfs_file->tl = ( char* )mmap( NULL, mmap_size,
-								   PROT_WRITE, MAP_SHARED,
-								   twfs_file->fd, 0 );
-
-	if( twfs_file->tl == MAP_FAILED )
+	/* ------------------------------------------------------------------------ */
+	/* share mapping of the file with its other handles							*/
+	/* ------------------------------------------------------------------------ */
+	if( attachTwfsMap( twfs_file ) < 0 )
 	{
 		logMessage( "mmap failed at twfsOpen\n" );
 		closeTwfsFile( &twfs_file );
@@ -350,674 +1057,95 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:openTwfsListFile
 	Input		:struct twfs_file *twfs_file
 				 < twfs file information >
-				 const char *path
-				 < path name to open >
+				 const char *r_path
+				 < path name to open, list or .list >
 				 const char *screen_name
 				 < screen name >
 				 E_TWFS_FILE_TYPE file_type
 				 < twfs file type >
 				 const char *slug
 				 < slug of list. used for lists only >
-				 const char *owner
-				 < owner of list. used for lists only >
 	Output		:struct twfs_file *twfs_file
 				 < update file descriptor >
-	Return		:E_LIST_TYPE
-				 < read and write operation type for list file >
-	Description	:open a follower/following list file
+	Return		:int
+				 < status >
+	Description	:open the latest complete generation of a list file. next
+				 generation is built in .list through the cursor chain in
+				 background, and published by renaming it to list. the first
+				 generation is read from .list while it is built
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
-E_LIST_TYPE openTwfsListFile( struct twfs_file *twfs_file,
-					  const char *path,
+int openTwfsListFile( struct twfs_file *twfs_file,
+					  const char *r_path,
 					  const char *screen_name,
 					  E_TWFS_FILE_TYPE file_type,
-					  const char *slug,
-					  const char *owner )
+					  const char *slug )
 {
-	int			result_path			= 0;
-	int			result_res			= 0;
-	char		reserved_path[ DEF_TWFS_PATH_MAX ];
-	int			fd_res				= -1;
-	int			fd_path				= -1;
-	char		next_cur_path[ DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD + 1 ];
-	char		*next_cur_res;
-	struct stat	stat_path;
-	struct stat	stat_res;
-	int			result_stat_path	= -1;
-	int			result_stat_res		= -1;;
-
-	E_LIST_TYPE	list_type;
+	struct twfs_list_gen	*gen;
+	struct stat				statbuf;
+	char					open_path[ DEF_TWFS_PATH_MAX ];
+	const char				*dir_end;
+	int						dir_len;
+	bool					published;
 
-	list_type = E_LIST_TYPE_W_DOT_R_NORM;
-
-	fd_path = openFile( path, O_CREAT | O_RDWR, 0660 );
-
-	switch( file_type )
-	{
-	default:
-	case	E_TWFS_FILE_FL_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_FOLLOWERS,
-				  DEF_TWFS_PATH_FF_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_FR_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_FRIENDS,
-				  DEF_TWFS_PATH_FF_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_FL_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_FOLLOWERS,
-				  DEF_TWFS_PATH_FF_LIST );
-		break;
-	case	E_TWFS_FILE_FR_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_FRIENDS,
-				  DEF_TWFS_PATH_FF_LIST );
-		break;
-	case	E_TWFS_FILE_BLOCKS_LIST:
-	case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_BLOCKS,
-				  DEF_TWFS_PATH_DOT_BLOCK_LIST );
-		break;
-	case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-	case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_BLOCKS,
-				  DEF_TWFS_PATH_BLOCK_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_SUB_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_SUB,
-				  DEF_TWFS_PATH_SUB_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_SUB,
-				  DEF_TWFS_PATH_SUB_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  DEF_TWFS_PATH_OWN_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  DEF_TWFS_PATH_OWN_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_ADD_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_ADD,
-				  DEF_TWFS_PATH_ADD_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_ADD,
-				  DEF_TWFS_PATH_ADD_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  slug,
-				  owner,
-				  DEF_TWFS_PATH_DIR_LNAME_MEM,
-				  DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  slug,
-				  owner,
-				  DEF_TWFS_PATH_DIR_LNAME_MEM,
-				  DEF_TWFS_PATH_LNAME_MEM_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  slug,
-				  owner,
-				  DEF_TWFS_PATH_DIR_LNAME_SUB,
-				  DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
-		snprintf( reserved_path, sizeof( reserved_path ),
-				  "%s/%s/%s/%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  screen_name,
-				  DEF_TWFS_PATH_DIR_LISTS,
-				  DEF_TWFS_PATH_DIR_OWN,
-				  slug,
-				  owner,
-				  DEF_TWFS_PATH_DIR_LNAME_MEM,
-				  DEF_TWFS_PATH_LNAME_SUB_LIST );
-		break;
-	}
-
-	logMessage( "list norm path[%d] : %s\n",file_type, path );
-	logMessage( "list resv path : %s\n", reserved_path );
-
-	fd_res = openFile( reserved_path, O_CREAT | O_RDWR, 0660 );
-
-	if( ( fd_path < 0 ) && ( fd_res < 0 ) )
+	if( !( dir_end = strrchr( r_path, '/' ) ) )
 	{
-		return( E_LIST_TYPE_ERROR );
+		freeTwfsFile( twfs_file );
+		return( -ENOENT );
 	}
 
-	next_cur_res = reserved_path;
-
-	if( 0 <= fd_path )
-	{
-		result_stat_path	= fstat( fd_path, &stat_path );
-		logMessage( "cursor path<0>:[%d]%s\n", fd_path,next_cur_path );
-		result_path	= getNextCursorOfListFileFromFd( fd_path, next_cur_path );
-		logMessage( "cursor path<1>:[%d]%s\n", fd_path,next_cur_path );
-	}
-	if( 0 <= fd_res )
+	if( !( gen = malloc( sizeof( struct twfs_list_gen ) ) ) )
 	{
-		result_stat_res		= fstat( fd_res, &stat_res );
-		logMessage( "cursor res<0>:[%d]%s\n", fd_res, next_cur_res );
-		result_res	= getNextCursorOfListFileFromFd( fd_res, next_cur_res );
-		logMessage( "cursor res<1>:[%d]%s\n", fd_res,next_cur_res );
+		freeTwfsFile( twfs_file );
+		return( -ENOMEM );
 	}
 
-	if( result_stat_path < 0 )
-	{
-		closeFile( fd_path );
-		fd_path = -1;
-	}
+	/* ------------------------------------------------------------------------ */
+	/* list and .list in the same directory are one logical list				*/
+	/* ------------------------------------------------------------------------ */
+	dir_len = ( int )( dir_end - r_path );
 
-	if( result_stat_res < 0 )
-	{
-		closeFile( fd_res );
-		fd_res = -1;
-	}
+	snprintf( gen->list_path, sizeof( gen->list_path ), "%.*s/%s",
+			  dir_len, r_path, DEF_TWFS_PATH_FF_LIST );
+	snprintf( gen->work_path, sizeof( gen->work_path ), "%.*s/%s",
+			  dir_len, r_path, DEF_TWFS_PATH_FF_DOT_LIST );
+	snprintf( gen->screen_name, sizeof( gen->screen_name ), "%s",
+			  screen_name ? screen_name : "" );
+	snprintf( gen->slug, sizeof( gen->slug ), "%s", slug ? slug : "" );
+	gen->file_type = file_type;
 
-	next_cur_path[ DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ]	= '\0';
-	next_cur_res[ DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ]		= '\0';
+	published = ( stat( gen->list_path, &statbuf ) == 0 ) &&
+				( DEF_TWFS_HEAD_FF_LEN <= statbuf.st_size );
 
-	logMessage( "cursor path[%d]:%s\n", result_path, next_cur_path );
-	logMessage( "cursor rsvd[%d]:%s\n", result_res, next_cur_res );
+	/* ------------------------------------------------------------------------ */
+	/* until the first generation is published, .list is read while it is		*/
+	/* built and pages appear as they arrive									*/
+	/* ------------------------------------------------------------------------ */
+	snprintf( open_path, sizeof( open_path ), "%s",
+			  published ? gen->list_path : gen->work_path );
 
 	/* ------------------------------------------------------------------------ */
-	/* error handling for file descriptor										*/
+	/* readers keep the generation they opened while next one is built			*/
 	/* ------------------------------------------------------------------------ */
-	if( ( fd_path < 0 ) && ( 0 <= fd_res ) )
+	if( !published ||
+		( ( statbuf.st_mtime + DEF_TWFS_LIST_GEN_INTERVAL ) <= time( NULL ) ) )
 	{
-		switch( file_type )
-		{
-		default:
-		case	E_TWFS_FILE_FR_LIST:
-		case	E_TWFS_FILE_FL_LIST:
-			list_type		= E_LIST_TYPE_W_DOT_R_DOT;
-			//closeFile( fd_path );
-			break;
-		case	E_TWFS_FILE_FR_DOT_LIST:
-		case	E_TWFS_FILE_FL_DOT_LIST:
-			list_type		= E_LIST_TYPE_W_NORM_R_NORM;
-			//closeFile( fd_path );
-			break;
-		}
-
-		twfs_file->fd	= fd_res;
-		twfs_file->size	= stat_res.st_size;
-		if( mmapTwfsListFile( twfs_file ) < 0 )
-		{
-			return( E_LIST_TYPE_ERROR );
-		}
-		return( list_type );
+		/* gen is freed by background										*/
+		startTwfsListGeneration( gen );
 	}
-	else if( ( 0 <= fd_path ) && ( fd_res < 0 ) )
+	else
 	{
-		switch( file_type )
-		{
-		default:
-		case	E_TWFS_FILE_FR_LIST:
-		case	E_TWFS_FILE_FL_LIST:
-			list_type		= E_LIST_TYPE_W_NORM_R_NORM;
-			//closeFile( fd_res );
-			break;
-		case	E_TWFS_FILE_FR_DOT_LIST:
-		case	E_TWFS_FILE_FL_DOT_LIST:
-			list_type		= E_LIST_TYPE_W_DOT_R_DOT;
-			//closeFile( fd_res );
-			break;
-		}
-		twfs_file->fd	= fd_path;
-		twfs_file->size	= stat_path.st_size;
-		if( mmapTwfsListFile( twfs_file ) < 0 )
-		{
-			return( E_LIST_TYPE_ERROR );
-		}
-		return( list_type );
+		free( gen );
 	}
-	else if( ( fd_path < 0 ) && ( fd_res < 0 ) )
+
+	/* twfs file is freed on failure											*/
+	if( openTwfsFile( twfs_file, open_path, file_type ) < 0 )
 	{
-		return( E_LIST_TYPE_ERROR );
+		return( -ENOMEM );
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* error handling for next cursor											*/
-	/* ------------------------------------------------------------------------ */
-	if( ( result_path < 0 ) && ( result_res < 0 ) )
-	{
-		ftruncate( fd_path, 0 );
-		ftruncate( fd_res, 0 );
-
-		twfs_file->fd = fd_path;
-		closeFile( fd_res );
-
-		switch( file_type )
-		{
-		default:
-		case	E_TWFS_FILE_FL_LIST:
-		case	E_TWFS_FILE_FR_LIST:
-			list_type = E_LIST_TYPE_W_NORM_R_NORM;
-			break;
-		case	E_TWFS_FILE_FL_DOT_LIST:
-		case	E_TWFS_FILE_FR_DOT_LIST:
-			list_type = E_LIST_TYPE_W_DOT_R_DOT;
-			break;
-		}
-
-		//twfs_file->size	= stat_path.st_size;
-		twfs_file->size	= 0;
-		if( mmapTwfsListFile( twfs_file ) < 0 )
-		{
-			return( E_LIST_TYPE_ERROR );
-		}
-		logMessage( "<0>open path:%s\n", path );
-		logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-
-		return( list_type );
-	}
-	else if( ( 0 < result_path ) && ( result_res < 0 ) )
-	{
-		ftruncate( fd_res, 0 );
-
-		if( ( next_cur_path[ 0 ] == '0' ) && ( result_path == 1 ) )
-		{
-			switch( file_type )
-			{
-			default:
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FR_LIST:
-				list_type = E_LIST_TYPE_W_DOT_R_NORM;
-				break;
-			case	E_TWFS_FILE_FL_DOT_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				list_type = E_LIST_TYPE_W_NORM_R_DOT;
-				break;
-			}
-			twfs_file->fd = fd_res;
-			closeFile( fd_path );
-			twfs_file->size	= stat_res.st_size;
-			if( mmapTwfsListFile( twfs_file ) < 0 )
-			{
-				return( E_LIST_TYPE_ERROR );
-			}
-
-			logMessage( "<1>open reserve:%s\n", reserved_path );
-
-			return( list_type );
-		}
-
-		switch( file_type )
-		{
-		default:
-		case	E_TWFS_FILE_FL_LIST:
-		case	E_TWFS_FILE_FR_LIST:
-			list_type = E_LIST_TYPE_W_NORM_R_NORM;
-			break;
-		case	E_TWFS_FILE_FL_DOT_LIST:
-		case	E_TWFS_FILE_FR_DOT_LIST:
-			list_type = E_LIST_TYPE_W_DOT_R_DOT;
-			break;
-		}
-		twfs_file->fd = fd_path;
-		closeFile( fd_res );
-		twfs_file->size	= stat_path.st_size;
-		if( mmapTwfsListFile( twfs_file ) < 0 )
-		{
-			return( E_LIST_TYPE_ERROR );
-		}
-
-		logMessage( "<1>open path:%s\n", path );
-
-		return( list_type );
-	}
-	else if( ( result_path < 0 ) && ( 0 < result_res ) )
-	{
-		ftruncate( fd_path, 0 );
-
-		if( ( next_cur_res[ 0 ] == '-' ) &&
-			( next_cur_res[ 1 ] == '1' ) &&
-			( result_res == 2 ) )
-		{
-			switch( file_type )
-			{
-			default:
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FR_LIST:
-				list_type = E_LIST_TYPE_W_NORM_R_DOT;
-				break;
-			case	E_TWFS_FILE_FL_DOT_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				list_type = E_LIST_TYPE_W_DOT_R_NORM;
-				break;
-			}
-			twfs_file->fd = fd_path;
-			closeFile( fd_res );
-			twfs_file->size	= stat_path.st_size;
-			if( mmapTwfsListFile( twfs_file ) < 0 )
-			{
-				return( E_LIST_TYPE_ERROR );
-			}
-			logMessage( "<2>open path:%s\n", path );
-
-			return( list_type );
-		}
-
-		switch( file_type )
-		{
-		default:
-		case	E_TWFS_FILE_FL_LIST:
-		case	E_TWFS_FILE_FR_LIST:
-			list_type = E_LIST_TYPE_W_DOT_R_DOT;
-			break;
-		case	E_TWFS_FILE_FL_DOT_LIST:
-		case	E_TWFS_FILE_FR_DOT_LIST:
-			list_type = E_LIST_TYPE_W_NORM_R_NORM;
-			break;
-		}
-		twfs_file->fd = fd_res;
-		closeFile( fd_path );
-		twfs_file->size	= stat_res.st_size;
-		if( mmapTwfsListFile( twfs_file ) < 0 )
-		{
-			return( E_LIST_TYPE_ERROR );
-		}
-		logMessage( "<2>open reserve:%s\n", reserved_path );
-
-		return( list_type );
-	}
-	/* ------------------------------------------------------------------------ */
-	/* next cursor of both of path and res file has sane number					*/
-	/* ------------------------------------------------------------------------ */
-	else
-	{
-		logMessage( "next_cur_path:%s [%d]\n", next_cur_path, result_path );
-		logMessage( "next_cur_res:%s [%d]\n", next_cur_res, result_res );
-#if 0
-		if( ( ( ( next_cur_res[ 0 ]		== '-' ) &&
-				( next_cur_res[ 1 ]		== '1' ) &&
-				( result_res == 2 )					) &&
-			  ( ( next_cur_path[ 0 ]	== '-' ) &&
-				( next_cur_path[ 1 ]	== '1' ) &&
-				( result_path == 2 )				) ) ||
-			( ( 1 < result_path ) && ( 1 < result_res ) ) )
-#endif
-		if( ( 1 < result_path ) && ( 1 < result_res ) )
-		{
-			if( stat_path.st_mtime <= stat_res.st_mtime )
-			{
-				switch( file_type )
-				{
-				default:
-				case	E_TWFS_FILE_FL_LIST:
-				case	E_TWFS_FILE_FR_LIST:
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					list_type = E_LIST_TYPE_W_DOT_R_DOT;
-					break;
-				case	E_TWFS_FILE_FL_DOT_LIST:
-				case	E_TWFS_FILE_FR_DOT_LIST:
-					//list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					//list_type = E_LIST_TYPE_W_DOT_R_DOT;
-					list_type = E_LIST_TYPE_W_NORM_R_NORM;
-				}
-				twfs_file->fd = fd_res;
-				closeFile( fd_path );
-				twfs_file->size	= stat_res.st_size;
-				//twfs_file->size	= 0;
-				if( mmapTwfsListFile( twfs_file ) < 0 )
-				{
-					return( E_LIST_TYPE_ERROR );
-				}
-				logMessage( "<6>open res:%s\n", reserved_path );
-				logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-
-				return( list_type );
-			}
-			else
-			{
-				//ftruncate( fd_res, 0 );
-				switch( file_type )
-				{
-				default:
-				case	E_TWFS_FILE_FL_LIST:
-				case	E_TWFS_FILE_FR_LIST:
-					//list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					list_type = E_LIST_TYPE_W_NORM_R_NORM;
-					break;
-				case	E_TWFS_FILE_FL_DOT_LIST:
-				case	E_TWFS_FILE_FR_DOT_LIST:
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					//list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					list_type = E_LIST_TYPE_W_DOT_R_DOT;
-				}
-				twfs_file->fd = fd_path;
-				closeFile( fd_res );
-				twfs_file->size	= stat_path.st_size;
-				//twfs_file->size	= 0;
-				if( mmapTwfsListFile( twfs_file ) < 0 )
-				{
-					return( E_LIST_TYPE_ERROR );
-				}
-				logMessage( "<7>open path:%s\n", reserved_path );
-				logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-				logMessage( "fd:[%d]\n", twfs_file->fd );
-
-				return( list_type );
-			}
-		}
-#if 0
-		else if( ( next_cur_res[ 0 ] == '-' ) &&
-				 ( next_cur_res[ 1 ] == '1' ) &&
-				 ( result_res == 2 ) )
-#endif
-		else if( ( ( next_cur_res[ 0 ] == '0'	)	&&
-				   ( result_res == 1 )			)	&&
-				 ( 1 < result_path ) )
-		{
-			switch( file_type )
-			{
-			default:
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FR_LIST:
-				list_type = E_LIST_TYPE_W_NORM_R_DOT;
-				break;
-			case	E_TWFS_FILE_FL_DOT_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				list_type = E_LIST_TYPE_W_DOT_R_NORM;
-				break;
-			}
-			twfs_file->fd = fd_path;
-			closeFile( fd_res );
-			twfs_file->size	= stat_path.st_size;
-			if( mmapTwfsListFile( twfs_file ) < 0 )
-			{
-				return( E_LIST_TYPE_ERROR );
-			}
-			logMessage( "<8>open path:%s\n", path );
-			
-			return( list_type );
-		}
-		else if( ( ( next_cur_path[ 0 ] == '0'	)	&&
-				   ( result_path == 1 )			)	&&
-				 ( 1 < result_res ) )
-		{
-			switch( file_type )
-			{
-			default:
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FR_LIST:
-				list_type = E_LIST_TYPE_W_DOT_R_NORM;
-				break;
-			case	E_TWFS_FILE_FL_DOT_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				list_type = E_LIST_TYPE_W_NORM_R_DOT;
-				break;
-			}
-			twfs_file->fd = fd_res;
-			closeFile( fd_path );
-			twfs_file->size	= stat_res.st_size;
-			if( mmapTwfsListFile( twfs_file ) < 0 )
-			{
-				return( E_LIST_TYPE_ERROR );
-			}
-			logMessage( "<9>open reserved:%s\n", reserved_path );
-			
-			return( list_type );
-		}
-		else if( ( ( next_cur_res[ 0 ] == '0'	)	&&
-				   ( result_res == 1 )			)	&&
-				 ( ( next_cur_path[ 0 ] == '0'	)	&&
-				   ( result_path == 1 )			) )
-		{
-			if( stat_path.st_mtime <= stat_res.st_mtime )
-			{
-				ftruncate( fd_path, 0 );
-				switch( file_type )
-				{
-				default:
-				case	E_TWFS_FILE_FL_LIST:
-				case	E_TWFS_FILE_FR_LIST:
-					//list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					break;
-				case	E_TWFS_FILE_FL_DOT_LIST:
-				case	E_TWFS_FILE_FR_DOT_LIST:
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					list_type = E_LIST_TYPE_W_DOT_R_NORM;
-				}
-				twfs_file->fd = fd_path;
-				closeFile( fd_res );
-				//twfs_file->size	= stat_res.st_size;
-				twfs_file->size	= 1;
-				if( mmapTwfsListFile( twfs_file ) < 0 )
-				{
-					return( E_LIST_TYPE_ERROR );
-				}
-				logMessage( "<11>open path:%s\n", path );
-				logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-				logMessage( "fd:[%d]\n", twfs_file->fd );
-
-				return( list_type );
-			}
-			else
-			{
-				ftruncate( fd_res, 0 );
-				switch( file_type )
-				{
-				default:
-				case	E_TWFS_FILE_FL_LIST:
-				case	E_TWFS_FILE_FR_LIST:
-					//list_type = E_LIST_TYPE_W_NORM_R_DOT;
-					list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					break;
-				case	E_TWFS_FILE_FL_DOT_LIST:
-				case	E_TWFS_FILE_FR_DOT_LIST:
-					//list_type = E_LIST_TYPE_W_DOT_R_NORM;
-					list_type = E_LIST_TYPE_W_NORM_R_DOT;
-				}
-				twfs_file->fd = fd_res;
-				closeFile( fd_path );
-				//twfs_file->size	= stat_path.st_size;
-				twfs_file->size	= 1;
-				logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-				if( mmapTwfsListFile( twfs_file ) < 0 )
-				{
-					return( E_LIST_TYPE_ERROR );
-				}
-				logMessage( "<10>open resv:%s\n", reserved_path );
-				logMessage( "twfs_file->size:%zu\n", twfs_file->size );
-
-				return( list_type );
-			}
-		}
-		
-#if 0
-		else if kokokara next_cur ga 0 and path_cur ga 0 no toki
-#endif
-	}
-	twfs_file->fd = fd_path;
-	closeFile( fd_res );
-	twfs_file->size	= stat_path.st_size;
-	if( mmapTwfsListFile( twfs_file ) < 0 )
-	{
-		return( E_LIST_TYPE_ERROR );
-	}
-	logMessage( "<12>open path:%s\n", path );
-
-	return( list_type );
-}
+	return( 0 );
+}
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -1054,7 +1182,6 @@ int openTwfsTweetFile( struct twfs_file **open_twfs_file,
 	char				last[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
 	char				sent_last[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
 	struct twfs_file	*twfs_file;
-	E_LIST_TYPE			list_type;
 
 	if( ( twfs_file = ( struct twfs_file* )allocTwfsFile( ) ) == NULL )
 	{
@@ -1091,15 +1218,13 @@ int openTwfsTweetFile( struct twfs_file **open_twfs_file,
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		list_type = openTwfsListFile( twfs_file,
-									  r_path,
-									  screen_name,
-									  file_type,
-									  slug,
-									  owner );
-		if( list_type == E_LIST_TYPE_ERROR )
+		if( ( result = openTwfsListFile( twfs_file,
+										 r_path,
+										 screen_name,
+										 file_type,
+										 slug ) ) < 0 )
 		{
-			return( -ENOMEM );
+			return( result );
 		}
 		break;
 	case	E_TWFS_FILE_LISTS_SUB_LNAME_TL:
@@ -1308,660 +1433,170 @@ int openTwfsTweetFile( struct twfs_file **open_twfs_file,
 		result = 0;
 		break;
 	/* ------------------------------------------------------------------------ */
-	/* follower list file														*/
+	/* list files. a generation is got through its cursor chain at once			*/
 	/* ------------------------------------------------------------------------ */
 	case	E_TWFS_FILE_FL_LIST:
 	case	E_TWFS_FILE_FL_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<0>next cursor:(null)\n" );
-			result = readUsers( E_TWFS_REQ_READ_FOLLOWER_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL,
-								NULL );
-		}
-		else
-		{
-			if( last[ 0 ] == '0' && last[ 1 ] == '\0' )
-			{
-				last[ 0 ] = '-';
-				last[ 1 ] = '1';
-				last[ 2 ] = '2';
-			}
-			logMessage( "<0>next cursor:%s\n", last );
-			result = readUsers( E_TWFS_REQ_READ_FOLLOWER_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last,		// last for using cursor in the list
-								NULL );
-		}
-		break;
-	/* ------------------------------------------------------------------------ */
-	/* following list file														*/
-	/* ------------------------------------------------------------------------ */
 	case	E_TWFS_FILE_FR_LIST:
 	case	E_TWFS_FILE_FR_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readUsers( E_TWFS_REQ_READ_FOLLOWING_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL,
-								NULL );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readUsers( E_TWFS_REQ_READ_FOLLOWING_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last,		// last for using cursor in the list
-								NULL );
-		}
-		break;
-	/* ------------------------------------------------------------------------ */
-	/* blocks list file															*/
-	/* ------------------------------------------------------------------------ */
 	case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
 	case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readUsers( E_TWFS_REQ_READ_AUTH_BLOCK_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL,
-								NULL );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readUsers( E_TWFS_REQ_READ_AUTH_BLOCK_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last,		// last for using cursor in the list
-								NULL );
-		}
-		break;
-	/* ------------------------------------------------------------------------ */
-	/* lists list file															*/
-	/* ------------------------------------------------------------------------ */
+
 	case	E_TWFS_FILE_LISTS_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readLists( E_TWFS_REQ_READ_LISTS_SUB_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readLists( E_TWFS_REQ_READ_LISTS_SUB_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last );		// last for using cursor in the list
-		}
-		break;
-	case	E_TWFS_FILE_LISTS_OWN_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readLists( E_TWFS_REQ_READ_LISTS_OWN_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readLists( E_TWFS_REQ_READ_LISTS_OWN_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last );		// last for using cursor in the list
-		}
-		break;
-	case	E_TWFS_FILE_LISTS_ADD_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readLists( E_TWFS_REQ_READ_LISTS_ADD_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readLists( E_TWFS_REQ_READ_LISTS_ADD_LIST,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last );		// last for using cursor in the list
-		}
-		break;
 	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
 	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+
+	case	E_TWFS_FILE_LISTS_OWN_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
 	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+
+	case	E_TWFS_FILE_LISTS_ADD_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readUsers( E_TWFS_REQ_READ_LISTS_MEMBERS,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL,
-								slug );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readUsers( E_TWFS_REQ_READ_LISTS_MEMBERS,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last,		// last for using cursor in the list
-								slug );
-		}
-		break;
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
 	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		if( getNextCursorOfListFile( twfs_file, last ) <= 0 )
-		{
-			logMessage( "<1>next cursor:(null)\n" );
-			result = readUsers( E_TWFS_REQ_READ_LISTS_SUBSCRIBERS,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								NULL,
-								slug );
-		}
-		else
-		{
-			logMessage( "<1>next cursor:%s\n", last );
-			result = readUsers( E_TWFS_REQ_READ_LISTS_SUBSCRIBERS,
-								getCurrentSSLSession( ),
-								twfs_file,
-								screen_name,
-								last,		// last for using cursor in the list
-								slug );
-		}
+		/* already done by openTwfsListFile										*/
+		result = 0;
 		break;
 	}
 
+	if( result < 0 )
+	{
+		logMessage( "read failed at twfsOpen\n" );
+		//closeTwfsFile( &twfs_file );
+		//return( -EACCES );
+	}
+
+	/* update file information													*/
+	*open_twfs_file = twfs_file;
+	
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:classifyTwfsPath
+	Input		:const char *path
+				 < path over twitter file system >
+				 struct twfs_path_capture *capture
+				 < names captured from path >
+	Output		:struct twfs_path_capture *capture
+				 < spans of screen names, slug and tweet id in path >
+	Return		:E_TWFS_FILE_TYPE
+				 < type of twfs special file >
+	Description	:classify a path by walking twfs_path_grammar
+				 < each name of path is looked at only once >
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+E_TWFS_FILE_TYPE
+classifyTwfsPath( const char *path, struct twfs_path_capture *capture )
+{
+	const struct twfs_path_rule	*rule;
+	const char					*name;
+	const char					*end;
+	const char					*auth_sname;
+	bool						auth_user;
+	bool						dir;
+	E_TWFS_FILE_TYPE			state;
+	E_TWFS_FILE_TYPE			file_type;
+	int							i;
+
+	for( i = 0 ; i < DEF_TWFS_PATH_CAPTURES ; i++ )
+	{
+		capture->sname[ i ].name	= path;
+		capture->sname[ i ].len		= 0;
+	}
+
 	/* ------------------------------------------------------------------------ */
-	/* following procedure is only for twfs list files							*/
+	/* skip "/"																	*/
 	/* ------------------------------------------------------------------------ */
-	char	new_list_file[ DEF_TWFS_PATH_MAX ];
-	switch( file_type )
+	name = path + 1;
+
+	if( *name == '\0' )
 	{
-	case	E_TWFS_FILE_FL_LIST:
-	case	E_TWFS_FILE_FR_LIST:
-	case	E_TWFS_FILE_FL_DOT_LIST:
-	case	E_TWFS_FILE_FR_DOT_LIST:
-	case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-	case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+		return( E_TWFS_FILE_REG );
+	}
 
-	case	E_TWFS_FILE_LISTS_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+	/* ------------------------------------------------------------------------ */
+	/* "screen_name"															*/
+	/* ------------------------------------------------------------------------ */
+	for( end = name ; ( *end != '/' ) && ( *end != '\0' ) ; end++ )
+	{
+		;
+	}
 
-	case	E_TWFS_FILE_LISTS_OWN_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+	capture->sname[ 0 ].name	= name;
+	capture->sname[ 0 ].len		= end - name;
 
-	case	E_TWFS_FILE_LISTS_ADD_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-		if( list_type == E_LIST_TYPE_W_NORM_R_NORM )
-		{
-			if( ( file_type == E_TWFS_FILE_FL_LIST )					||
-				( file_type == E_TWFS_FILE_FR_LIST )					||
-				( file_type == E_TWFS_FILE_AUTH_BLOCKS_LIST )			||
-				( file_type == E_TWFS_FILE_LISTS_SUB_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_OWN_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_ADD_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST ) )
-			{
-				/* already dot file is opened									*/
-				break;
-			}
+	if( *end == '\0' )
+	{
+		return( E_TWFS_FILE_FIRST_SNAME );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* check whethre authorized user directory									*/
+	/* ------------------------------------------------------------------------ */
+	auth_sname	= getTwapiScreenName( );
+	auth_user	= ( strlen( auth_sname ) == ( size_t )( end - name ) ) &&
+				  ( memcmp( auth_sname, name, end - name ) == 0 );
+
+	/* ------------------------------------------------------------------------ */
+	/* walk down the grammar a name by a name									*/
+	/* ------------------------------------------------------------------------ */
+	state = E_TWFS_FILE_FIRST_SNAME;
+
+	while( 1 )
+	{
+		/* skip "/"		*/
+		name = end + 1;
+
+		if( *name == '\0' )
+		{
+			return( E_TWFS_FILE_REG );
 		}
-		else if( list_type == E_LIST_TYPE_W_DOT_R_DOT )
+
+		for( end = name ; ( *end != '/' ) && ( *end != '\0' ) ; end++ )
 		{
-			if( ( file_type == E_TWFS_FILE_FL_DOT_LIST )					||
-				( file_type == E_TWFS_FILE_FR_DOT_LIST )					||
-				( file_type == E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST )			||
-				( file_type == E_TWFS_FILE_LISTS_SUB_DOT_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_OWN_DOT_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_ADD_DOT_LIST )				||
-				( file_type == E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST )	||
-				( file_type == E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST ) )
-			{
-				/* already dot file is opened									*/
-				break;
-			}
+			;
 		}
-		else
+
+		if( DEF_TWFS_PATH_MAX <= ( end - path ) )
 		{
-			/* already dot file is opened										*/
-			//break;
+			return( E_TWFS_FILE_REG );
 		}
 
-		/* -------------------------------------------------------------------- */
-		/* this path may be through under following conditions.					*/
-		/* condition 1)															*/
-		/* 	list_type = E_LIST_TYPE_W_NORM_R_DOT &&								*/
-		/* 	file_type = E_TWFS_FILE_FL_DOT_LIST or FR_DOT_LIST					*/
-		/* condition 2)															*/
-		/* 	list_type = E_LIST_TYPE_W_DOT_R_NORM &&								*/
-		/* 	file_type = E_TWFS_FILE_FL_LIST or FR_LIST							*/
-		/* -------------------------------------------------------------------- */
-	
-		logMessage( "close written list file.[%d]\n", twfs_file->fd );
-		closeTwfsFile( &twfs_file );
-		logMessage( "and open read list file\n" );
-		if( ( twfs_file = ( struct twfs_file* )allocTwfsFile( ) ) == NULL )
+		dir		= ( *end == '/' );
+		rule	= findTwfsPathRule( state, name, end - name, dir );
+
+		if( !rule )
 		{
-			logMessage( "cannot alloc\n" );
-			return( -ENOMEM );
+			return( E_TWFS_FILE_REG );
 		}
-		
 
-#if 0
-		if( twfs_file->tl && ( twfs_file != MAP_FAILED ) )
+		if( rule->capture != DEF_TWFS_CAP_NONE )
 		{
-			munmap( twfs_file->tl, twfs_file->size );
+			capture->sname[ rule->capture ].name	= name;
+			capture->sname[ rule->capture ].len		= end - name;
 		}
 
-		closeFile( twfs_file->fd );
-#endif
+		file_type = auth_user ? rule->auth_type : rule->type;
 
-		if( ( list_type == E_LIST_TYPE_W_NORM_R_DOT ) ||
-			( list_type == E_LIST_TYPE_W_DOT_R_DOT ) )
+		if( rule->kind != E_TWFS_RULE_DIR )
 		{
-			switch( file_type )
-			{
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FL_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_FOLLOWERS,
-						  DEF_TWFS_PATH_FF_DOT_LIST );
-				file_type = E_TWFS_FILE_FL_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_FR_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_FRIENDS,
-						  DEF_TWFS_PATH_FF_DOT_LIST );
-				file_type = E_TWFS_FILE_FR_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-			case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_BLOCKS,
-						  DEF_TWFS_PATH_DOT_BLOCK_LIST );
-				file_type = E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  DEF_TWFS_PATH_SUB_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  DEF_TWFS_PATH_OWN_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  DEF_TWFS_PATH_ADD_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST;
-				break;
-			default:
-				/* just update file information								*/
-				*open_twfs_file = twfs_file;
-				return( 0 );
-			}
+			return( file_type );
 		}
-		else if( ( list_type == E_LIST_TYPE_W_DOT_R_NORM ) ||
-				 ( list_type == E_LIST_TYPE_W_NORM_R_NORM ) )
-		{
-			switch( file_type )
-			{
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FL_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_FOLLOWERS,
-						  DEF_TWFS_PATH_FF_LIST );
-				file_type = E_TWFS_FILE_FL_LIST;
-				break;
-			case	E_TWFS_FILE_FR_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_FRIENDS,
-						  DEF_TWFS_PATH_FF_LIST );
-				file_type = E_TWFS_FILE_FR_LIST;
-				break;
-			case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-			case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_BLOCKS,
-						  DEF_TWFS_PATH_BLOCK_LIST );
-				file_type = E_TWFS_FILE_AUTH_BLOCKS_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  DEF_TWFS_PATH_SUB_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_SUB,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_LIST );
-				file_type = E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  DEF_TWFS_PATH_OWN_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_LIST );
-				file_type = E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  DEF_TWFS_PATH_ADD_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_MEM,
-						  DEF_TWFS_PATH_LNAME_MEM_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST;
-				break;
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-				snprintf( new_list_file, sizeof( new_list_file ),
-						  "%s/%s/%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  screen_name,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_ADD,
-						  slug,
-						  owner,
-						  DEF_TWFS_PATH_DIR_LNAME_SUB,
-						  DEF_TWFS_PATH_LNAME_SUB_LIST );
-				file_type = E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST;
-				break;
-			default:
-				/* just update file information								*/
-				*open_twfs_file = twfs_file;
-				return( 0 );
-			}
-		}
-
-		if( ( result = openTwfsFile( twfs_file, new_list_file, file_type ) ) < 0 )
-		{
-			return( -ENOMEM );
-		}
-		if( ( result = getTotalSizeOfTlFile( twfs_file ) ) < 0 )
-		{
-			logMessage( "gettotalsizeoftlfile failed:%d\n", result );
-			return( -EACCES );
-		}
-		logMessage( "<12>open :%s\n", new_list_file );
-		break;
-	default:
-		break;
-	}
 
-	if( result < 0 )
-	{
-		logMessage( "read failed at twfsOpen\n" );
-		//closeTwfsFile( &twfs_file );
-		//return( -EACCES );
+		state = file_type;
 	}
 
-	/* update file information													*/
-	*open_twfs_file = twfs_file;
-	
-	return( 0 );
+	return( E_TWFS_FILE_REG );
 }
 
 /*
@@ -1992,1723 +1627,1451 @@ whichTwfsPath( const char *path,
 			   char *second_sname,
 			   char *third_sname )
 {
-	int					i, j;
-	int					total;
-	char				path_cmp[ DEF_TWFS_PATH_MAX ];
-	bool				auth_user	= false;
-	const char			*user_path	= path;
-	E_TWFS_FILE_TYPE	file_type	= E_TWFS_FILE_REG;
+	struct twfs_path_capture	capture;
+	E_TWFS_FILE_TYPE			file_type;
+
+	file_type = classifyTwfsPath( path, &capture );
+
+	copyTwfsPathSpan( first_sname,
+					  DEF_TWAPI_MAX_SCREEN_NAME_LEN,
+					  &capture.sname[ 0 ] );
+	copyTwfsPathSpan( second_sname,
+					  DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1,
+					  &capture.sname[ 1 ] );
+	copyTwfsPathSpan( third_sname,
+					  DEF_TWAPI_MAX_SCREEN_NAME_LEN,
+					  &capture.sname[ 2 ] );
+
+	return( file_type );
+}
 
-	i		= 0;
-	total	= 0;
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getScreenNameFromPath
+	Input		:const char *path
+				 < path over twitter file system >
+				 char *screen_name
+				 < screen name buffer to output >
+	Output		:char *screen_name
+				 < first screen name >
+	Return		:void
+	Description	:get first screen name from path
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void getScreenNameFromPath( const char *path, char *screen_name )
+{
+	int			i;
+	const char	*user_path = path;
 
-	/* ------------------------------------------------------------------------ */
-	/* skip "/"																	*/
-	/* ------------------------------------------------------------------------ */
+	i = 0;
+	
+	/* skip root	*/
 	user_path++;
-	total++;
 
-	if( *user_path == '\0' )
+	while( *user_path != '/' )
 	{
-		return( E_TWFS_FILE_REG );
+		if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= i )
+		{
+			screen_name[ i - 1 ] = '\0';
+			return;
+		}
+		if( *user_path == '\0' )
+		{
+			screen_name[ i ] = '\0';
+			return;
+		}
+
+		screen_name[ i ] = *user_path;
+		i++;
+		user_path++;
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* check whethre authorized user directory									*/
-	/* ------------------------------------------------------------------------ */
-	getScreenNameFromPath( path, first_sname );
+	screen_name[ i ] = '\0';
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getDirName
+	Input		:char *dir_name
+				 < directory path >
+				 const char *file_path
+				 < file path to get directory paht >
+	Output		:char *dir_name
+				 < direcotry path >
+	Return		:void
+	Description	:get directory path from file path
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void getDirName( char *dir_name, const char *file_path )
+{
+	int		file_path_len;
+	int		i;
+	char	*p;
 
-	if( strncmp( first_sname, getTwapiScreenName( ), DEF_TWFS_PATH_MAX ) == 0 )
+	file_path_len = strnlen( file_path, DEF_TWFS_PATH_MAX );
+
+	if( ( file_path[ 0 ] == '/' ) && file_path_len == 1 )
 	{
-		auth_user = true;
+		dir_name[ 0 ] = file_path[ 0 ];
+		dir_name[ 1 ] = '\0';
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* skip "screen_name"														*/
-	/* ------------------------------------------------------------------------ */
-	while( *user_path != '/' )
+	for( i = 0 ; i < file_path_len ; i++ )
 	{
-		if( ( *user_path == '\0' ) || ( DEF_TWFS_PATH_MAX <= total ) )
-		{
-			return( E_TWFS_FILE_FIRST_SNAME );
-		}
-
-		user_path++;
-		total++;
+		dir_name[ i ] = file_path[ i ];
 	}
 
-	/* skip "/"		*/
-	user_path++;
-	total++;
+	dir_name[ i ] = '\0';
+	p = &dir_name[ i ];
 
-	if( *user_path == '\0' )
+	while( p-- )
 	{
-		return( E_TWFS_FILE_REG );
+		if( *p == '/' )
+		{
+			break;
+		}
 	}
 
+	*( p + 1 ) = '\0';
+}
 
-	/* ------------------------------------------------------------------------ */
-	/* check second file/directory												*/
-	/* ------------------------------------------------------------------------ */
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsPathFromRootDir
+	Input		:const char *root_path
+				 < root absolute path >
+				 char *twfs_path
+				 < twfs absolute path from mount point >
+	Outpu		:void
+	Return		:int
+				 < status >
+	Description	:remove a directory
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsPathFromRootDir( const char *root_path, char *twfs_path )
+{
+	int			i;
+	int			root_len;
+	const char	*root_dir	= getRootDirPath( );
+	const char	*path		= root_path;
+	
+	root_len = getRootDirLength( );
 	i = 0;
-	while( 1 )
+	while( *root_dir == *path )
 	{
-		if( DEF_TWFS_PATH_MAX <= total )
+		if( ( *root_dir == '\0' ) || ( *path == '\0' ) )
 		{
-			return( E_TWFS_FILE_REG );
+			break;
 		}
-		/* -------------------------------------------------------------------- */
-		/* check tweet, timeline files											*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
-		{
-			path_cmp[ i ] = *user_path;
-			if( strncmp( path_cmp, DEF_TWFS_PATH_TWEET, DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				if( auth_user )
-				{
-					return( E_TWFS_FILE_AUTH_TWEET );
-				}
-				
-				return( E_TWFS_FILE_TWEET );
-			}
-			if( strncmp( path_cmp, DEF_TWFS_PATH_TL, DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				if( auth_user )
-				{
-					return( E_TWFS_FILE_AUTH_TL );
-				}
-
-				return( E_TWFS_FILE_TL );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_USER_TL,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				if( auth_user )
-				{
-					return( E_TWFS_FILE_AUTH_USER_TL );
-				}
-
-				return( E_TWFS_FILE_USER_TL );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_BLOCKS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				return( E_TWFS_DIR_BLOCKS );
-			}
+		root_dir++;
+		path++;
+		i++;
+	}
+	
+	if( ( root_len != i ) || ( *path != '/' ) )
+	{
+		return( -1 );
+	}
+	
+	twfs_path[ 0 ] = '/';
+	i = 0;
+	while( *path != '\0' )
+	{
+		twfs_path[ i ] = *path;
+		i++;
+		path++;
+	}
 
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_NOTI,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				return( E_TWFS_DIR_NOTI );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FAV,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				return( E_TWFS_DIR_FAV );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_RETWEET,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				return( E_TWFS_DIR_RTW );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_DM,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				//if( auth_user )
-				//{
-				//	return( E_TWFS_DIR_AUTH_DM );
-				//}
-				return( E_TWFS_DIR_DM );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FOLLOWERS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				//if( auth_user )
-				//{
-				//	return( E_TWFS_DIR_AUTH_FL );
-				//}
-				return( E_TWFS_DIR_FL );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FRIENDS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				//if( auth_user )
-				//{
-				//	return( E_TWFS_DIR_AUTH_FR );
-				//}
-				return( E_TWFS_DIR_FR );
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LISTS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+	if( 0 < i )
+	{
+		if( 1 < i )
+		{
+			if( twfs_path[ i - 1 ] == '/' )
 			{
-				return( E_TWFS_DIR_LISTS );
+				twfs_path[ i - 1 ] = '\0';
 			}
-
-			return( E_TWFS_FILE_REG );
 		}
-		/* -------------------------------------------------------------------- */
-		/* check follower, following, direct_messages, lists directories		*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '/' )
-		{
-			path_cmp[ i ] = '\0';
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_STATUS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_STATUS;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_DM,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_DM;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FOLLOWERS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_FL;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FRIENDS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_FR;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LISTS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_LISTS;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_NOTI,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_NOTI;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_RETWEET,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_RTW;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_ACCOUNT,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_ACCOUNT;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_FAV,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_FAV;
-				break;
-			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_BLOCKS,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				file_type = E_TWFS_DIR_BLOCKS;
-				break;
-			}
+		twfs_path[ i ] = '\0';
+	}
+	
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsPathFromMountDir
+	Input		:const char *mount_path
+				 < mount absolute path >
+				 char *twfs_path
+				 < twfs absolute path from mount point >
+	Outpu		:void
+	Return		:int
+				 < status >
+	Description	:remove a directory
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsPathFromMountDir( const char *mount_path, char *twfs_path )
+{
+	int			i;
+	int			mount_len;
+	const char	*mount_dir	= getMountDirPath( );
+	const char	*path		= mount_path;
+	
+	mount_len = getMountDirLength( );
+	i = 0;
+	while( *mount_dir == *path )
+	{
+		if( ( *mount_dir == '\0' ) || ( *path == '\0' ) )
+		{
+			break;
 		}
-		path_cmp[ i ] = *user_path;
+		mount_dir++;
+		path++;
 		i++;
-		total++;
-		user_path++;
 	}
-
-	/* skip "/"		*/
-	user_path++;
-
-	if( *user_path == '\0' )
+	
+	if( ( mount_len != i ) || ( *path != '/' ) )
 	{
-		return( E_TWFS_FILE_REG );
+		return( -1 );
 	}
-
-	/* ------------------------------------------------------------------------ */
-	/* check third path															*/
-	/* ------------------------------------------------------------------------ */
+	
+	twfs_path[ 0 ] = '/';
 	i = 0;
-	while( 1 )
+	while( *path != '\0' )
 	{
-		if( DEF_TWFS_PATH_MAX <= total )
-		{
-			return( E_TWFS_FILE_REG );
-		}
+		twfs_path[ i ] = *path;
+		i++;
+		path++;
+	}
 
-		/* -------------------------------------------------------------------- */
-		/* check status, lists, direct_message/send, recv files					*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
+	if( 0 < i )
+	{
+		if( 1 < i )
 		{
-			path_cmp[ i ] = '\0';
-			/* copy second screen name or file	*/
-			for( j = 0 ; j < i ; j++ )
+			if( twfs_path[ i - 1 ] == '/' )
 			{
-				if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= j )
-				{
-					j--;
-					break;
-				}
-				second_sname[ j ] = path_cmp[ j ];
+				twfs_path[ i - 1 ] = '\0';
 			}
-			second_sname[ j ] = '\0';
+		}
+		twfs_path[ i ] = '\0';
+	}
+	
+	return( 0 );
+}
 
-			if( file_type == E_TWFS_DIR_STATUS )
-			{
-				if( isTwitterId( path_cmp ) )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/status/[any]							*/
-						return( E_TWFS_FILE_AUTH_STATUS );
-					}
-					/* [screen_name]/status/[any]								*/
-					return( E_TWFS_FILE_STATUS );
-				}
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:readTweet
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 struct twfs_file
+				 < twfs file information >
+				 const char *screen_name
+				 < screen name for user timeline >
+				 const char *last
+				 < last received tweet id >
+				 const char *slug
+				 < slug used for only lists operations >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:read home or user timeline of authenticated user. number of
+				 tweets read at once can be set by DEF_TWFS_XATTR_PAGE_COUNT
+				 attribute of the file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int readTweet( E_TWFS_REQ request,
+			   struct ssl_session *session,
+			   struct twfs_file *twfs_file,
+			   const char *screen_name,
+			   const char *last,
+			   const char *slug )
+{
+	int		count;
 
-				return( E_TWFS_FILE_REG );
-			}
-			/* [screen_name]/lists/[any]										*/
-			if( file_type == E_TWFS_DIR_LISTS )
-			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/lists/list								*/
-						return( E_TWFS_FILE_AUTH_LISTS_LIST );
-					}
+	switch( request )
+	{
+	case	E_TWFS_REQ_READ_FAV_LIST:
+	case	E_TWFS_REQ_READ_AUTH_FAV_LIST:
+		count = getTwfsPageCount( twfs_file, DEF_TWOPE_MAX_FAV_COUNT );
+		break;
+	case	E_TWFS_REQ_READ_LISTS_SUB_TL:
+	case	E_TWFS_REQ_READ_LISTS_OWN_TL:
+	case	E_TWFS_REQ_READ_LISTS_ADD_TL:
+		count = getTwfsPageCount( twfs_file, DEF_TWOPE_MAX_LISTS_TWEET_COUNT );
+		break;
+	default:
+		count = getTwfsPageCount( twfs_file, DEF_TWOPE_MAX_TWEET_COUNT );
+		break;
+	}
 
-					return( E_TWFS_FILE_LISTS_LIST );
-				}
-#endif
-				/* [screen_name]/lists/[any]									*/
-				return( E_TWFS_FILE_REG );
-			}
+	return( readTweetPage( request, session, twfs_file,
+						   screen_name, last, NULL, slug,
+						   count, 0, false ) );
+}
 
-			if( file_type == E_TWFS_DIR_DM )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DM_MSG,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/direct_message/message					*/
-						return( E_TWFS_FILE_AUTH_DM_MSG );
-					}
+/*
+================================================================================
+	Function	:readTweetPage
+	Input		:E_TWFS_REQ request
+				 < request to read >
+				 struct ssl_session *session
+				 < ssl session >
+				 struct twfs_file
+				 < twfs file information >
+				 const char *screen_name
+				 < screen name for user timeline >
+				 const char *last
+				 < last received tweet id >
+				 const char *max_id
+				 < oldest tweet id to read, NULL:latest >
+				 const char *slug
+				 < slug used for only lists operations >
+				 int count
+				 < number of tweets to read at once >
+				 int depth
+				 < pages read before this page >
+				 bool older
+				 < true:save the page before the oldest record >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:read a page of timeline. older pages are read back to last
+				 and saved before the page
+================================================================================
+*/
+static int readTweetPage( E_TWFS_REQ request,
+						  struct ssl_session *session,
+						  struct twfs_file *twfs_file,
+						  const char *screen_name,
+						  const char *last,
+						  const char *max_id,
+						  const char *slug,
+						  int count,
+						  int depth,
+						  bool older )
+{
+	typedef enum
+	{
+		E_TW_CREATED_AT,			// created_at
+		E_TW_ID_STR,				// id_str
+		E_TW_IN_RE_TO_SNAME,		// in_reply_to_screen_name
+		E_TW_IN_RE_TO_SIDS,			// in_reply_to_status_id_str
+		E_TW_RETWEETED,				// retweeted
+		E_TW_FAVORITED,				// favorited
+		E_TW_RTW_STATUS,			// retweeted_status/
+		E_TW_FAV_CNT,				// favorite_count
+		E_TW_RTW_CNT,				// retweet_count
+		E_TW_RTW_STATUS_CREATED_AT,	// retweeted_status/created_at
+		E_TW_RTW_STATUS_ID_STR,		// retweeted_status/id_str
+		E_TW_RTW_STATUS_TEXT,		// retweeted_status/text
+		E_TW_RTW_STATUS_FAV_CNT,	// retweeted_status/favorite_count
+		E_TW_RTW_STATUS_RTW_CNT,	// retweeted_status/retweet_count
+		E_TW_RTW_STATUS_USR,		// retweeted_status/user/
+		E_TW_RTW_STATUS_USR_ID_STR,	// retweeted_status/user/id_str
+		E_TW_RTW_STATUS_USR_NAME,	// retweeted_status/user/name
+		E_TW_RTW_STATUS_USR_SNAME,	// retweeted_status/user/sname
+		E_TW_TEXT,					// text
+		E_TW_USER,					// user/
+		E_TW_USR_ID_STR,			// user/id_str
+		E_TW_USR_NAME,				// user/name
+		E_TW_USR_SNAME,				// user/screen_name
+		E_TW_NUM,
+	} E_OBJ;
 
-					/* [screen_name]/direct_message/message						*/
-					return( E_TWFS_FILE_DM_MSG );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DM_SEND_TO,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/direct_message/send_to					*/
-						return( E_TWFS_FILE_AUTH_DM_SEND_TO );
-					}
+	struct new_tws
+	{
+		size_t			length;		// length of all texts except for rtw message
+		uint8_t			*tweets;
+		int				num_tws;
+		int				text_len;	// current text length
+	};
 
-					/* [screen_name]/direct_message/send_to						*/
-					return( E_TWFS_FILE_DM_SEND_TO );
-				}
-				return( E_TWFS_FILE_REG );
-			}
+	struct http_ctx		hctx;
+	struct json_ana		ana;
+	int					result;
+	int					recv_length;
+	int					i;
+	int					fd;
+	struct new_tws		new_tws = { 0, NULL, 0, 0};
+	struct jnode		root;
+	struct jnode		node[ E_TW_NUM ];
+	size_t				tl_size;
+	char				rs_created_at[ ]	= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_TW_CREATED_AT;
+	char				rs_id_str[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_TW_ID_STR;
+	char				rs_text[ ]			= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_TW_TEXT;
+	char				rs_fav_cnt[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_TW_FAV_CNT;
+	char				rs_rtw_cnt[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_TW_RTW_CNT;
+	char				rs_usr[ ]			= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_USR;
+	char				rs_usr_idstr[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_ID_STR;
+	char				rs_usr_name[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_NAME;
+	char				rs_usr_screen_name[ ]="/" DEF_TWAPI_OBJ_TW_RTW_STATUS
+											  "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_SNAME;
+	char				usr_idstr[ ]		= "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_ID_STR;
+	char				usr_name[ ]			= "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_NAME;
+	char				usr_screen_name[ ]	= "/" DEF_TWAPI_OBJ_USR
+											  "/" DEF_TWAPI_OBJ_USR_SNAME;
 
-			if( file_type == E_TWFS_DIR_FL )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_FF_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					/* [screen_name]/follower/list								*/
-					/* [authorized]/follower/list								*/
-					return( E_TWFS_FILE_FL_LIST );
-				}
-
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_FF_DOT_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FL_DOT_LIST );
-				}
-				/* [authorized]/follower/[follower]/							*/
-				if( auth_user )
-				{
-					return( E_TWFS_DIR_AUTH_FL_FL );
-				}
-				/* [screen_name]/follower/[follower]/							*/
-				return( E_TWFS_DIR_FL_FL );
-			}
-			if( file_type == E_TWFS_DIR_FR )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_FF_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					/* [screen_name]/following/list								*/
-					/* [authorized]/following/list								*/
-					return( E_TWFS_FILE_FR_LIST );
-				}
-				
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_FF_DOT_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FR_DOT_LIST );
-				}
-				/* [authorized]/following/[follower]/							*/
-				if( auth_user )
-				{
-					return( E_TWFS_DIR_AUTH_FR_FR );
-				}
-				/* [screen_name]/following/[follower]/							*/
-				return( E_TWFS_DIR_FR_FR );
-			}
-
-			if( file_type == E_TWFS_DIR_NOTI )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_AT_TW,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/notifications/@tweet					*/
-						return( E_TWFS_FILE_AUTH_NOTI_AT_TW );
-					}
-
-					/* [screen_name]/notifications/@tweet						*/
-					return( E_TWFS_FILE_NOTI_AT_TW );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_RTW,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/notifications/retweet_of_me				*/
-						return( E_TWFS_FILE_AUTH_NOTI_RTW );
-					}
-
-					/* [screen_name]/notifications/retweet_of_me				*/
-					return( E_TWFS_FILE_NOTI_RTW );
-				}
-				return( E_TWFS_FILE_REG );
-			}
-
-			if( file_type == E_TWFS_DIR_RTW )
-			{
-				if( isTwitterId( path_cmp ) )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_RTW );
-					}
-
-					return( E_TWFS_FILE_RTW );
-				}
-				return( E_TWFS_FILE_REG );
-			}
-
-			if( file_type == E_TWFS_DIR_ACCOUNT )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_PROFILE,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/account/profile							*/
-						return( E_TWFS_FILE_AUTH_ACC_PROFILE );
-					}
-
-					/* [screen_name]/account/profile							*/
-					return( E_TWFS_FILE_ACC_PROFILE );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_SETTINGS,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/account/settings						*/
-						return( E_TWFS_FILE_AUTH_ACC_SETTING );
-					}
-
-					/* [screen_name]/account/settings							*/
-					return( E_TWFS_FILE_ACC_SETTING );
-				}
-				return( E_TWFS_FILE_REG );
-			}
-
-			if( file_type == E_TWFS_DIR_FAV )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_FAV_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/favorites/list							*/
-						return( E_TWFS_FILE_AUTH_FAV_LIST );
-					}
-
-					/* [screen_name]/favorites/list								*/
-					return( E_TWFS_FILE_FAV_LIST );
-				}
-
-				if( isTwitterId( path_cmp ) )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_FAV_TWEET );
-					}
-
-					return( E_TWFS_FILE_FAV_TWEET );
-				}
-
-				return( E_TWFS_FILE_REG );
-			}
-			if( file_type == E_TWFS_DIR_BLOCKS )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_BLOCK_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/blocks/list								*/
-						return( E_TWFS_FILE_AUTH_BLOCKS_LIST );
-					}
-
-					/* [screen_name]/blocks/list								*/
-					return( E_TWFS_FILE_BLOCKS_LIST );
-				}
-
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DOT_BLOCK_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						/* [authorized]/blocks/.list							*/
-						return( E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST );
-					}
-
-					/* [screen_name]/blocks/.list								*/
-					return( E_TWFS_FILE_DOT_BLOCKS_LIST );
-				}
-
-				if( auth_user )
-				{
-					return( E_TWFS_FILE_AUTH_BLOCKS );
-				}
-			}
-			return( E_TWFS_FILE_REG );
+	/* ------------------------------------------------------------------------ */
+	/* request get statuses/home_timeline										*/
+	/* ------------------------------------------------------------------------ */
+	switch( request )
+	{
+	case	E_TWFS_REQ_READ_HOME_TL:
+	default:
+		if( ( result = getHomeTimeLine( session, &hctx,
+										count, last, max_id ) ) < 0 )
+		{
+			return( result );
 		}
-		/* -------------------------------------------------------------------- */
-		/* check screen_name directory											*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '/' )
+		break;
+	case	E_TWFS_REQ_READ_HOME_TWEET:
+		if( ( result = getMentionsTimeLine( session, &hctx,
+											count, last, max_id ) ) < 0 )
 		{
-			path_cmp[ i ] = '\0';
-			switch( file_type )
-			{
-			/* skip screen_name folder		*/
-			case	E_TWFS_DIR_DM:
-				file_type = E_TWFS_DIR_DM_FR;
-				break;
-			case	E_TWFS_DIR_FL:
-				file_type = E_TWFS_DIR_FL_FL;
-				break;
-			case	E_TWFS_DIR_FR:
-				file_type = E_TWFS_DIR_FR_FR;
-				break;
-			case	E_TWFS_DIR_LISTS:
-				/* [screen_name]/lists/subscriptions/							*/
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DIR_SUB,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					file_type = E_TWFS_DIR_LISTS_SUB;
-				}
-				/* [screen_name]/lists/my_list/									*/
-				else if( strncmp( path_cmp,
-								  DEF_TWFS_PATH_DIR_OWN,
-								  DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					file_type = E_TWFS_DIR_LISTS_OWN;
-				}
-				else if( strncmp( path_cmp,
-								  DEF_TWFS_PATH_DIR_ADD,
-								  DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					file_type = E_TWFS_DIR_LISTS_ADD;
-				}
-				else
-				{
-					return( E_TWFS_FILE_REG );
-				}
-
-				break;
-			default:
-				return( E_TWFS_FILE_REG );
-			}
-			/* copy second screen name	*/
-			for( j = 0 ; j < i ; j++ )
-			{
-				if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= j )
-				{
-					j--;
-					break;
-				}
-				second_sname[ j ] = path_cmp[ j ];
-			}
-			second_sname[ j ] = '\0';
-			break;
+			return( result );
 		}
-
-		path_cmp[ i ] = *user_path;
-		i++;
-		total++;
-		user_path++;
+		break;
+	case	E_TWFS_REQ_READ_USER_TL:
+		if( ( result = getUserTimeLine( session, &hctx,
+										screen_name,
+										count, last, max_id ) ) < 0 )
+		{
+			return( result );
+		}
+		break;
+	case	E_TWFS_REQ_READ_MENTIONS_TL:
+		if( ( result = getMentionsTimeLine( session, &hctx,
+											count, last, max_id ) ) < 0 )
+		{
+			return( result );
+		}
+		break;
+	case	E_TWFS_REQ_READ_RTW_OF_ME_TL:
+		if( ( result = getRetweetOfMeTimeLine( session, &hctx,
+											   count, last, max_id ) ) < 0 )
+		{
+			return( result );
+		}
+		break;
+	case	E_TWFS_REQ_READ_FAV_LIST:
+	case	E_TWFS_REQ_READ_AUTH_FAV_LIST:
+		if( ( result = getFavoritesList( session, &hctx,
+										 count, last, max_id ) ) < 0 )
+		{
+			return( result );
+		}
+		break;
+	case	E_TWFS_REQ_READ_LISTS_SUB_TL:
+	case	E_TWFS_REQ_READ_LISTS_OWN_TL:
+	case	E_TWFS_REQ_READ_LISTS_ADD_TL:
+		logMessage( " get lists timeline\n" );
+		if( ( result = getListsTimeLine( session,
+										 &hctx,
+										 slug,
+										 screen_name,
+										 count,
+										 last,
+										 max_id ) ) < 0 )
+		{
+			return( result );
+		}
+		break;
 	}
 
-	/* skip "/"		*/
-	user_path++;
-	total++;
-
-	if( *user_path == '\0' )
+	if( hctx.content_length == 0 )
 	{
-		return( E_TWFS_FILE_REG );
+		return( 0 );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* check forth path															*/
+	/* buffer for new tweets													*/
 	/* ------------------------------------------------------------------------ */
-	i = 0;
-	while( 1 )
-	{
-		if( DEF_TWFS_PATH_MAX <= total )
-		{
-			return( E_TWFS_FILE_REG );
-		}
+	new_tws.tweets = mmap( NULL, hctx.content_length + 1,
+						   PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
 
-		/* -------------------------------------------------------------------- */
-		/* check direct_message/{send, recv}, {follower, friends}/{tweet, tl}	*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
+	if( new_tws.tweets == MAP_FAILED )
+	{
+		recv_length = hctx.content_length;
+		while( recv_length-- )
 		{
-			path_cmp[ i ] = '\0';
-			if( file_type == E_TWFS_DIR_DM_FR )
+			if( recvSSLMessage( session, ( unsigned char* )rs_created_at, 1 ) < 0 )
 			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DM_MSG,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_DM_FR_MSG );
-					}
+				break;
+			}
+		}
 
-					return( E_TWFS_FILE_DM_FR_MSG );
-				}
+		logMessage( "cannot map [new_tws]%s\n", strerror( errno ) );
 
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DM_SEND_TO,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_DM_FR_SEND_TO );
-					}
+		return( -1 );
+	}
 
-					return( E_TWFS_FILE_DM_FR_SEND_TO );
-				}
+	/* ------------------------------------------------------------------------ */
+	/* receive tweets of json structure											*/
+	/* ------------------------------------------------------------------------ */
+	if( recvSSLMessage( session,
+						( unsigned char* )new_tws.tweets,
+						hctx.content_length ) < 0 )
+	{
+		munmap( new_tws.tweets, hctx.content_length + 1 );
+		//disconnectSSLServer( session );
+		return( -1 );
+	}
 
-				if( isTwitterId( path_cmp ) )
-				{
-					for( int len = 0 ;
-						 len < DEF_TWAPI_MAX_SCREEN_NAME_LEN ;
-						 len++ )
-					{
-						second_sname[ len ] = path_cmp[ len ];
-						if( path_cmp[ len ] == '\0' )
-						{
-							break;
-						}
-					}
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_DM_FR_STATUS );
-					}
+	//disconnectSSLServer( session );
 
-					return( E_TWFS_FILE_DM_FR_STATUS );
-				}
-				
-				//return( E_TWFS_DIR_DM_FR );
-			}
-			if( file_type == E_TWFS_DIR_FL_FL )
-			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TWEET,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FL_TWEET );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TL,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FL_TL );
-				}
-#endif
-				//return( E_TWFS_DIR_FL_FL );
-			}
-			if( file_type == E_TWFS_DIR_FR_FR )
-			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TWEET,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FR_TWEET );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TL,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FR_TL );
-				}
-#endif
-				//return( E_TWFS_DIR_FR_FR );
-			}
+	//logMessage( "%s\n", new_tws );
 
-			if( file_type == E_TWFS_DIR_FL_FL )
-			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TWEET,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FL_TWEET );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_TL,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					return( E_TWFS_FILE_FL_TL );
-				}
-#endif
-				//return( E_TWFS_DIR_FL_FL );
-			}
+	/* ------------------------------------------------------------------------ */
+	/* make json lookup structure												*/
+	/* ------------------------------------------------------------------------ */
+	initJsonRoot( &root );
 
-#if 0
-			if( file_type == E_TWFS_DIR_LISTS_SUB )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_SUB_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_SUB_LIST );
-					}
-					return( E_TWFS_FILE_LISTS_SUB_LIST );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_SUB_SUBSCRIBERS,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_SUB_SUB );
-					}
-					return( E_TWFS_FILE_LISTS_SUB_SUB );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_SUB_MEMBERSHIPS,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_SUB_MEM );
-					}
-					return( E_TWFS_FILE_LISTS_SUB_MEM );
-				}
-			}
+	/* created_at																*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_CREATED_AT,
+					 &node[ E_TW_CREATED_AT				]	);
+	/* id_str																	*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_ID_STR,
+					 &node[ E_TW_ID_STR					]	);
+	/* in_reply_to_screen_name													*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_IN_RE_TO_SNAME,
+					 &node[ E_TW_IN_RE_TO_SNAME			]	);
+	/* in_reply_to_id_str														*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_IN_RE_TO_SIDS,
+					 &node[ E_TW_IN_RE_TO_SIDS			]	);
+	/* retweeted																*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RETWEETED,
+					 &node[ E_TW_RETWEETED				]	);
+	/* favorited																*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_FAVORITED,
+					 &node[ E_TW_FAVORITED				]	);
+	/* retweeted_status/														*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RTW_STATUS,
+					 &node[ E_TW_RTW_STATUS				]	);
+	/* favorite_count															*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_FAV_CNT,
+					 &node[ E_TW_FAV_CNT				]	);
+	/* retweet_count															*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RTW_CNT,
+					 &node[ E_TW_RTW_CNT				]	);
+	/* retweeted_status/created_at												*/
+	insertJsonNodes( &root, rs_created_at,
+					 &node[ E_TW_RTW_STATUS_CREATED_AT	]	);
+	/* retweeted_status/id_str													*/
+	insertJsonNodes( &root, rs_id_str,
+					 &node[ E_TW_RTW_STATUS_ID_STR		]	);
+	/* retweeted_status/text													*/
+	insertJsonNodes( &root, rs_text,
+					 &node[ E_TW_RTW_STATUS_TEXT		]	);
+	/* retweeted_status/favorite_count											*/
+	insertJsonNodes( &root, rs_fav_cnt,
+					 &node[ E_TW_RTW_STATUS_FAV_CNT		]	);
+	/* retweeted_status/retweet_count											*/
+	insertJsonNodes( &root, rs_rtw_cnt,
+					 &node[ E_TW_RTW_STATUS_RTW_CNT		]	);
+	/* retweeted_status/usr/													*/
+	insertJsonNodes( &root, rs_usr,
+					 &node[ E_TW_RTW_STATUS_USR			]	);
+	/* retweeted_status/usr/id_str												*/
+	insertJsonNodes( &root, rs_usr_idstr,
+					 &node[ E_TW_RTW_STATUS_USR_ID_STR	]	);
+	/* retweeted_status/usr/name												*/
+	insertJsonNodes( &root, rs_usr_name,
+					 &node[ E_TW_RTW_STATUS_USR_NAME	]	);
+	/* retweeted_status/usr/screen_name											*/
+	insertJsonNodes( &root, rs_usr_screen_name,
+					 &node[ E_TW_RTW_STATUS_USR_SNAME	]	);
+	/* text																		*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_TEXT,
+					 &node[ E_TW_TEXT					]	);
+	/* user/																	*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_USER,
+					 &node[ E_TW_USER					]	);
+	/* user/id_str																*/
+	insertJsonNodes( &root, usr_idstr,
+					 &node[ E_TW_USR_ID_STR				]	);
+	/* user/name																*/
+	insertJsonNodes( &root, usr_name,
+					 &node[ E_TW_USR_NAME				]	);
+	/* user/screen_name															*/
+	insertJsonNodes( &root, usr_screen_name,
+					 &node[ E_TW_USR_SNAME				]	);
+	
+	/* ------------------------------------------------------------------------ */
+	/* prepare for analyzing json structure										*/
+	/* ------------------------------------------------------------------------ */
+	initJsonAnalysisCtx( &ana );
 
-			if( file_type == E_TWFS_DIR_LISTS_OWN )
-			{
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_OWN_LIST,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_OWN_LIST );
-					}
-					return( E_TWFS_FILE_LISTS_OWN_LIST );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_OWN_SUBSCRIBERS,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_OWN_SUB );
-					}
-					return( E_TWFS_FILE_LISTS_OWN_SUB );
-				}
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_OWN_MEMBERSHIPS,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_OWN_MEM );
-					}
-					return( E_TWFS_FILE_LISTS_OWN_MEM );
-				}
-			}
-#endif
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_SUB_LIST,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+	/* size of records got by this page is added to tl size					*/
+	tl_size = twfs_file->tl_size;
+
+	/* ------------------------------------------------------------------------ */
+	/* receive body and analyze json structre									*/
+	/* ------------------------------------------------------------------------ */
+	while( ana.length < hctx.content_length )
+	{
+		char				buffer[ 1024 ];
+		int					buf_len;
+		int					ana_result;
+		struct twfs_status	status;
+
+		ana_result = analyzeJson( session, &hctx,
+								  ( uint8_t* )new_tws.tweets,
+								  &ana, &root,
+								  0,
+								  ( uint8_t* )buffer, sizeof( buffer ) );
+
+		if( ana_result < 0 )
+		{
+			for( i = 0 ; i < E_TW_NUM ; i++ )
 			{
-				/* [screen_name]/lists/subscriptions/list						*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LIST );
-				}
-				/* [screen_name]/lists/my_list/list								*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LIST );
-				}
-				/* [screen_name]/lists/added/list								*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LIST );
-				}
+				free( node[ i ].value );
+				node[ i ].value = NULL;
 			}
+			logMessage( "error analyzing json\n" );
+			munmap( new_tws.tweets, hctx.content_length + 1 );
+			return( -1 );
+		}
 
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_SUB_DOT_LIST,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+		if( ( node[ E_TW_USR_SNAME ].value	== NULL ) ||
+			( node[ E_TW_ID_STR ].value		== NULL ) ||
+			( node[ E_TW_USR_NAME ].value	== NULL ) ||
+			( node[ E_TW_RTW_CNT ].value	== NULL ) ||
+			( node[ E_TW_FAV_CNT ].value	== NULL ) )
+		{
+			for( i = 0 ; i < E_TW_NUM ; i++ )
 			{
-				/* [screen_name]/lists/subscriptions/.list						*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_DOT_LIST );
-				}
-				/* [screen_name]/lists/my_list/.list							*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_DOT_LIST );
-				}
-				/* [screen_name]/lists/added/.list								*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_DOT_LIST );
-				}
+				free( node[ i ].value );
+				node[ i ].value = NULL;
 			}
 
-			if( ( file_type == E_TWFS_DIR_LISTS_SUB ) ||
-				( file_type == E_TWFS_DIR_LISTS_OWN ) ||
-				( file_type == E_TWFS_DIR_LISTS_ADD ) )
+			if( ana_result == 0 )
 			{
-				//for( j = 0 ; j < DEF_TWAPI_MAX_SCREEN_NAME_LEN ; j++ )
-				for( j = 0 ; j < DEF_REST_ACTUAL_SLUG_MAX_LENGTH ; j++ )
-				{
-					second_sname[ j ] = path_cmp[ j ];
-					if( path_cmp[ j ] == '\0' )
-					{
-						break;
-					}
-				}
-
-#if 0
-				for( int len = j ; 0 < len ; len++ )
-				{
-					if( second_sname[ len ] == '@' )
-					{
-						second_sname[ len ] = '\0';
-						break;
-					}
-				}
-#endif
-
-				if( file_type == E_TWFS_DIR_LISTS_SUB )
-				{
-					return( E_TWFS_DIR_LISTS_SUB_LNAME );
-				}
-
-				if( file_type == E_TWFS_DIR_LISTS_OWN )
+				if( new_tws.num_tws == 0 )
 				{
-					if( auth_user )
-					{
-						return( E_TWFS_DIR_AUTH_LISTS_OWN_LNAME );
-					}
-					return( E_TWFS_DIR_LISTS_OWN_LNAME );
+					logMessage( "faile to readTweet\n" );
+					munmap( new_tws.tweets, hctx.content_length + 1 );
+					return( -1 );
 				}
-
-				if( file_type == E_TWFS_DIR_LISTS_ADD )
+				else
 				{
-					return( E_TWFS_DIR_LISTS_ADD_LNAME );
+					break;
 				}
 			}
+			continue;
+		}
 
-			return( E_TWFS_FILE_REG );
+		for( i = 0 ; i < E_TW_NUM ; i++ )
+		{
+			logMessage( "%s:%s\n", node[i].obj, node[i ].value );
 		}
 
 		/* -------------------------------------------------------------------- */
-		/* check {follower, friends}/direct_message								*/
+		/* path to [screen_name]/status/[tweet id]								*/
 		/* -------------------------------------------------------------------- */
-		if( *user_path == '/' )
+		if( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL )
 		{
-			path_cmp[ i ] = '\0';
-			if( file_type == E_TWFS_DIR_FL_FL )
-			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DIR_DM,
-							 DEF_TWFS_PATH_MAX ) == 0 )
-				{
-					file_type = E_TWFS_DIR_FL_FL_DM;
-					break;
-				}
-#endif
-				return( file_type );
-			}
-			if( file_type == E_TWFS_DIR_FR_FR )
+			/* retweet															*/
+			result = registerTwfsUser( node[ E_TW_RTW_STATUS_USR_ID_STR ].value,
+									   node[ E_TW_RTW_STATUS_USR_SNAME ].value );
+
+			if( result < 0 )
 			{
-#if 0
-				if( strncmp( path_cmp,
-							 DEF_TWFS_PATH_DIR_DM,
-							 DEF_TWFS_PATH_MAX ) == 0 )
+				for( i = 0 ; i < E_TW_NUM ; i++ )
 				{
-					file_type = E_TWFS_DIR_FR_FR_DM;
-					break;
+					free( node[ i ].value );
+					node[ i ].value = NULL;
 				}
-#endif
-				return( file_type );
-			}
 
-			if( ( file_type == E_TWFS_DIR_LISTS_SUB ) ||
-				( file_type == E_TWFS_DIR_LISTS_OWN ) ||
-				( file_type == E_TWFS_DIR_LISTS_ADD ) )
-			{
-				/* copy list slug name to second screen_name					*/
-				for( j = 0 ; j < i ; j++ )
+				if( ana_result == 0 )
 				{
-					//if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= j )
-					if( DEF_REST_ACTUAL_SLUG_MAX_LENGTH <= j )
+					if( new_tws.num_tws == 0 )
 					{
-						j--;
-						break;
+						munmap( new_tws.tweets, hctx.content_length + 1 );
+						return( -1 );
 					}
-					second_sname[ j ] = path_cmp[ j ];
+					break;
 				}
 
-				second_sname[ j ] = '\0';
+				/* try next tweet												*/
+				continue;
+			}
+		}
 
-#if 0
-				for( int len = j ; 0 < len ; len++ )
-				{
-					if( second_sname[ len ] == '@' )
-					{
-						second_sname[ len ] = '\0';
-						break;
-					}
-				}
-#endif
+		/* tweet itself															*/
+		result = registerTwfsUser( node[ E_TW_USR_ID_STR ].value,
+								   node[ E_TW_USR_SNAME ].value );
 
-				switch( file_type )
+		if( result < 0 )
+		{
+			for( i = 0 ; i < E_TW_NUM ; i++ )
+			{
+				free( node[ i ].value );
+				node[ i ].value = NULL;
+			}
+			
+			if( ana_result == 0 )
+			{
+				if( new_tws.num_tws == 0 )
 				{
-				case	E_TWFS_DIR_LISTS_SUB:
-					file_type = E_TWFS_DIR_LISTS_SUB_LNAME;
-					break;
-				case	E_TWFS_DIR_LISTS_OWN:
-					file_type = E_TWFS_DIR_LISTS_OWN_LNAME;
-					break;
-				case	E_TWFS_DIR_LISTS_ADD:
-					file_type = E_TWFS_DIR_LISTS_ADD_LNAME;
-				default:
-					break;
+					munmap( new_tws.tweets, hctx.content_length + 1 );
+					return( -1 );
 				}
-
-				/* go to fifth path name										*/
 				break;
 			}
-
-			return( E_TWFS_FILE_REG );
+			/* try next tweet													*/
+			continue;
 		}
 
-		path_cmp[ i ] = *user_path;
-		i++;
-		total++;
-		user_path++;
-	}
+		if( ( node[ E_TW_RTW_STATUS_ID_STR ].value != NULL ) &&
+			( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) )
+		{
+			snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
+					  getRootDirPath( ),
+					  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
+					  DEF_TWFS_PATH_DIR_STATUS,
+					  node[ E_TW_RTW_STATUS_ID_STR ].value );
+			logMessage( "Retweet file:%s\n", buffer );
+		}
+		else
+		{
+			snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
+					  getRootDirPath( ),
+					  node[ E_TW_USR_SNAME ].value,
+					  DEF_TWFS_PATH_DIR_STATUS,
+					  node[ E_TW_ID_STR ].value );
+			//logMessage( "tweet file:%s\n", buffer );
+		}
 
-	if( ( file_type != E_TWFS_DIR_LISTS_SUB_LNAME ) &&
-		( file_type != E_TWFS_DIR_LISTS_OWN_LNAME ) &&
-		( file_type != E_TWFS_DIR_LISTS_ADD_LNAME ) )
-	{
-		return( E_TWFS_FILE_REG );
-	}
+		fd = openFile( buffer, O_WRONLY | O_TRUNC | O_CREAT, 0660 );
 
-#if 0
-	/* skip "/"		*/
-	user_path++;
-	total++;
-
-	if( *user_path == '\0' )
-	{
-		return( E_TWFS_FILE_REG );
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* check fifth path															*/
-	/* ------------------------------------------------------------------------ */
-	i = 0;
-	while( 1 )
-	{
-		if( DEF_TWFS_PATH_MAX <= total )
-		{
-			return( E_TWFS_FILE_REG );
-		}
-
-		/* -------------------------------------------------------------------- */
-		/* check lists/{my_list, subs, added}/[lname]/[any]						*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
-		{
-			path_cmp[ i ] = '\0';
-
-			return( E_TWFS_FILE_REG );
-		}
-		/* -------------------------------------------------------------------- */
-		/* check [sname]/lists/{subs, my_list, added}/[lname]/[owner]			*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '/' )
+		if( 0 <= fd )
 		{
-			path_cmp[ i ] = '\0';
-
+			char	favorited;
+			char	retweeted;
+			/* ---------------------------------------------------------------- */
+			/* tweet id															*/
+			/* ---------------------------------------------------------------- */
+			status.len = 0;
+			buf_len = printTwfsStatus( &status, "id:%s\n",
+									   node[ E_TW_ID_STR ].value );
 #if 0
-			/* copy list owner to first screen_name								*/
-			for( j = 0 ; j < i ; j++ )
+			if( node[ E_TW_RTW_STATUS_USR_ID_STR ].value == NULL )
 			{
-				if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= j )
-				{
-					j--;
-					break;
-				}
-				third_sname[ j ] = path[ j ];
+				buf_len = snprintf( buffer, sizeof( buffer ),
+									"id:%s\n",
+									node[ E_TW_ID_STR ].value );
+			}
+			else
+			{
+				buf_len = snprintf( buffer, sizeof( buffer ),
+									"id:%s\n",
+									node[ E_TW_RTW_STATUS_ID_STR ].value );
 			}
-			third_sname[ j ] = '\0';
 #endif
-
-			/* [sname]/lists/subscriptions/[lname]/[owner]						*/
-			if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
+			new_tws.text_len = buf_len;
+			/* copy id															*/
+			memcpy( new_tws.tweets + new_tws.length,
+					node[ E_TW_ID_STR ].value,
+					buf_len - 4 );
+			new_tws.length += buf_len - 4;	// without '\n'
+			/* fill residual space												*/
+			buf_len = DEF_TWFS_ID_FIELD + DEF_TWFS_ID_FIELD_NEXT - ( buf_len - 4 );
+			memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
+			new_tws.length += buf_len;
+#if 0
+			/* ---------------------------------------------------------------- */
+			/* if retweeted														*/
+			/* ---------------------------------------------------------------- */
+			if( node[ E_TW_RTW_STATUS_USR_ID_STR ].value != NULL )
 			{
-				file_type = E_TWFS_DIR_LISTS_SUB_LNAME_OWNER;
-				break;
+				buf_len = snprintf( buffer, sizeof( buffer ),
+									"Retweeted by %s\n",
+									node[ E_TW_USR_NAME ].value );
+				writeFile( fd, ( const void* )buffer, buf_len );
 			}
-			/* [sname]/lists/my_list/[lname]/[owner]							*/
-			else if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
+#endif
+			/* ---------------------------------------------------------------- */
+			/* [user name] @ [screen name]										*/
+			/* ---------------------------------------------------------------- */
+			if( ( node[ E_TW_RTW_STATUS_USR_NAME ].value == NULL ) ||
+				( node[ E_TW_RTW_STATUS_USR_SNAME ].value == NULL ) )
 			{
-				file_type = E_TWFS_DIR_LISTS_OWN_LNAME_OWNER;
-				break;
+				buf_len = printTwfsStatus( &status, "%s @%s\n",
+										   node[ E_TW_USR_NAME ].value,
+										   node[ E_TW_USR_SNAME ].value );
+				new_tws.text_len += buf_len;
+				/* copy screeen name											*/
+				buf_len = node[ E_TW_USR_SNAME ].length;
+				memcpy( new_tws.tweets + new_tws.length,
+						node[ E_TW_USR_SNAME ].value,
+						buf_len );
+				new_tws.length += buf_len;
+				/* fill residual space											*/
+				buf_len = DEF_TWFS_SNAME_FIELD
+						  + DEF_TWFS_SNAME_FIELD_NEXT
+						  - buf_len;
+				memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
+				new_tws.length += buf_len;
+				/* fill RT flag													*/
+				*( new_tws.tweets + new_tws.length++ ) = 'N';
+				*( new_tws.tweets + new_tws.length++ ) = 0x00;
+				*( new_tws.tweets + new_tws.length++ ) = '0';
+				*( new_tws.tweets + new_tws.length++ ) = '0';
+				*( new_tws.tweets + new_tws.length++ ) = 0x00;
 			}
-			/* [sname]/lists/added/[lname]/[owner]								*/
-			else if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
+			else
 			{
-				file_type = E_TWFS_DIR_LISTS_ADD_LNAME_OWNER;
-				break;
+				buf_len = printTwfsStatus( &status, "%s @%s\n",
+										   node[ E_TW_RTW_STATUS_USR_NAME ].value,
+										   node[ E_TW_RTW_STATUS_USR_SNAME ].value );
+				new_tws.text_len += buf_len;
+				/* copy screeen name											*/
+				//buf_len = node[ E_TW_RTW_STATUS_USR_SNAME ].length;
+				buf_len = node[ E_TW_USR_SNAME ].length;
+				memcpy( new_tws.tweets + new_tws.length,
+						//node[ E_TW_RTW_STATUS_USR_SNAME ].value,
+						node[ E_TW_USR_SNAME ].value,
+						buf_len );
+				new_tws.length += buf_len;
+				/* fill residual space											*/
+				buf_len = DEF_TWFS_SNAME_FIELD
+						  + DEF_TWFS_SNAME_FIELD_NEXT
+						  - buf_len;
+				memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
+				new_tws.length += buf_len;
+				/* fill RT flag													*/
+				*( new_tws.tweets + new_tws.length++ ) = 'R';
+				*( new_tws.tweets + new_tws.length++ ) = 0x00;
+				//buf_len = node[ E_TW_RTW_STATUS_USR_SNAME ].length;
+				buf_len = node[ E_TW_USR_SNAME ].length;
+				buf_len += sizeof( DEF_TWFS_RTW_MESSAGE ) - 1;
+				buf_len++;		// for '\n'
+				logMessage( "retweet text len :%d\n", buf_len );
+				buf_len = snprintf( ( char *)( new_tws.tweets + new_tws.length ),
+									DEF_TWFS_RTW_LEN_FIELD + 1,	// +1 for null
+									"%02d", buf_len );
+				new_tws.length += buf_len;
+				*( new_tws.tweets + new_tws.length++ ) = 0x00;
 			}
-
-			return( E_TWFS_FILE_REG );
-		}
-
-		path_cmp[ i ] = *user_path;
-		i++;
-		total++;
-		user_path++;
-	}
-#endif
-
-#if 1
-	/* skip "/"		*/
-	user_path++;
-	total++;
-
-	if( *user_path == '\0' )
-	{
-		return( E_TWFS_FILE_REG );
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* check fifth path															*/
-	/* ------------------------------------------------------------------------ */
-	i = 0;
-	while( 1 )
-	{
-		if( DEF_TWFS_PATH_MAX <= total )
-		{
-			return( E_TWFS_FILE_REG );
-		}
-
-		/* -------------------------------------------------------------------- */
-		/* check lists/{subs, my_list, added}/[lname]/[owner]/					*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
-		{
-			path_cmp[ i ] = '\0';
-
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_LNAME_LDESC,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			/* ---------------------------------------------------------------- */
+			/* [text]															*/
+			/* ---------------------------------------------------------------- */
+			if( node[ E_TW_RTW_STATUS_TEXT ].value == NULL )
 			{
-				/* [sname]/lists/subscriptions/[lname]/description				*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_LDESC );
-				}
-				/* [sname]/lists/my_list/[lname]/description					*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
-				{
-					if( auth_user )
-					{
-						return( E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_LDESC );
-					}
-
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_LDESC );
-				}
-				/* [sname]/lists/added/[lname]/description						*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_LDESC );
-				}
-
-				return( E_TWFS_FILE_REG );
+				buf_len = printTwfsStatus( &status, "%s\n",
+										   node[ E_TW_TEXT ].value );
 			}
-
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_LNAME_TL,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			else
 			{
-				/* [sname]/lists/subscriptions/[lname]/timeline					*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_TL );
-				}
-				/* [sname]/lists/my_list/[lname]/timeline						*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_TL );
-				}
-				/* [sname]/lists/added/[lname]/timeline							*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_TL );
-				}
+				buf_len = printTwfsStatus( &status, "%s\n",
+										   node[ E_TW_RTW_STATUS_TEXT ].value );
 			}
-
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LNAME_SUB,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			new_tws.text_len += buf_len;
+			/* ---------------------------------------------------------------- */
+			/* RTWEETS:[retweets count]  FAVORITES:[favorites count]			*/
+			/* ---------------------------------------------------------------- */
+			if( node[ E_TW_RETWEETED ].value != NULL )
 			{
-				/* [sname]/lists/subscriptions/[lname]/subscribers				*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					return( E_TWFS_DIR_LISTS_SUB_LNAME_SUB );
-				}
-				/* [sname]/lists/my_list/[lname]/subscribers					*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
+				if( ( *( node[ E_TW_RETWEETED ].value ) == 't' ) ||
+					( *( node[ E_TW_RETWEETED ].value ) == 'T' ) )
 				{
-					return( E_TWFS_DIR_LISTS_OWN_LNAME_SUB );
+					retweeted = '*';
 				}
-				/* [sname]/lists/added/[lname]/subscribers						*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
+				else
 				{
-					return( E_TWFS_DIR_LISTS_ADD_LNAME_SUB );
+					retweeted = ' ';
 				}
 			}
-
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LNAME_MEM,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			else
 			{
-				/* [sname]/lists/subscriptions/[lname]/members					*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					return( E_TWFS_DIR_LISTS_SUB_LNAME_MEM );
-				}
-				/* [sname]/lists/my_list/[lname]/members						*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
-				{
-					return( E_TWFS_DIR_LISTS_OWN_LNAME_MEM );
-				}
-				/* [sname]/lists/added/[lname]/members							*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
-				{
-					return( E_TWFS_DIR_LISTS_ADD_LNAME_MEM );
-				}
+				retweeted = ' ';
 			}
 
-			return( E_TWFS_FILE_REG );
-		}
-		/* -------------------------------------------------------------------- */
-		/* check [sname]/lists/{subs, my_list, added}/[lname]					*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '/' )
-		{
-			path_cmp[ i ] = '\0';
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LNAME_SUB,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			if( node[ E_TW_FAVORITED ].value != NULL )
 			{
-				/* [sname]/lists/subscriptions/[lname]/subscribers				*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					file_type = E_TWFS_DIR_LISTS_SUB_LNAME_SUB;
-					break;
-				}
-				/* [sname]/lists/my_list/[lname]/subscribers					*/
-				else if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
+				if( ( *( node[ E_TW_FAVORITED ].value ) == 't' ) ||
+					( *( node[ E_TW_FAVORITED ].value ) == 'T' ) )
 				{
-					file_type = E_TWFS_DIR_LISTS_OWN_LNAME_SUB;
-					break;
+					favorited = '*';
 				}
-				/* [sname]/lists/added/[lname]/subscribers						*/
-				else if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
+				else
 				{
-					file_type = E_TWFS_DIR_LISTS_ADD_LNAME_SUB;
-					break;
+					favorited = ' ';
 				}
 			}
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_DIR_LNAME_MEM,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			else
 			{
-				/* [sname]/lists/subscriptions/[lname]/members					*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME )
-				{
-					file_type = E_TWFS_DIR_LISTS_SUB_LNAME_MEM;
-					break;
-				}
-				/* [sname]/lists/my_list/[lname]/members						*/
-				else if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME )
-				{
-					file_type = E_TWFS_DIR_LISTS_OWN_LNAME_MEM;
-					break;
-				}
-				/* [sname]/lists/added/[lname]/members							*/
-				else if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME )
-				{
-					file_type = E_TWFS_DIR_LISTS_ADD_LNAME_MEM;
-					break;
-				}
+				favorited = ' ';
 			}
 
-			return( E_TWFS_FILE_REG );
-		}
-
-		path_cmp[ i ] = *user_path;
-		i++;
-		total++;
-		user_path++;
-	}
+			/* counts are padded by spaces to fixed width						*/
+			if( ( node[ E_TW_RTW_STATUS_RTW_CNT ].value == NULL ) ||
+				( node[ E_TW_RTW_STATUS_FAV_CNT ].value == NULL ) )
+			{
+				buf_len = printTwfsStatus( &status,
+										   "[%c]RETWEETS:%-*s [%c]FAVORITES:%-*s\n",
+										   retweeted,
+										   DEF_REST_INT_MAX_LENGTH,
+										   node[ E_TW_RTW_CNT ].value,
+										   favorited,
+										   DEF_REST_INT_MAX_LENGTH,
+										   node[ E_TW_FAV_CNT ].value );
+			}
+			else
+			{
+				buf_len = printTwfsStatus( &status,
+										   "[%c]RETWEETS:%-*s [%c]FAVORITES:%-*s\n",
+										   retweeted,
+										   DEF_REST_INT_MAX_LENGTH,
+										   node[ E_TW_RTW_STATUS_RTW_CNT ].value,
+										   favorited,
+										   DEF_REST_INT_MAX_LENGTH,
+										   node[ E_TW_RTW_STATUS_FAV_CNT ].value );
+			}
+			new_tws.text_len += buf_len;
+			/* ---------------------------------------------------------------- */
+			/* [created_at]														*/
+			/* ---------------------------------------------------------------- */
+			if( node[ E_TW_RTW_STATUS_CREATED_AT ].value == NULL )
+			{
+				buf_len = printTwfsStatus( &status, "%s\n\n",
+										   node[ E_TW_CREATED_AT ].value );
+			}
+			else
+			{
+				buf_len = printTwfsStatus( &status, "%s\n\n",
+										   node[ E_TW_RTW_STATUS_CREATED_AT ].value );
+			}
+			new_tws.text_len += buf_len;
+			/* ---------------------------------------------------------------- */
+			/* separator														*/
+			/* ---------------------------------------------------------------- */
+			buf_len = printTwfsStatus( &status,
+									   "----------------------------------------\n" );
+			new_tws.text_len += buf_len;
 
-	/* skip "/"		*/
-	user_path++;
+			writeFile( fd, ( const void* )status.text, status.len );
 
-	if( *user_path == '\0' )
-	{
-		return( E_TWFS_FILE_REG );
-	}
+			closeFile( fd );
 
-	/* ------------------------------------------------------------------------ */
-	/* check sixth path															*/
-	/* ------------------------------------------------------------------------ */
-	i = 0;
-	while( 1 )
-	{
-		if( DEF_TWFS_PATH_MAX <= total )
-		{
-			return( E_TWFS_FILE_REG );
-		}
+			/* ---------------------------------------------------------------- */
+			/* link retweet file												*/
+			/* ---------------------------------------------------------------- */
+			if( ( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) &&
+				( node[ E_TW_RTW_STATUS_ID_STR ].value ) )
+			{
+				char	new_path[ DEF_TWFS_PATH_MAX ];
+				snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
+						  getRootDirPath( ),
+						  node[ E_TW_USR_SNAME ].value,
+						  DEF_TWFS_PATH_DIR_RETWEET,
+						  node[ E_TW_ID_STR ].value );
 
-		/* -------------------------------------------------------------------- */
-		/* check lists/{subs, my_list, added}/[lname]/[owner]/{subs,mem}		*/
-		/* -------------------------------------------------------------------- */
-		if( *user_path == '\0' )
-		{
-			path_cmp[ i ] = '\0';
+				logMessage( "readTweet from link:%s\n", new_path );
 
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_LNAME_MEM_LIST,
-						 DEF_TWFS_PATH_MAX ) == 0 )
-			{
-				/* [sname]/lists/subscriptions/[lname]/[owner]/
-													subscribers/list			*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST );
-				}
-				/* [sname]/lists/subscriptions/[lname]/[owner]/members/list		*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_MEM )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST );
-				}
+				logMessage( "node[ E_TW_RTW_STATUS_USR_SNAME ].value : %s\n",
+							 node[ E_TW_RTW_STATUS_USR_SNAME ].value );
+				logMessage( "node[ E_TW_RTW_STATUS_ID_STR ].value : %s\n",
+							 node[ E_TW_RTW_STATUS_ID_STR ].value );
 
-				/* [sname]/lists/my_list/[lname]/[owner]/subscribers/list		*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST );
-				}
-				/* [sname]/lists/my_list/[lname]/[owner]/members/list			*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_MEM )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST );
-				}
+				snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
+						  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
+						  DEF_TWFS_PATH_DIR_STATUS,
+						  node[ E_TW_RTW_STATUS_ID_STR ].value );
 
-				/* [sname]/lists/added/[lname]/[owner]/subscribers/list			*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST );
-				}
-				/* [sname]/lists/my_list/[lname]/[owner]/members/list			*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_MEM )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST );
-				}
+				logMessage( "readTweet to link:%s\n", buffer );
+
+				symlink( buffer, new_path );
+
+				/* update length for "Retweeted by [screen_name]"			*/
+				twfs_file->tl_size += sizeof( DEF_TWFS_RTW_MESSAGE ) - 1;
+				twfs_file->tl_size += node[ E_TW_USR_SNAME ].length;
+				twfs_file->tl_size += 1;	// for '\n'
 			}
 
-			if( strncmp( path_cmp,
-						 DEF_TWFS_PATH_LNAME_MEM_DOT_LIST,
-						 DEF_TWFS_PATH_MAX ) == 0 )
+			/* ---------------------------------------------------------------- */
+			/* link favorite file												*/
+			/* ---------------------------------------------------------------- */
+			if( request == E_TWFS_REQ_READ_AUTH_FAV_LIST )
 			{
-				/* [sname]/lists/subscriptions/[lname]/[owner]/
-														subscribers/.list		*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST );
-				}
-				/* [sname]/lists/subscriptions/[lname]/[owner]/members/.list	*/
-				if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_MEM )
+				if( ( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) &&
+					( node[ E_TW_RTW_STATUS_ID_STR ].value ) )
 				{
-					return( E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST );
-				}
+					char	new_path[ DEF_TWFS_PATH_MAX ];
 
-				/* [sname]/lists/my_list/[lname]/[owner]/subscribers/.list		*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST );
-				}
-				/* [sname]/lists/my_list/[lname]/[owner]/members/.list			*/
-				if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_MEM )
-				{
-					return( E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST );
-				}
+					snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
+							  getRootDirPath( ),
+							  screen_name,
+							  DEF_TWFS_PATH_DIR_FAV,
+							  node[ E_TW_RTW_STATUS_ID_STR ].value );
 
-				/* [sname]/lists/added/[lname]/[owner]/subscribers/.list		*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_SUB )
-				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST );
+					snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
+						  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
+						  DEF_TWFS_PATH_DIR_STATUS,
+						  node[ E_TW_RTW_STATUS_ID_STR ].value );
+
+					symlink( buffer, new_path );
 				}
-				/* [sname]/lists/my_list/[lname]/[owner]/members/.list			*/
-				if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_MEM )
+				else
 				{
-					return( E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST );
-				}
-			}
+					char	new_path[ DEF_TWFS_PATH_MAX ];
 
-			/* copy members/subscribers screen name to third screen name		*/
-			for( int len = 0 ;
-				 len < DEF_TWAPI_MAX_SCREEN_NAME_LEN ;
-				 len++ )
-			{
-				third_sname[ len ] = path_cmp[ len ];
-				if( path_cmp[ len ] == '\0' )
-				{
-					break;
-				}
-			}
+					snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
+							  getRootDirPath( ),
+							  screen_name,
+							  DEF_TWFS_PATH_DIR_FAV,
+							  node[ E_TW_ID_STR ].value );
 
-			if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_SUB )
-			{
-				/* [sname]/lists/subscriptions/[lname]/[owner]
-													/subscribers/[sname]		*/
-				return( E_TWFS_FILE_LISTS_SUB_LNAME_SUB_SNAME );
-			}
-			if( file_type == E_TWFS_DIR_LISTS_SUB_LNAME_MEM )
-			{
-				/* [sname]/lists/subscriptions/[lname]/[owner]/members/[sname]	*/
-				return( E_TWFS_FILE_LISTS_SUB_LNAME_MEM_SNAME );
-			}
+					snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
+						  node[ E_TW_USR_SNAME ].value,
+						  DEF_TWFS_PATH_DIR_STATUS,
+						  node[ E_TW_ID_STR ].value );
 
-			if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_SUB )
-			{
-				/* [sname]/lists/my_list/[lname]/[owner]/subscribers/[sname]	*/
-				return( E_TWFS_FILE_LISTS_OWN_LNAME_SUB_SNAME );
-			}
-			if( file_type == E_TWFS_DIR_LISTS_OWN_LNAME_MEM )
-			{
-				/* [sname]/lists/my_list/[lname]/[owner]/members/[sname]		*/
-				if( auth_user )
-				{
-					return( E_TWFS_FILE_AUTH_LISTS_OWN_LNAME_MEM_SNAME );
+					symlink( buffer, new_path );
 				}
-				return( E_TWFS_FILE_LISTS_OWN_LNAME_MEM_SNAME );
-			}
-			
-			if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_SUB )
-			{
-				/* [sname]/lists/added/[lname]/[owner]/subscribers/[sname]		*/
-				return( E_TWFS_FILE_LISTS_ADD_LNAME_SUB_SNAME );
-			}
-			if( file_type == E_TWFS_DIR_LISTS_ADD_LNAME_MEM )
-			{
-				/* [sname]/lists/added/[lname]/[owner]/members/[sname]			*/
-				return( E_TWFS_FILE_LISTS_ADD_LNAME_MEM_SNAME );
 			}
 
-			return( E_TWFS_FILE_REG );
+			/* fill text length												*/
+			buf_len = snprintf( ( char* )( new_tws.tweets + new_tws.length ),
+								DEF_TWFS_TEXT_LEN_FIELD,
+								"%d", new_tws.text_len );
+			new_tws.length += buf_len;
+			/* update total size of timeline file							*/
+			twfs_file->tl_size += new_tws.text_len;
+			/* fill residual space											*/
+			buf_len = DEF_TWFS_TEXT_LEN_FIELD - buf_len;
+			memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
+			new_tws.length += buf_len;
+			*( new_tws.tweets + new_tws.length++ ) = '\n';
+
+			new_tws.num_tws++;
+		}
+
+		for( i = 0 ; i < E_TW_NUM ; i++ )
+		{
+			free( node[ i ].value );
+			node[ i ].value = NULL;
 		}
 
-		if( *user_path == '/' )
+		if( ana_result == 0 )
 		{
-			path_cmp[ i ] = '\0';
-			/* copy members/subscribers screen name to third screen name		*/
-			for( int len = 0 ;
-				 len < DEF_TWAPI_MAX_SCREEN_NAME_LEN ;
-				 len++ )
+			if( new_tws.num_tws == 0 )
 			{
-				third_sname[ len ] = path_cmp[ len ];
-				if( path_cmp[ len ] == '\0' )
-				{
-					break;
-				}
+				munmap( new_tws.tweets, hctx.content_length + 1 );
+				return( -1 );
 			}
-			return( E_TWFS_FILE_REG );
+			/* ---------------------------------------------------------------- */
+			/* analysis is done!												*/
+			/* ---------------------------------------------------------------- */
+			logMessage( "analysis is done!\n" );
+			break;
 		}
-
-		path_cmp[ i ] = *user_path;
-		i++;
-		total++;
-		user_path++;
 	}
 
-	return( E_TWFS_FILE_REG );
-#endif
-}
-
-/*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:getScreenNameFromPath
-	Input		:const char *path
-				 < path over twitter file system >
-				 char *screen_name
-				 < screen name buffer to output >
-	Output		:char *screen_name
-				 < first screen name >
-	Return		:void
-	Description	:get first screen name from path
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-*/
-void getScreenNameFromPath( const char *path, char *screen_name )
-{
-	int			i;
-	const char	*user_path = path;
-
-	i = 0;
-	
-	/* skip root	*/
-	user_path++;
-
-	while( *user_path != '/' )
+	/* ------------------------------------------------------------------------ */
+	/* even a short page may leave a gap to the last tweet. get older pages		*/
+	/* until they reach the last tweet or come back empty. older tweets are		*/
+	/* saved first so that records are saved in order							*/
+	/* ------------------------------------------------------------------------ */
+	if( ( last != NULL ) && ( depth < DEF_TWFS_CATCH_UP_PAGES ) )
 	{
-		if( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= i )
-		{
-			screen_name[ i - 1 ] = '\0';
-			return;
-		}
-		if( *user_path == '\0' )
-		{
-			screen_name[ i ] = '\0';
-			return;
-		}
+		unsigned long long	oldest;
+		char				before[ DEF_TWFS_ID_FIELD + 1 ];
 
-		screen_name[ i ] = *user_path;
-		i++;
-		user_path++;
-	}
+		oldest = strtoull( ( const char* )( new_tws.tweets
+											+ ( DEF_TWFS_TL_RECORD_LEN
+												* ( new_tws.num_tws - 1 ) ) ),
+						   NULL, 10 );
 
-	screen_name[ i ] = '\0';
-}
+		if( strtoull( last, NULL, 10 ) + 1 < oldest )
+		{
+			snprintf( before, sizeof( before ), "%llu", oldest - 1 );
 
-/*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:getDirName
-	Input		:char *dir_name
-				 < directory path >
-				 const char *file_path
-				 < file path to get directory paht >
-	Output		:char *dir_name
-				 < direcotry path >
-	Return		:void
-	Description	:get directory path from file path
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-*/
-void getDirName( char *dir_name, const char *file_path )
-{
-	int		file_path_len;
-	int		i;
-	char	*p;
+			result = readTweetPage( request, session, twfs_file,
+									screen_name, last, before, slug,
+									DEF_TWOPE_MAX_TWEET_PAGE_COUNT,
+									depth + 1, false );
 
-	file_path_len = strnlen( file_path, DEF_TWFS_PATH_MAX );
+			if( result < 0 )
+			{
+				/* an empty page ends catching up. keep this page anyway		*/
+				logMessage( "no more tweets before %s\n", before );
+			}
+		}
+	}
 
-	if( ( file_path[ 0 ] == '/' ) && file_path_len == 1 )
+	if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
 	{
-		dir_name[ 0 ] = file_path[ 0 ];
-		dir_name[ 1 ] = '\0';
+		result = resizeTwfsFile( twfs_file,
+								 twfs_file->size
+								 + ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws ) );
 	}
-
-	for( i = 0 ; i < file_path_len ; i++ )
+	else
 	{
-		dir_name[ i ] = file_path[ i ];
+		result = resizeTwfsFile( twfs_file,
+								 DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
+								 + ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws ) );
 	}
-
-	dir_name[ i ] = '\0';
-	p = &dir_name[ i ];
-
-	while( p-- )
+	
+	if( result < 0 )
 	{
-		if( *p == '/' )
-		{
-			break;
-		}
+		munmap( new_tws.tweets, hctx.content_length + 1 );
+		logMessage( "failed to ftruncat at readTweet[%zu]\n", twfs_file->size );
+		return( -1 );
 	}
+	*( new_tws.tweets + new_tws.length ) = '\0';
 
-	*( p + 1 ) = '\0';
-}
+	/* ------------------------------------------------------------------------ */
+	/* body of a timeline file is updated										*/
+	/* reverse new_twfs.tweets and save them									*/
+	/* ------------------------------------------------------------------------ */
+	if( older )
+	{
+		/* -------------------------------------------------------------------- */
+		/* records are moved under readers of the file. handles opened so far	*/
+		/* skip the history by getTwfsReadOffset and keep reading same records	*/
+		/* -------------------------------------------------------------------- */
+		pthread_rwlock_wrlock( &twfs_file->map->lock );
 
-/*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:getTwfsPathFromRootDir
-	Input		:const char *root_path
-				 < root absolute path >
-				 char *twfs_path
-				 < twfs absolute path from mount point >
-	Outpu		:void
-	Return		:int
-				 < status >
-	Description	:remove a directory
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-*/
-int getTwfsPathFromRootDir( const char *root_path, char *twfs_path )
-{
-	int			i;
-	int			root_len;
-	const char	*root_dir	= getRootDirPath( );
-	const char	*path		= root_path;
-	
-	root_len = getRootDirLength( );
-	i = 0;
-	while( *root_dir == *path )
-	{
-		if( ( *root_dir == '\0' ) || ( *path == '\0' ) )
+		twfs_file->map->history		+= twfs_file->tl_size - tl_size;
+		twfs_file->map->inserted	+= DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws;
+		twfs_file->history			= twfs_file->map->history;
+		twfs_file->inserted			= twfs_file->map->inserted;
+
+		twfs_file->tl = twfs_file->map->addr;
+
+		memmove( twfs_file->tl
+				 + DEF_TWFS_OFFSET_BODY_OF_TL
+				 + ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws ),
+				 twfs_file->tl + DEF_TWFS_OFFSET_BODY_OF_TL,
+				 twfs_file->size - DEF_TWFS_OFFSET_BODY_OF_TL );
+
+		for( i = 0 ; i < new_tws.num_tws ; i++ )
 		{
-			break;
+			memcpy( twfs_file->tl
+					+ DEF_TWFS_OFFSET_BODY_OF_TL
+					+ ( DEF_TWFS_TL_RECORD_LEN * ( new_tws.num_tws - i )
+					- DEF_TWFS_TL_RECORD_LEN ),
+					new_tws.tweets + ( DEF_TWFS_TL_RECORD_LEN * i ),
+					DEF_TWFS_TL_RECORD_LEN );
 		}
-		root_dir++;
-		path++;
-		i++;
-	}
-	
-	if( ( root_len != i ) || ( *path != '/' ) )
-	{
-		return( -1 );
+
+		pthread_rwlock_unlock( &twfs_file->map->lock );
 	}
-	
-	twfs_path[ 0 ] = '/';
-	i = 0;
-	while( *path != '\0' )
+
+	for( i = 0 ; !older && ( i < new_tws.num_tws ) ; i++ )
 	{
-		twfs_path[ i ] = *path;
-		i++;
-		path++;
+		if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
+		{
+			memcpy( twfs_file->tl
+					+ twfs_file->size
+					+ ( DEF_TWFS_TL_RECORD_LEN * ( new_tws.num_tws - i )
+					- DEF_TWFS_TL_RECORD_LEN ),
+					new_tws.tweets + ( DEF_TWFS_TL_RECORD_LEN * i ),
+					DEF_TWFS_TL_RECORD_LEN );
+		}
+		else
+		{
+			memcpy( twfs_file->tl
+					+ twfs_file->size
+					+ DEF_TWFS_OFFSET_BODY_OF_TL
+					+ ( DEF_TWFS_TL_RECORD_LEN * ( new_tws.num_tws - i )
+					- DEF_TWFS_TL_RECORD_LEN ),
+					new_tws.tweets + ( DEF_TWFS_TL_RECORD_LEN * i ),
+					DEF_TWFS_TL_RECORD_LEN );
+		}
 	}
 
-	if( 0 < i )
+	/* ------------------------------------------------------------------------ */
+	/* update total timeline file size											*/
+	/* ------------------------------------------------------------------------ */
+	if( new_tws.num_tws )
 	{
-		if( 1 < i )
+		result = snprintf( twfs_file->tl,
+						   DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
+						   "%zu", twfs_file->tl_size );
+
+		for( i = result ; i < ( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN - 1 ) ; i++ )
 		{
-			if( twfs_path[ i - 1 ] == '/' )
-			{
-				twfs_path[ i - 1 ] = '\0';
-			}
+			*( twfs_file->tl + i ) = 0x00;
 		}
-		twfs_path[ i ] = '\0';
-	}
+		*( twfs_file->tl + i ) = '\n';
 	
+		if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
+		{
+			/* actual timeline file is updated									*/
+			twfs_file->size += ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws );
+		}
+		else
+		{
+			/* actual timeline file is updated									*/
+			twfs_file->size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN;
+			twfs_file->size += ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws );
+		}
+	}
+
+	logMessage( "twfs_file->size :%d\n", twfs_file->size );
+	logMessage( "num :%d\n", new_tws.num_tws );
+	logMessage( "new_tws.length : %d\n", new_tws.length );
+	logMessage( "------------------- timeline file ------------------ \n" );
+
+	if( new_tws.num_tws )
+	{
+		/* older records are put in front of all records					*/
+		queueTwfsFileFlush( twfs_file,
+							DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
+							older ?
+							twfs_file->size - DEF_TWFS_OFFSET_BODY_OF_TL :
+							DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws );
+		updateTwfsAttrCache( twfs_file );
+	}
+
+	munmap( new_tws.tweets, hctx.content_length + 1 );
+
 	return( 0 );
 }
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:getTwfsPathFromMountDir
-	Input		:const char *mount_path
-				 < mount absolute path >
-				 char *twfs_path
-				 < twfs absolute path from mount point >
-	Outpu		:void
+	Function	:backfillTwfsTimeLine
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information of reader >
+				 const char *r_path
+				 < path to file over root directory >
+				 const char *screen_name
+				 < screen name in path to file >
+				 E_TWFS_FILE_TYPE file_type
+				 < twfs file type >
+				 const char *slug
+				 < slug used for only lists timelines >
+	Output		:void
 	Return		:int
 				 < status >
-	Description	:remove a directory
+	Description	:when a read reaches the end of a timeline file, that is the
+				 reader has gone through all the history in it, get older
+				 tweets in background and save them before the oldest record.
+				 it starts once in DEF_TWFS_BACKFILL_INTERVAL for a file
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
-int getTwfsPathFromMountDir( const char *mount_path, char *twfs_path )
+int backfillTwfsTimeLine( struct twfs_file *twfs_file,
+						  const char *r_path,
+						  const char *screen_name,
+						  E_TWFS_FILE_TYPE file_type,
+						  const char *slug )
 {
-	int			i;
-	int			mount_len;
-	const char	*mount_dir	= getMountDirPath( );
-	const char	*path		= mount_path;
-	
-	mount_len = getMountDirLength( );
-	i = 0;
-	while( *mount_dir == *path )
+	struct twfs_backfill	*backfill;
+	struct twfs_map			*map;
+	pthread_attr_t			attr;
+	pthread_t				thread;
+	E_TWFS_REQ				request;
+	int						result;
+	char					value[ DEF_REST_INT_MAX_LENGTH + 1 ];
+	ssize_t					len;
+	time_t					now;
+
+	switch( file_type )
 	{
-		if( ( *mount_dir == '\0' ) || ( *path == '\0' ) )
-		{
-			break;
-		}
-		mount_dir++;
-		path++;
-		i++;
+	case	E_TWFS_FILE_USER_TL:
+	case	E_TWFS_FILE_AUTH_USER_TL:
+		request = E_TWFS_REQ_READ_USER_TL;
+		break;
+	case	E_TWFS_FILE_AUTH_TL:
+		request = E_TWFS_REQ_READ_HOME_TL;
+		break;
+	case	E_TWFS_FILE_AUTH_NOTI_AT_TW:
+		request = E_TWFS_REQ_READ_MENTIONS_TL;
+		break;
+	case	E_TWFS_FILE_AUTH_NOTI_RTW:
+		request = E_TWFS_REQ_READ_RTW_OF_ME_TL;
+		break;
+	case	E_TWFS_FILE_FAV_LIST:
+		request = E_TWFS_REQ_READ_FAV_LIST;
+		break;
+	case	E_TWFS_FILE_AUTH_FAV_LIST:
+		request = E_TWFS_REQ_READ_AUTH_FAV_LIST;
+		break;
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_TL:
+		request = E_TWFS_REQ_READ_LISTS_SUB_TL;
+		break;
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_TL:
+		request = E_TWFS_REQ_READ_LISTS_OWN_TL;
+		break;
+	case	E_TWFS_FILE_LISTS_ADD_LNAME_TL:
+		request = E_TWFS_REQ_READ_LISTS_ADD_TL;
+		break;
+	default:
+		return( 0 );
 	}
-	
-	if( ( mount_len != i ) || ( *path != '/' ) )
+
+	/* ------------------------------------------------------------------------ */
+	/* history is capped														*/
+	/* ------------------------------------------------------------------------ */
+	if( twfs_file->size < ( DEF_TWFS_OFFSET_BODY_OF_TL + DEF_TWFS_TL_RECORD_LEN ) )
 	{
-		return( -1 );
+		return( 0 );
 	}
-	
-	twfs_path[ 0 ] = '/';
-	i = 0;
-	while( *path != '\0' )
+
+	if( ( DEF_TWFS_BACKFILL_MAX_RECORDS * DEF_TWFS_TL_RECORD_LEN )
+		<= ( twfs_file->size - DEF_TWFS_OFFSET_BODY_OF_TL ) )
 	{
-		twfs_path[ i ] = *path;
-		i++;
-		path++;
+		return( 0 );
 	}
 
-	if( 0 < i )
+	if( !( map = twfs_file->map ) )
 	{
-		if( 1 < i )
+		return( 0 );
+	}
+
+	pthread_mutex_lock( &twfs_map_lock );
+
+	if( map->backfill || map->oldest )
+	{
+		pthread_mutex_unlock( &twfs_map_lock );
+		return( 0 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* every reader of the file reaches its end, so get history once in a while	*/
+	/* ------------------------------------------------------------------------ */
+	now = time( NULL );
+	len = fgetxattr( twfs_file->fd, DEF_TWFS_XATTR_BACKFILL,
+					 value, sizeof( value ) - 1 );
+
+	if( 0 < len )
+	{
+		value[ len ] = '\0';
+
+		if( ( now - ( time_t )strtoll( value, NULL, 10 ) )
+			< DEF_TWFS_BACKFILL_INTERVAL )
 		{
-			if( twfs_path[ i - 1 ] == '/' )
-			{
-				twfs_path[ i - 1 ] = '\0';
-			}
+			pthread_mutex_unlock( &twfs_map_lock );
+			return( 0 );
 		}
-		twfs_path[ i ] = '\0';
 	}
-	
+
+	len = snprintf( value, sizeof( value ), "%lld", ( long long )now );
+	fsetxattr( twfs_file->fd, DEF_TWFS_XATTR_BACKFILL, value, len, 0 );
+
+	map->backfill = true;
+
+	pthread_mutex_unlock( &twfs_map_lock );
+
+	/* ------------------------------------------------------------------------ */
+	/* background has its own handle, reader may close the file before it		*/
+	/* ------------------------------------------------------------------------ */
+	if( !( backfill = malloc( sizeof( struct twfs_backfill ) ) ) )
+	{
+		result = -ENOMEM;
+		goto clear_backfill;
+	}
+
+	backfill->request = request;
+	snprintf( backfill->screen_name, sizeof( backfill->screen_name ), "%s",
+			  screen_name ? screen_name : "" );
+	snprintf( backfill->slug, sizeof( backfill->slug ), "%s",
+			  slug ? slug : "" );
+
+	if( !( backfill->twfs_file = ( struct twfs_file* )allocTwfsFile( ) ) )
+	{
+		free( backfill );
+		result = -ENOMEM;
+		goto clear_backfill;
+	}
+
+	/* twfs file is freed on failure											*/
+	if( ( result = openTwfsFile( backfill->twfs_file, r_path, file_type ) ) < 0 )
+	{
+		free( backfill );
+		goto clear_backfill;
+	}
+
+	pthread_attr_init( &attr );
+	pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+
+	if( pthread_create( &thread, &attr, runTwfsBackfill, backfill ) != 0 )
+	{
+		pthread_attr_destroy( &attr );
+		closeTwfsFile( &backfill->twfs_file );
+		free( backfill );
+		result = -1;
+		goto clear_backfill;
+	}
+
+	pthread_attr_destroy( &attr );
+
 	return( 0 );
+
+clear_backfill:
+	pthread_mutex_lock( &twfs_map_lock );
+	map->backfill = false;
+	pthread_mutex_unlock( &twfs_map_lock );
+
+	return( result );
 }
 
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:readTweet
+	Function	:readDM
 	Input		:struct ssl_session *session
 				 < ssl session >
 				 struct twfs_file
 				 < twfs file information >
-				 const char *screen_name
-				 < screen name for user timeline >
-				 const char *last
-				 < last received tweet id >
-				 const char *slug
-				 < slug used for only lists operations >
+				 const char *sent_last
+				 < last received tweet id of sent dm >
+				 const char *recv_last
+				 < last received tweet id of received dm >
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:read home or user timeline of authenticated user
+	Description	:read direct messages of authenticated user
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
-int readTweet( E_TWFS_REQ request,
-			   struct ssl_session *session,
-			   struct twfs_file *twfs_file,
-			   const char *screen_name,
-			   const char *last,
-			   const char *slug )
+int readDM( E_TWFS_REQ requset,
+			struct ssl_session *session,
+			struct twfs_file *twfs_file,
+			const char *recv_last,
+			const char *sent_last )
 {
 	typedef enum
 	{
-		E_TW_CREATED_AT,			// created_at
-		E_TW_ID_STR,				// id_str
-		E_TW_IN_RE_TO_SNAME,		// in_reply_to_screen_name
-		E_TW_IN_RE_TO_SIDS,			// in_reply_to_status_id_str
-		E_TW_RETWEETED,				// retweeted
-		E_TW_FAVORITED,				// favorited
-		E_TW_RTW_STATUS,			// retweeted_status/
-		E_TW_FAV_CNT,				// favorite_count
-		E_TW_RTW_CNT,				// retweet_count
-		E_TW_RTW_STATUS_CREATED_AT,	// retweeted_status/created_at
-		E_TW_RTW_STATUS_ID_STR,		// retweeted_status/id_str
-		E_TW_RTW_STATUS_TEXT,		// retweeted_status/text
-		E_TW_RTW_STATUS_FAV_CNT,	// retweeted_status/favorite_count
-		E_TW_RTW_STATUS_RTW_CNT,	// retweeted_status/retweet_count
-		E_TW_RTW_STATUS_USR,		// retweeted_status/user/
-		E_TW_RTW_STATUS_USR_ID_STR,	// retweeted_status/user/id_str
-		E_TW_RTW_STATUS_USR_NAME,	// retweeted_status/user/name
-		E_TW_RTW_STATUS_USR_SNAME,	// retweeted_status/user/sname
-		E_TW_TEXT,					// text
-		E_TW_USER,					// user/
-		E_TW_USR_ID_STR,			// user/id_str
-		E_TW_USR_NAME,				// user/name
-		E_TW_USR_SNAME,				// user/screen_name
-		E_TW_NUM,
+		E_DM_CREATED_AT,			// created_at
+		E_DM_ID_STR,				// id_str
+		E_DM_RECP,					// recipient
+		E_DM_RECP_ID_STR,			// recipient/id_str
+		E_DM_RECP_NAME,				// recipient/name
+		E_DM_RECP_PROTECTED,		// recipient/protected
+		E_DM_RECP_SNAME,			// recipient/screen_name
+		E_DM_SEND,					// sender/
+		E_DM_SEND_ID_STR,			// sender/id_str
+		E_DM_SEND_NAME,				// sender/name
+		E_DM_SEND_PROTECTED,		// sender/protected
+		E_DM_SEND_SNAME,			// sender/screen_name
+		E_DM_TEXT,					// text
+		E_DM_NUM,
 	} E_OBJ;
 
-	struct new_tws
+	struct new_dms
 	{
-		size_t			length;		// length of all texts except for rtw message
-		uint8_t			*tweets;
-		int				num_tws;
-		int				text_len;	// current text length
+		uint8_t			*dms;
+		size_t			length;
+		size_t			text_total_len;
+		int				text_len;
+		int				num_dms;
+		int				unmap_length;
 	};
 
 	struct http_ctx		hctx;
@@ -3717,138 +3080,97 @@ int readTweet( E_TWFS_REQ request,
 	int					recv_length;
 	int					i;
 	int					fd;
-	struct new_tws		new_tws = { 0, NULL, 0, 0};
+	int					snd_index			= 0;
+	int					rcp_index			= 0;
+	int					twfs_index			= 0;
+	struct new_dms		new_recp_dms		= { NULL, 0, 0, 0, 0 };
+	struct new_dms		new_send_dms		= { NULL, 0, 0, 0, 0 };
 	struct jnode		root;
-	struct jnode		node[ E_TW_NUM ];
-	char				rs_created_at[ ]	= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_TW_CREATED_AT;
-	char				rs_id_str[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_TW_ID_STR;
-	char				rs_text[ ]			= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_TW_TEXT;
-	char				rs_fav_cnt[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_TW_FAV_CNT;
-	char				rs_rtw_cnt[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_TW_RTW_CNT;
-	char				rs_usr[ ]			= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_USR;
-	char				rs_usr_idstr[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_ID_STR;
-	char				rs_usr_name[ ]		= "/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_NAME;
-	char				rs_usr_screen_name[ ]="/" DEF_TWAPI_OBJ_TW_RTW_STATUS
-											  "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_SNAME;
-	char				usr_idstr[ ]		= "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_ID_STR;
-	char				usr_name[ ]			= "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_NAME;
-	char				usr_screen_name[ ]	= "/" DEF_TWAPI_OBJ_USR
-											  "/" DEF_TWAPI_OBJ_USR_SNAME;
+	struct jnode		node[ E_DM_NUM ];
+	/* for received dm															*/
+	char				rc_id_str[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
+	char				rc_name[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
+	char				rc_protected[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
+	char				rc_sname[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
+	/* for sent dm																*/
+	char				rc_id_str2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
+	char				rc_name2[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
+	char				rc_protected2[ ]	= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
+	char				rc_sname2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
+											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
 
-	/* ------------------------------------------------------------------------ */
-	/* request get statuses/home_timeline										*/
-	/* ------------------------------------------------------------------------ */
-	switch( request )
-	{
-	case	E_TWFS_REQ_READ_HOME_TL:
-	default:
-		if( ( result = getHomeTimeLine( session, &hctx, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_HOME_TWEET:
-		if( ( result = getMentionsTimeLine( session, &hctx, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_USER_TL:
-		if( ( result = getUserTimeLine( session, &hctx,
-										screen_name, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_MENTIONS_TL:
-		if( ( result = getMentionsTimeLine( session, &hctx, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_RTW_OF_ME_TL:
-		if( ( result = getRetweetOfMeTimeLine( session, &hctx, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_FAV_LIST:
-	case	E_TWFS_REQ_READ_AUTH_FAV_LIST:
-		if( ( result = getFavoritesList( session, &hctx, last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	case	E_TWFS_REQ_READ_LISTS_SUB_TL:
-	case	E_TWFS_REQ_READ_LISTS_OWN_TL:
-	case	E_TWFS_REQ_READ_LISTS_ADD_TL:
-		logMessage( " get lists timeline\n" );
-		if( ( result = getListsTimeLine( session,
-										 &hctx,
-										 slug,
-										 screen_name,
-										 last ) ) < 0 )
-		{
-			return( result );
-		}
-		break;
-	}
+	/* for received dm															*/
+	char				sd_id_str[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
+	char				sd_name[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
+	char				sd_protected[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
+	char				sd_sname[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
+	/* for sent dm																*/
+	char				sd_id_str2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
+	char				sd_name2[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
+	char				sd_protected2[ ]	= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
+	char				sd_sname2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
+											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
 
-	if( hctx.content_length == 0 )
+	if( ( result = getDirectMessages( session, &hctx, recv_last ) ) < 0 )
 	{
-		return( 0 );
+		return( result );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* buffer for new tweets													*/
+	/* buffer for received new dm tweets										*/
 	/* ------------------------------------------------------------------------ */
-	new_tws.tweets = mmap( NULL, hctx.content_length + 1,
-						   PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
-
-	if( new_tws.tweets == MAP_FAILED )
+	new_send_dms.dms = mmap( NULL, hctx.content_length + 1,
+							 PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
+	
+	if( new_send_dms.dms == MAP_FAILED )
 	{
 		recv_length = hctx.content_length;
 		while( recv_length-- )
 		{
-			if( recvSSLMessage( session, ( unsigned char* )rs_created_at, 1 ) < 0 )
+			if( recvSSLMessage( session, ( unsigned char* )sd_id_str, 1 ) < 0 )
 			{
 				break;
 			}
 		}
 
-		logMessage( "cannot map [new_tws]%s\n", strerror( errno ) );
+		logMessage( "cannot map [new_send_dms]%s\n", strerror( errno ) );
 
 		return( -1 );
 	}
 
+	new_send_dms.unmap_length = hctx.content_length + 1;
+
 	/* ------------------------------------------------------------------------ */
-	/* receive tweets of json structure											*/
+	/* receive recieved dm tweets of json structure								*/
 	/* ------------------------------------------------------------------------ */
 	if( recvSSLMessage( session,
-						( unsigned char* )new_tws.tweets,
+						( unsigned char* )new_send_dms.dms,
 						hctx.content_length ) < 0 )
 	{
-		munmap( new_tws.tweets, hctx.content_length + 1 );
+		munmap( new_send_dms.dms, hctx.content_length );
 		//disconnectSSLServer( session );
+		logMessage( "failed to recv ssl message at readDM\n" );
 		return( -1 );
 	}
 
-	//disconnectSSLServer( session );
-
-	//logMessage( "%s\n", new_tws );
+	for( i = 0 ; i < E_DM_NUM ; i++ )
+	{
+		node[ i ].value = NULL;
+	}
 
 	/* ------------------------------------------------------------------------ */
 	/* make json lookup structure												*/
@@ -3856,75 +3178,45 @@ int readTweet( E_TWFS_REQ request,
 	initJsonRoot( &root );
 
 	/* created_at																*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_CREATED_AT,
-					 &node[ E_TW_CREATED_AT				]	);
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_CREATED_AT,
+					 &node[ E_DM_CREATED_AT		] );
 	/* id_str																	*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_ID_STR,
-					 &node[ E_TW_ID_STR					]	);
-	/* in_reply_to_screen_name													*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_IN_RE_TO_SNAME,
-					 &node[ E_TW_IN_RE_TO_SNAME			]	);
-	/* in_reply_to_id_str														*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_IN_RE_TO_SIDS,
-					 &node[ E_TW_IN_RE_TO_SIDS			]	);
-	/* retweeted																*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RETWEETED,
-					 &node[ E_TW_RETWEETED				]	);
-	/* favorited																*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_FAVORITED,
-					 &node[ E_TW_FAVORITED				]	);
-	/* retweeted_status/														*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RTW_STATUS,
-					 &node[ E_TW_RTW_STATUS				]	);
-	/* favorite_count															*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_FAV_CNT,
-					 &node[ E_TW_FAV_CNT				]	);
-	/* retweet_count															*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_RTW_CNT,
-					 &node[ E_TW_RTW_CNT				]	);
-	/* retweeted_status/created_at												*/
-	insertJsonNodes( &root, rs_created_at,
-					 &node[ E_TW_RTW_STATUS_CREATED_AT	]	);
-	/* retweeted_status/id_str													*/
-	insertJsonNodes( &root, rs_id_str,
-					 &node[ E_TW_RTW_STATUS_ID_STR		]	);
-	/* retweeted_status/text													*/
-	insertJsonNodes( &root, rs_text,
-					 &node[ E_TW_RTW_STATUS_TEXT		]	);
-	/* retweeted_status/favorite_count											*/
-	insertJsonNodes( &root, rs_fav_cnt,
-					 &node[ E_TW_RTW_STATUS_FAV_CNT		]	);
-	/* retweeted_status/retweet_count											*/
-	insertJsonNodes( &root, rs_rtw_cnt,
-					 &node[ E_TW_RTW_STATUS_RTW_CNT		]	);
-	/* retweeted_status/usr/													*/
-	insertJsonNodes( &root, rs_usr,
-					 &node[ E_TW_RTW_STATUS_USR			]	);
-	/* retweeted_status/usr/id_str												*/
-	insertJsonNodes( &root, rs_usr_idstr,
-					 &node[ E_TW_RTW_STATUS_USR_ID_STR	]	);
-	/* retweeted_status/usr/name												*/
-	insertJsonNodes( &root, rs_usr_name,
-					 &node[ E_TW_RTW_STATUS_USR_NAME	]	);
-	/* retweeted_status/usr/screen_name											*/
-	insertJsonNodes( &root, rs_usr_screen_name,
-					 &node[ E_TW_RTW_STATUS_USR_SNAME	]	);
-	/* text																		*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_TEXT,
-					 &node[ E_TW_TEXT					]	);
-	/* user/																	*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_TW_USER,
-					 &node[ E_TW_USER					]	);
-	/* user/id_str																*/
-	insertJsonNodes( &root, usr_idstr,
-					 &node[ E_TW_USR_ID_STR				]	);
-	/* user/name																*/
-	insertJsonNodes( &root, usr_name,
-					 &node[ E_TW_USR_NAME				]	);
-	/* user/screen_name															*/
-	insertJsonNodes( &root, usr_screen_name,
-					 &node[ E_TW_USR_SNAME				]	);
-	
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_ID_STR,
+					 &node[ E_DM_ID_STR			] );
+	/* sender																	*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_USR_SEND,
+					 &node[ E_DM_SEND			] );
+	/* sender/id_str															*/
+	insertJsonNodes( &root, sd_id_str,
+					 &node[ E_DM_SEND_ID_STR	] );
+	/* sender/name																*/
+	insertJsonNodes( &root, sd_name,
+					 &node[ E_DM_SEND_NAME		] );
+	/* sender/protected															*/
+	insertJsonNodes( &root, sd_protected,
+					 &node[ E_DM_SEND_PROTECTED	] );
+	/* sender/screen_name														*/
+	insertJsonNodes( &root, sd_sname,
+					 &node[ E_DM_SEND_SNAME		] );
+	/* text																		*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_TEXT,
+					 &node[ E_DM_TEXT			] );
+	/* recipient																*/
+	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_USR_RECP,
+					 &node[ E_DM_RECP			] );
+	/* recipient/id_str															*/
+	insertJsonNodes( &root, rc_id_str,
+					 &node[ E_DM_RECP_ID_STR	] );
+	/* recipient/name															*/
+	insertJsonNodes( &root, rc_name,
+					 &node[ E_DM_RECP_NAME		] );
+	/* recipient/protected														*/
+	insertJsonNodes( &root, rc_protected,
+					 &node[ E_DM_RECP_PROTECTED	] );
+	/* recipietn/screen_name													*/
+	insertJsonNodes( &root, rc_sname,
+					 &node[ E_DM_RECP_SNAME		] );
+
 	/* ------------------------------------------------------------------------ */
 	/* prepare for analyzing json structure										*/
 	/* ------------------------------------------------------------------------ */
@@ -3935,35 +3227,35 @@ int readTweet( E_TWFS_REQ request,
 	/* ------------------------------------------------------------------------ */
 	while( ana.length < hctx.content_length )
 	{
-		char	buffer[ 1024 ];
-		int		buf_len;
-		int		ana_result;
+		char				buffer[ 1024 ];
+		int					buf_len;
+		int					ana_result;
+		struct twfs_status	status;
 
 		ana_result = analyzeJson( session, &hctx,
-								  ( uint8_t* )new_tws.tweets,
+								  ( uint8_t* )new_send_dms.dms,
 								  &ana, &root,
 								  0,
 								  ( uint8_t* )buffer, sizeof( buffer ) );
 
 		if( ana_result < 0 )
 		{
-			for( i = 0 ; i < E_TW_NUM ; i++ )
+			for( i = 0 ; i < E_DM_NUM ; i++ )
 			{
 				free( node[ i ].value );
 				node[ i ].value = NULL;
 			}
 			logMessage( "error analyzing json\n" );
-			munmap( new_tws.tweets, hctx.content_length + 1 );
 			return( -1 );
 		}
 
-		if( ( node[ E_TW_USR_SNAME ].value	== NULL ) ||
-			( node[ E_TW_ID_STR ].value		== NULL ) ||
-			( node[ E_TW_USR_NAME ].value	== NULL ) ||
-			( node[ E_TW_RTW_CNT ].value	== NULL ) ||
-			( node[ E_TW_FAV_CNT ].value	== NULL ) )
+		if( ( node[ E_DM_SEND_ID_STR	].value == NULL ) ||
+			( node[ E_DM_SEND_NAME		].value == NULL ) ||
+			( node[ E_DM_SEND_SNAME		].value == NULL ) ||
+			( node[ E_DM_RECP_NAME		].value == NULL ) ||
+			( node[ E_DM_RECP_SNAME		].value == NULL ) )
 		{
-			for( i = 0 ; i < E_TW_NUM ; i++ )
+			for( i = 0 ; i < E_DM_NUM ; i++ )
 			{
 				free( node[ i ].value );
 				node[ i ].value = NULL;
@@ -3971,84 +3263,42 @@ int readTweet( E_TWFS_REQ request,
 
 			if( ana_result == 0 )
 			{
-				if( new_tws.num_tws == 0 )
+				if( new_send_dms.num_dms == 0 )
 				{
-					logMessage( "faile to readTweet\n" );
-					munmap( new_tws.tweets, hctx.content_length + 1 );
+					logMessage( " node is null at readDM\n" );
 					return( -1 );
 				}
-				else
-				{
-					break;
-				}
+				break;
 			}
 			continue;
 		}
 
-		for( i = 0 ; i < E_TW_NUM ; i++ )
+#if 0
+		for( i = 0 ; i < E_DM_NUM ; i++ )
 		{
+			if( node[ i ].value != NULL )
 			logMessage( "%s:%s\n", node[i].obj, node[i ].value );
 		}
+#endif
 
 		/* -------------------------------------------------------------------- */
-		/* path to [screen_name]/status/[tweet id]								*/
+		/* path to [screen_name]/direct_message/[screen_name]/[tweet id]		*/
 		/* -------------------------------------------------------------------- */
-		if( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL )
-		{
-			/* retweet															*/
-			snprintf( buffer, sizeof( buffer ), "%s/%s/%s",
-					  getRootDirPath( ),
-					  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-					  DEF_TWFS_PATH_DIR_STATUS );
-			if( ( result = isDirectory( buffer ) ) < 0 )
-			{
-				result =
-				makeUserHomeDirectory( node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-									   true );
-				//logMessage( "==========================\n" );
-				//logMessage( "make [%s] home\n", node[ E_TW_RTW_STATUS_USR_SNAME ].value );
-
-				if( result < 0 )
-				{
-					for( i = 0 ; i < E_TW_NUM ; i++ )
-					{
-						free( node[ i ].value );
-						node[ i ].value = NULL;
-					}
-
-					if( ana_result == 0 )
-					{
-						if( new_tws.num_tws == 0 )
-						{
-							munmap( new_tws.tweets, hctx.content_length + 1 );
-							return( -1 );
-						}
-						break;
-					}
-
-					/* try next tweet											*/
-					continue;
-				}
-			}
-		}
-
-		/* tweet itself															*/
-		snprintf( buffer, sizeof( buffer ), "%s/%s/%s",
+		snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
 				  getRootDirPath( ),
-				  node[ E_TW_USR_SNAME ].value,
-				  DEF_TWFS_PATH_DIR_STATUS );
-
-		//logMessage( "-----------------------------------\n" );
-		//logMessage( "%s\n", buffer );
-
+				  getTwapiScreenName( ),
+				  DEF_TWFS_PATH_DIR_DM,
+				  node[ E_DM_SEND_SNAME ].value );
+		
 		if( ( result = isDirectory( buffer ) ) < 0 )
 		{
-			result = makeUserHomeDirectory( node[ E_TW_USR_SNAME ].value, true );
-			//logMessage( "make [%s] home\n", node[ E_TW_USR_SNAME ].value );
+			result = makeUserDirectMessageDir( getTwapiScreenName( ),
+											   node[ E_DM_SEND_SNAME ].value,
+											   true );
 
 			if( result < 0 )
 			{
-				for( i = 0 ; i < E_TW_NUM ; i++ )
+				for( i = 0 ; i < E_DM_NUM ; i++ )
 				{
 					free( node[ i ].value );
 					node[ i ].value = NULL;
@@ -4056,9 +3306,8 @@ int readTweet( E_TWFS_REQ request,
 				
 				if( ana_result == 0 )
 				{
-					if( new_tws.num_tws == 0 )
+					if( new_send_dms.num_dms == 0 )
 					{
-						munmap( new_tws.tweets, hctx.content_length + 1 );
 						return( -1 );
 					}
 					break;
@@ -4068,879 +3317,116 @@ int readTweet( E_TWFS_REQ request,
 			}
 		}
 
-		if( ( node[ E_TW_RTW_STATUS_ID_STR ].value != NULL ) &&
-			( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) )
-		{
-			snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
-					  getRootDirPath( ),
-					  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-					  DEF_TWFS_PATH_DIR_STATUS,
-					  node[ E_TW_RTW_STATUS_ID_STR ].value );
-			logMessage( "Retweet file:%s\n", buffer );
-		}
-		else
-		{
-			snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
-					  getRootDirPath( ),
-					  node[ E_TW_USR_SNAME ].value,
-					  DEF_TWFS_PATH_DIR_STATUS,
-					  node[ E_TW_ID_STR ].value );
-			//logMessage( "tweet file:%s\n", buffer );
-		}
+		snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s/%s",
+				  getRootDirPath( ),
+				  getTwapiScreenName( ),
+				  DEF_TWFS_PATH_DIR_DM,
+				  node[ E_DM_SEND_SNAME ].value,
+				  node[ E_DM_ID_STR ].value );
 
 		fd = openFile( buffer, O_WRONLY | O_TRUNC | O_CREAT, 0660 );
 
 		if( 0 <= fd )
 		{
-			char	favorited;
-			char	retweeted;
 			/* ---------------------------------------------------------------- */
 			/* tweet id															*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"id:%s\n",
-								node[ E_TW_ID_STR ].value );
-#if 0
-			if( node[ E_TW_RTW_STATUS_USR_ID_STR ].value == NULL )
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"id:%s\n",
-									node[ E_TW_ID_STR ].value );
-			}
-			else
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"id:%s\n",
-									node[ E_TW_RTW_STATUS_ID_STR ].value );
-			}
-#endif
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_tws.text_len = buf_len;
+			status.len = 0;
+			buf_len = printTwfsStatus( &status, "id:%s\n",
+									   node[ E_DM_ID_STR ].value );
+			new_send_dms.text_len = buf_len;
 			/* copy id															*/
-			memcpy( new_tws.tweets + new_tws.length, buffer + 3, buf_len - 4 );
-			new_tws.length += buf_len - 4;	// without '\n'
+			memcpy( new_send_dms.dms + new_send_dms.length,
+					node[ E_DM_ID_STR ].value,
+					buf_len - 4 );
+			new_send_dms.length += buf_len - 4;	// without '\n'
 			/* fill residual space												*/
 			buf_len = DEF_TWFS_ID_FIELD + DEF_TWFS_ID_FIELD_NEXT - ( buf_len - 4 );
-			memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
-			new_tws.length += buf_len;
-#if 0
+			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
+			new_send_dms.length += buf_len;
 			/* ---------------------------------------------------------------- */
-			/* if retweeted														*/
+			/* [user name] @ [screen name]										*/
 			/* ---------------------------------------------------------------- */
-			if( node[ E_TW_RTW_STATUS_USR_ID_STR ].value != NULL )
+			buf_len = printTwfsStatus( &status,
+									   "To  :%s @%s\nFrom:%s @%s\n",
+									   node[ E_DM_RECP_NAME ].value,
+									   node[ E_DM_RECP_SNAME ].value,
+									   node[ E_DM_SEND_NAME ].value,
+									   node[ E_DM_SEND_SNAME ].value );
+			new_send_dms.text_len += buf_len;
+			/* copy screen name													*/
+			buf_len = node[ E_DM_SEND_SNAME ].length;
+			memcpy( new_send_dms.dms + new_send_dms.length,
+					node[ E_DM_SEND_SNAME ].value,
+					buf_len );
+			new_send_dms.length += buf_len;
+			/* fill residual space											*/
+			buf_len = DEF_TWFS_SNAME_FIELD
+					  + DEF_TWFS_SNAME_FIELD_NEXT
+					  - buf_len;
+			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
+			new_send_dms.length += buf_len;
+			/* fill SEND flag													*/
+			*( new_send_dms.dms + new_send_dms.length ++ ) = 's';
+			*( new_send_dms.dms + new_send_dms.length ++ ) = 0x00;
+			*( new_send_dms.dms + new_send_dms.length ++ ) = '0';
+			*( new_send_dms.dms + new_send_dms.length ++ ) = '0';
+			*( new_send_dms.dms + new_send_dms.length ++ ) = 0x00;
+
+			/* ---------------------------------------------------------------- */
+			/* [text]															*/
+			/* ---------------------------------------------------------------- */
+			buf_len = printTwfsStatus( &status, "%s\n",
+									   node[ E_DM_TEXT ].value );
+			new_send_dms.text_len += buf_len;
+			/* ---------------------------------------------------------------- */
+			/* [created_at]														*/
+			/* ---------------------------------------------------------------- */
+			buf_len = printTwfsStatus( &status, "%s\n\n",
+									   node[ E_DM_CREATED_AT ].value );
+			new_send_dms.text_len += buf_len;
+			/* ---------------------------------------------------------------- */
+			/* separator														*/
+			/* ---------------------------------------------------------------- */
+			buf_len = printTwfsStatus( &status,
+									   "---------------------------------------------\n" );
+			new_recp_dms.text_len += buf_len;
+
+			writeFile( fd, ( const void* )status.text, status.len );
+
+			closeFile( fd );
+
+			/* fill text length													*/
+			buf_len = snprintf( ( char* )( new_send_dms.dms + new_send_dms.length ),
+								DEF_TWFS_TEXT_LEN_FIELD,
+								"%d", new_send_dms.text_len );
+			new_send_dms.length += buf_len;
+			/* update total size of message file								*/
+			twfs_file->tl_size			+= new_send_dms.text_len;
+			new_send_dms.text_total_len	+= new_send_dms.text_len;
+			/* fill residual space												*/
+			buf_len = DEF_TWFS_TEXT_LEN_FIELD - buf_len;
+			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
+			new_send_dms.length += buf_len;
+			*( new_send_dms.dms + new_send_dms.length++ ) = '\n';
+
+			new_send_dms.num_dms++;
+		}
+
+		for( i = 0 ; i < E_DM_NUM ; i++ )
+		{
+			free( node[ i ].value );
+			node[ i ].value = NULL;
+		}
+
+		if( ana_result == 0 )
+		{
+			if( new_send_dms.num_dms == 0 )
 			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"Retweeted by %s\n",
-									node[ E_TW_USR_NAME ].value );
-				writeFile( fd, ( const void* )buffer, buf_len );
+				return( -1 );
 			}
-#endif
 			/* ---------------------------------------------------------------- */
-			/* [user name] @ [screen name]										*/
-			/* ---------------------------------------------------------------- */
-			if( ( node[ E_TW_RTW_STATUS_USR_NAME ].value == NULL ) ||
-				( node[ E_TW_RTW_STATUS_USR_SNAME ].value == NULL ) )
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"%s @%s\n",
-									node[ E_TW_USR_NAME ].value,
-									node[ E_TW_USR_SNAME ].value );
-				writeFile( fd, ( const void* )buffer, buf_len );
-				new_tws.text_len += buf_len;
-				/* copy screeen name											*/
-				buf_len = node[ E_TW_USR_SNAME ].length;
-				memcpy( new_tws.tweets + new_tws.length,
-						node[ E_TW_USR_SNAME ].value,
-						buf_len );
-				new_tws.length += buf_len;
-				/* fill residual space											*/
-				buf_len = DEF_TWFS_SNAME_FIELD
-						  + DEF_TWFS_SNAME_FIELD_NEXT
-						  - buf_len;
-				memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
-				new_tws.length += buf_len;
-				/* fill RT flag													*/
-				*( new_tws.tweets + new_tws.length++ ) = 'N';
-				*( new_tws.tweets + new_tws.length++ ) = 0x00;
-				*( new_tws.tweets + new_tws.length++ ) = '0';
-				*( new_tws.tweets + new_tws.length++ ) = '0';
-				*( new_tws.tweets + new_tws.length++ ) = 0x00;
-			}
-			else
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"%s @%s\n",
-									node[ E_TW_RTW_STATUS_USR_NAME ].value,
-									node[ E_TW_RTW_STATUS_USR_SNAME ].value );
-				writeFile( fd, ( const void* )buffer, buf_len );
-				new_tws.text_len += buf_len;
-				/* copy screeen name											*/
-				//buf_len = node[ E_TW_RTW_STATUS_USR_SNAME ].length;
-				buf_len = node[ E_TW_USR_SNAME ].length;
-				memcpy( new_tws.tweets + new_tws.length,
-						//node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-						node[ E_TW_USR_SNAME ].value,
-						buf_len );
-				new_tws.length += buf_len;
-				/* fill residual space											*/
-				buf_len = DEF_TWFS_SNAME_FIELD
-						  + DEF_TWFS_SNAME_FIELD_NEXT
-						  - buf_len;
-				memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
-				new_tws.length += buf_len;
-				/* fill RT flag													*/
-				*( new_tws.tweets + new_tws.length++ ) = 'R';
-				*( new_tws.tweets + new_tws.length++ ) = 0x00;
-				//buf_len = node[ E_TW_RTW_STATUS_USR_SNAME ].length;
-				buf_len = node[ E_TW_USR_SNAME ].length;
-				buf_len += sizeof( DEF_TWFS_RTW_MESSAGE ) - 1;
-				buf_len++;		// for '\n'
-				logMessage( "retweet text len :%d\n", buf_len );
-				buf_len = snprintf( ( char *)( new_tws.tweets + new_tws.length ),
-									DEF_TWFS_RTW_LEN_FIELD + 1,	// +1 for null
-									"%02d", buf_len );
-				new_tws.length += buf_len;
-				*( new_tws.tweets + new_tws.length++ ) = 0x00;
-			}
-			/* ---------------------------------------------------------------- */
-			/* [text]															*/
-			/* ---------------------------------------------------------------- */
-			if( node[ E_TW_RTW_STATUS_TEXT ].value == NULL )
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ), "%s\n",
-									node[ E_TW_TEXT ].value );
-			}
-			else
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ), "%s\n",
-									node[ E_TW_RTW_STATUS_TEXT ].value );
-			}
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_tws.text_len += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* RTWEETS:[retweets count]  FAVORITES:[favorites count]			*/
-			/* ---------------------------------------------------------------- */
-			if( node[ E_TW_RETWEETED ].value != NULL )
-			{
-				if( ( *( node[ E_TW_RETWEETED ].value ) == 't' ) ||
-					( *( node[ E_TW_RETWEETED ].value ) == 'T' ) )
-				{
-					retweeted = '*';
-				}
-				else
-				{
-					retweeted = ' ';
-				}
-			}
-			else
-			{
-				retweeted = ' ';
-			}
-
-			if( node[ E_TW_FAVORITED ].value != NULL )
-			{
-				if( ( *( node[ E_TW_FAVORITED ].value ) == 't' ) ||
-					( *( node[ E_TW_FAVORITED ].value ) == 'T' ) )
-				{
-					favorited = '*';
-				}
-				else
-				{
-					favorited = ' ';
-				}
-			}
-			else
-			{
-				favorited = ' ';
-			}
-
-			if( ( node[ E_TW_RTW_STATUS_RTW_CNT ].value == NULL ) ||
-				( node[ E_TW_RTW_STATUS_FAV_CNT ].value == NULL ) )
-			{
-				int	res_len;
-
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"[%c]RETWEETS:%s",
-									retweeted,
-									node[ E_TW_RTW_CNT ].value );
-				res_len = DEF_REST_INT_MAX_LENGTH - node[ E_TW_RTW_CNT ].length;
-				memset( &buffer[ buf_len ], ' ', res_len + 1 );	// + 1 for separate
-				buf_len += res_len + 1;
-
-				buf_len += snprintf( &buffer[ buf_len ],
-									 sizeof( buffer ) - buf_len + 1,
-									 "[%c]FAVORITES:%s",
-									 favorited,
-									 node[ E_TW_FAV_CNT ].value );
-				res_len = DEF_REST_INT_MAX_LENGTH - node[ E_TW_FAV_CNT ].length;
-				memset( &buffer[ buf_len ], ' ', res_len );
-				buf_len += res_len;
-				buffer[ buf_len++ ] = '\n';
-			}
-			else
-			{
-				int	res_len;
-
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"[%c]RETWEETS:%s",
-									retweeted,
-									node[ E_TW_RTW_STATUS_RTW_CNT ].value );
-				res_len = DEF_REST_INT_MAX_LENGTH
-						  - node[ E_TW_RTW_STATUS_RTW_CNT ].length;
-				memset( &buffer[ buf_len ], ' ', res_len + 1 );	// + 1 for separate
-				buf_len += res_len + 1;
-
-				buf_len += snprintf( &buffer[ buf_len ],
-									 sizeof( buffer ) - buf_len + 1,
-									 "[%c]FAVORITES:%s",
-									 favorited,
-									 node[ E_TW_RTW_STATUS_FAV_CNT ].value );
-				res_len = DEF_REST_INT_MAX_LENGTH
-						  - node[ E_TW_RTW_STATUS_FAV_CNT ].length;
-				memset( &buffer[ buf_len ], ' ', res_len );
-				buf_len += res_len;
-				buffer[ buf_len++ ] = '\n';
-			}
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_tws.text_len += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* [created_at]														*/
-			/* ---------------------------------------------------------------- */
-			if( node[ E_TW_RTW_STATUS_CREATED_AT ].value == NULL )
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"%s\n\n",
-									node[ E_TW_CREATED_AT ].value );
-			}
-			else
-			{
-				buf_len = snprintf( buffer, sizeof( buffer ),
-									"%s\n\n",
-									node[ E_TW_RTW_STATUS_CREATED_AT ].value );
-			}
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_tws.text_len += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* separator														*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"----------------------------------------\n" );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_tws.text_len += buf_len;
-
-			closeFile( fd );
-
-			/* ---------------------------------------------------------------- */
-			/* link retweet file												*/
-			/* ---------------------------------------------------------------- */
-			if( ( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) &&
-				( node[ E_TW_RTW_STATUS_ID_STR ].value ) )
-			{
-				char	new_path[ DEF_TWFS_PATH_MAX ];
-				snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  node[ E_TW_USR_SNAME ].value,
-						  DEF_TWFS_PATH_DIR_RETWEET,
-						  node[ E_TW_ID_STR ].value );
-
-				logMessage( "readTweet from link:%s\n", new_path );
-
-				logMessage( "node[ E_TW_RTW_STATUS_USR_SNAME ].value : %s\n",
-							 node[ E_TW_RTW_STATUS_USR_SNAME ].value );
-				logMessage( "node[ E_TW_RTW_STATUS_ID_STR ].value : %s\n",
-							 node[ E_TW_RTW_STATUS_ID_STR ].value );
-
-				snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
-						  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-						  DEF_TWFS_PATH_DIR_STATUS,
-						  node[ E_TW_RTW_STATUS_ID_STR ].value );
-
-				logMessage( "readTweet to link:%s\n", buffer );
-
-				symlink( buffer, new_path );
-
-				/* update length for "Retweeted by [screen_name]"			*/
-				twfs_file->tl_size += sizeof( DEF_TWFS_RTW_MESSAGE ) - 1;
-				twfs_file->tl_size += node[ E_TW_USR_SNAME ].length;
-				twfs_file->tl_size += 1;	// for '\n'
-			}
-
-			/* ---------------------------------------------------------------- */
-			/* link favorite file												*/
-			/* ---------------------------------------------------------------- */
-			if( request == E_TWFS_REQ_READ_AUTH_FAV_LIST )
-			{
-				if( ( node[ E_TW_RTW_STATUS_USR_SNAME ].value != NULL ) &&
-					( node[ E_TW_RTW_STATUS_ID_STR ].value ) )
-				{
-					char	new_path[ DEF_TWFS_PATH_MAX ];
-
-					snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
-							  getRootDirPath( ),
-							  screen_name,
-							  DEF_TWFS_PATH_DIR_FAV,
-							  node[ E_TW_RTW_STATUS_ID_STR ].value );
-
-					snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
-						  node[ E_TW_RTW_STATUS_USR_SNAME ].value,
-						  DEF_TWFS_PATH_DIR_STATUS,
-						  node[ E_TW_RTW_STATUS_ID_STR ].value );
-
-					symlink( buffer, new_path );
-				}
-				else
-				{
-					char	new_path[ DEF_TWFS_PATH_MAX ];
-
-					snprintf( new_path, sizeof( new_path ), "%s/%s/%s/%s",
-							  getRootDirPath( ),
-							  screen_name,
-							  DEF_TWFS_PATH_DIR_FAV,
-							  node[ E_TW_ID_STR ].value );
-
-					snprintf( buffer, DEF_TWFS_PATH_MAX, "../../%s/%s/%s",
-						  node[ E_TW_USR_SNAME ].value,
-						  DEF_TWFS_PATH_DIR_STATUS,
-						  node[ E_TW_ID_STR ].value );
-
-					symlink( buffer, new_path );
-				}
-			}
-
-			/* fill text length												*/
-			buf_len = snprintf( ( char* )( new_tws.tweets + new_tws.length ),
-								DEF_TWFS_TEXT_LEN_FIELD,
-								"%d", new_tws.text_len );
-			new_tws.length += buf_len;
-			/* update total size of timeline file							*/
-			twfs_file->tl_size += new_tws.text_len;
-			/* fill residual space											*/
-			buf_len = DEF_TWFS_TEXT_LEN_FIELD - buf_len;
-			memset( new_tws.tweets + new_tws.length, 0x00, buf_len );
-			new_tws.length += buf_len;
-			*( new_tws.tweets + new_tws.length++ ) = '\n';
-
-			new_tws.num_tws++;
-		}
-
-		for( i = 0 ; i < E_TW_NUM ; i++ )
-		{
-			free( node[ i ].value );
-			node[ i ].value = NULL;
-		}
-
-		if( ana_result == 0 )
-		{
-			if( new_tws.num_tws == 0 )
-			{
-				munmap( new_tws.tweets, hctx.content_length + 1 );
-				return( -1 );
-			}
-			/* ---------------------------------------------------------------- */
-			/* analysis is done!												*/
-			/* ---------------------------------------------------------------- */
-			logMessage( "analysis is done!\n" );
-			break;
-		}
-	}
-
-	if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
-	{
-		result = ftruncate( twfs_file->fd,
-							twfs_file->size
-							+ ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws ) );
-	}
-	else
-	{
-		result = ftruncate( twfs_file->fd,
-							DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-							+ ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws ) );
-	}
-	
-	if( result < 0 )
-	{
-		munmap( new_tws.tweets, hctx.content_length + 1 );
-		logMessage( "failed to ftruncat at readTweet[%zu]\n", twfs_file->size );
-		return( -1 );
-	}
-	*( new_tws.tweets + new_tws.length ) = '\0';
-
-	/* ------------------------------------------------------------------------ */
-	/* body of a timeline file is updated										*/
-	/* reverse new_twfs.tweets and save them									*/
-	/* ------------------------------------------------------------------------ */
-	for( i = 0 ; i < new_tws.num_tws ; i++ )
-	{
-		if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
-		{
-			memcpy( twfs_file->tl
-					+ twfs_file->size
-					+ ( DEF_TWFS_TL_RECORD_LEN * ( new_tws.num_tws - i )
-					- DEF_TWFS_TL_RECORD_LEN ),
-					new_tws.tweets + ( DEF_TWFS_TL_RECORD_LEN * i ),
-					DEF_TWFS_TL_RECORD_LEN );
-		}
-		else
-		{
-			memcpy( twfs_file->tl
-					+ twfs_file->size
-					+ DEF_TWFS_OFFSET_BODY_OF_TL
-					+ ( DEF_TWFS_TL_RECORD_LEN * ( new_tws.num_tws - i )
-					- DEF_TWFS_TL_RECORD_LEN ),
-					new_tws.tweets + ( DEF_TWFS_TL_RECORD_LEN * i ),
-					DEF_TWFS_TL_RECORD_LEN );
-		}
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* update total timeline file size											*/
-	/* ------------------------------------------------------------------------ */
-	if( new_tws.num_tws )
-	{
-		result = snprintf( twfs_file->tl,
-						   DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
-						   "%zu", twfs_file->tl_size );
-
-		for( i = result ; i < ( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN - 1 ) ; i++ )
-		{
-			*( twfs_file->tl + i ) = 0x00;
-		}
-		*( twfs_file->tl + i ) = '\n';
-	
-		if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
-		{
-			/* actual timeline file is updated									*/
-			twfs_file->size += ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws );
-		}
-		else
-		{
-			/* actual timeline file is updated									*/
-			twfs_file->size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN;
-			twfs_file->size += ( DEF_TWFS_TL_RECORD_LEN * new_tws.num_tws );
-		}
-	}
-
-	logMessage( "twfs_file->size :%d\n", twfs_file->size );
-	logMessage( "num :%d\n", new_tws.num_tws );
-	logMessage( "new_tws.length : %d\n", new_tws.length );
-	logMessage( "------------------- timeline file ------------------ \n" );
-
-	if( new_tws.num_tws )
-	{
-		msync( twfs_file->tl, twfs_file->size, MS_SYNC );
-	}
-
-	munmap( new_tws.tweets, hctx.content_length + 1 );
-
-	return( 0 );
-}
-
-/*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:readDM
-	Input		:struct ssl_session *session
-				 < ssl session >
-				 struct twfs_file
-				 < twfs file information >
-				 const char *sent_last
-				 < last received tweet id of sent dm >
-				 const char *recv_last
-				 < last received tweet id of received dm >
-	Output		:void
-	Return		:int
-				 < status >
-	Description	:read direct messages of authenticated user
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-*/
-int readDM( E_TWFS_REQ requset,
-			struct ssl_session *session,
-			struct twfs_file *twfs_file,
-			const char *recv_last,
-			const char *sent_last )
-{
-	typedef enum
-	{
-		E_DM_CREATED_AT,			// created_at
-		E_DM_ID_STR,				// id_str
-		E_DM_RECP,					// recipient
-		E_DM_RECP_ID_STR,			// recipient/id_str
-		E_DM_RECP_NAME,				// recipient/name
-		E_DM_RECP_PROTECTED,		// recipient/protected
-		E_DM_RECP_SNAME,			// recipient/screen_name
-		E_DM_SEND,					// sender/
-		E_DM_SEND_ID_STR,			// sender/id_str
-		E_DM_SEND_NAME,				// sender/name
-		E_DM_SEND_PROTECTED,		// sender/protected
-		E_DM_SEND_SNAME,			// sender/screen_name
-		E_DM_TEXT,					// text
-		E_DM_NUM,
-	} E_OBJ;
-
-	struct new_dms
-	{
-		uint8_t			*dms;
-		size_t			length;
-		size_t			text_total_len;
-		int				text_len;
-		int				num_dms;
-		int				unmap_length;
-	};
-
-	struct http_ctx		hctx;
-	struct json_ana		ana;
-	int					result;
-	int					recv_length;
-	int					i;
-	int					fd;
-	int					snd_index			= 0;
-	int					rcp_index			= 0;
-	int					twfs_index			= 0;
-	struct new_dms		new_recp_dms		= { NULL, 0, 0, 0, 0 };
-	struct new_dms		new_send_dms		= { NULL, 0, 0, 0, 0 };
-	struct jnode		root;
-	struct jnode		node[ E_DM_NUM ];
-	/* for received dm															*/
-	char				rc_id_str[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
-	char				rc_name[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
-	char				rc_protected[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
-	char				rc_sname[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
-	/* for sent dm																*/
-	char				rc_id_str2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
-	char				rc_name2[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
-	char				rc_protected2[ ]	= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
-	char				rc_sname2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_RECP
-											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
-
-	/* for received dm															*/
-	char				sd_id_str[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
-	char				sd_name[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
-	char				sd_protected[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
-	char				sd_sname[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
-	/* for sent dm																*/
-	char				sd_id_str2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_ID_STR;
-	char				sd_name2[ ]			= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_NAME;
-	char				sd_protected2[ ]	= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_PROTECTED;
-	char				sd_sname2[ ]		= "/" DEF_TWAPI_OBJ_DM_USR_SEND
-											  "/" DEF_TWAPI_OBJ_DM_USR_SNAME;
-
-	if( ( result = getDirectMessages( session, &hctx, recv_last ) ) < 0 )
-	{
-		return( result );
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* buffer for received new dm tweets										*/
-	/* ------------------------------------------------------------------------ */
-	new_send_dms.dms = mmap( NULL, hctx.content_length + 1,
-							 PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
-	
-	if( new_send_dms.dms == MAP_FAILED )
-	{
-		recv_length = hctx.content_length;
-		while( recv_length-- )
-		{
-			if( recvSSLMessage( session, ( unsigned char* )sd_id_str, 1 ) < 0 )
-			{
-				break;
-			}
-		}
-
-		logMessage( "cannot map [new_send_dms]%s\n", strerror( errno ) );
-
-		return( -1 );
-	}
-
-	new_send_dms.unmap_length = hctx.content_length + 1;
-
-	/* ------------------------------------------------------------------------ */
-	/* receive recieved dm tweets of json structure								*/
-	/* ------------------------------------------------------------------------ */
-	if( recvSSLMessage( session,
-						( unsigned char* )new_send_dms.dms,
-						hctx.content_length ) < 0 )
-	{
-		munmap( new_send_dms.dms, hctx.content_length );
-		//disconnectSSLServer( session );
-		logMessage( "failed to recv ssl message at readDM\n" );
-		return( -1 );
-	}
-
-	for( i = 0 ; i < E_DM_NUM ; i++ )
-	{
-		node[ i ].value = NULL;
-	}
-
-	/* ------------------------------------------------------------------------ */
-	/* make json lookup structure												*/
-	/* ------------------------------------------------------------------------ */
-	initJsonRoot( &root );
-
-	/* created_at																*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_CREATED_AT,
-					 &node[ E_DM_CREATED_AT		] );
-	/* id_str																	*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_ID_STR,
-					 &node[ E_DM_ID_STR			] );
-	/* sender																	*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_USR_SEND,
-					 &node[ E_DM_SEND			] );
-	/* sender/id_str															*/
-	insertJsonNodes( &root, sd_id_str,
-					 &node[ E_DM_SEND_ID_STR	] );
-	/* sender/name																*/
-	insertJsonNodes( &root, sd_name,
-					 &node[ E_DM_SEND_NAME		] );
-	/* sender/protected															*/
-	insertJsonNodes( &root, sd_protected,
-					 &node[ E_DM_SEND_PROTECTED	] );
-	/* sender/screen_name														*/
-	insertJsonNodes( &root, sd_sname,
-					 &node[ E_DM_SEND_SNAME		] );
-	/* text																		*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_TEXT,
-					 &node[ E_DM_TEXT			] );
-	/* recipient																*/
-	insertJsonNodes( &root, "/" DEF_TWAPI_OBJ_DM_USR_RECP,
-					 &node[ E_DM_RECP			] );
-	/* recipient/id_str															*/
-	insertJsonNodes( &root, rc_id_str,
-					 &node[ E_DM_RECP_ID_STR	] );
-	/* recipient/name															*/
-	insertJsonNodes( &root, rc_name,
-					 &node[ E_DM_RECP_NAME		] );
-	/* recipient/protected														*/
-	insertJsonNodes( &root, rc_protected,
-					 &node[ E_DM_RECP_PROTECTED	] );
-	/* recipietn/screen_name													*/
-	insertJsonNodes( &root, rc_sname,
-					 &node[ E_DM_RECP_SNAME		] );
-
-	/* ------------------------------------------------------------------------ */
-	/* prepare for analyzing json structure										*/
-	/* ------------------------------------------------------------------------ */
-	initJsonAnalysisCtx( &ana );
-
-	/* ------------------------------------------------------------------------ */
-	/* receive body and analyze json structre									*/
-	/* ------------------------------------------------------------------------ */
-	while( ana.length < hctx.content_length )
-	{
-		char	buffer[ 1024 ];
-		int		buf_len;
-		int		ana_result;
-
-		ana_result = analyzeJson( session, &hctx,
-								  ( uint8_t* )new_send_dms.dms,
-								  &ana, &root,
-								  0,
-								  ( uint8_t* )buffer, sizeof( buffer ) );
-
-		if( ana_result < 0 )
-		{
-			for( i = 0 ; i < E_DM_NUM ; i++ )
-			{
-				free( node[ i ].value );
-				node[ i ].value = NULL;
-			}
-			logMessage( "error analyzing json\n" );
-			return( -1 );
-		}
-
-		if( ( node[ E_DM_SEND_ID_STR	].value == NULL ) ||
-			( node[ E_DM_SEND_NAME		].value == NULL ) ||
-			( node[ E_DM_SEND_SNAME		].value == NULL ) ||
-			( node[ E_DM_RECP_NAME		].value == NULL ) ||
-			( node[ E_DM_RECP_SNAME		].value == NULL ) )
-		{
-			for( i = 0 ; i < E_DM_NUM ; i++ )
-			{
-				free( node[ i ].value );
-				node[ i ].value = NULL;
-			}
-
-			if( ana_result == 0 )
-			{
-				if( new_send_dms.num_dms == 0 )
-				{
-					logMessage( " node is null at readDM\n" );
-					return( -1 );
-				}
-				break;
-			}
-			continue;
-		}
-
-#if 0
-		for( i = 0 ; i < E_DM_NUM ; i++ )
-		{
-			if( node[ i ].value != NULL )
-			logMessage( "%s:%s\n", node[i].obj, node[i ].value );
-		}
-#endif
-
-		/* -------------------------------------------------------------------- */
-		/* path to [screen_name]/direct_message/[screen_name]/[tweet id]		*/
-		/* -------------------------------------------------------------------- */
-		snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  getTwapiScreenName( ),
-				  DEF_TWFS_PATH_DIR_DM,
-				  node[ E_DM_SEND_SNAME ].value );
-		
-		if( ( result = isDirectory( buffer ) ) < 0 )
-		{
-			result = makeUserDirectMessageDir( getTwapiScreenName( ),
-											   node[ E_DM_SEND_SNAME ].value,
-											   true );
-
-			if( result < 0 )
-			{
-				for( i = 0 ; i < E_DM_NUM ; i++ )
-				{
-					free( node[ i ].value );
-					node[ i ].value = NULL;
-				}
-				
-				if( ana_result == 0 )
-				{
-					if( new_send_dms.num_dms == 0 )
-					{
-						return( -1 );
-					}
-					break;
-				}
-				/* try next tweet												*/
-				continue;
-			}
-		}
-
-		snprintf( buffer, sizeof( buffer ), "%s/%s/%s/%s/%s",
-				  getRootDirPath( ),
-				  getTwapiScreenName( ),
-				  DEF_TWFS_PATH_DIR_DM,
-				  node[ E_DM_SEND_SNAME ].value,
-				  node[ E_DM_ID_STR ].value );
-
-		fd = openFile( buffer, O_WRONLY | O_TRUNC | O_CREAT, 0660 );
-
-		if( 0 <= fd )
-		{
-			/* ---------------------------------------------------------------- */
-			/* tweet id															*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"id:%s\n",
-								node[ E_DM_ID_STR ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_send_dms.text_len = buf_len;
-			/* copy id															*/
-			memcpy( new_send_dms.dms + new_send_dms.length,
-					buffer + 3,
-					buf_len - 4 );
-			new_send_dms.length += buf_len - 4;	// without '\n'
-			/* fill residual space												*/
-			buf_len = DEF_TWFS_ID_FIELD + DEF_TWFS_ID_FIELD_NEXT - ( buf_len - 4 );
-			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
-			new_send_dms.length += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* [user name] @ [screen name]										*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"To  :%s @%s\nFrom:%s @%s\n",
-								node[ E_DM_RECP_NAME ].value,
-								node[ E_DM_RECP_SNAME ].value,
-								node[ E_DM_SEND_NAME ].value,
-								node[ E_DM_SEND_SNAME ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_send_dms.text_len += buf_len;
-			/* copy screen name													*/
-			buf_len = node[ E_DM_SEND_SNAME ].length;
-			memcpy( new_send_dms.dms + new_send_dms.length,
-					node[ E_DM_SEND_SNAME ].value,
-					buf_len );
-			new_send_dms.length += buf_len;
-			/* fill residual space											*/
-			buf_len = DEF_TWFS_SNAME_FIELD
-					  + DEF_TWFS_SNAME_FIELD_NEXT
-					  - buf_len;
-			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
-			new_send_dms.length += buf_len;
-			/* fill SEND flag													*/
-			*( new_send_dms.dms + new_send_dms.length ++ ) = 's';
-			*( new_send_dms.dms + new_send_dms.length ++ ) = 0x00;
-			*( new_send_dms.dms + new_send_dms.length ++ ) = '0';
-			*( new_send_dms.dms + new_send_dms.length ++ ) = '0';
-			*( new_send_dms.dms + new_send_dms.length ++ ) = 0x00;
-
-			/* ---------------------------------------------------------------- */
-			/* [text]															*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ), "%s\n",
-								node[ E_DM_TEXT ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_send_dms.text_len += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* [created_at]														*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ), "%s\n\n",
-								node[ E_DM_CREATED_AT ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_send_dms.text_len += buf_len;
-			/* ---------------------------------------------------------------- */
-			/* separator														*/
-			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"---------------------------------------------\n" );
-			writeFile( fd, ( const void* )buffer, buf_len );
-			new_recp_dms.text_len += buf_len;
-
-			closeFile( fd );
-
-			/* fill text length													*/
-			buf_len = snprintf( ( char* )( new_send_dms.dms + new_send_dms.length ),
-								DEF_TWFS_TEXT_LEN_FIELD,
-								"%d", new_send_dms.text_len );
-			new_send_dms.length += buf_len;
-			/* update total size of message file								*/
-			twfs_file->tl_size			+= new_send_dms.text_len;
-			new_send_dms.text_total_len	+= new_send_dms.text_len;
-			/* fill residual space												*/
-			buf_len = DEF_TWFS_TEXT_LEN_FIELD - buf_len;
-			memset( new_send_dms.dms + new_send_dms.length, 0x00, buf_len );
-			new_send_dms.length += buf_len;
-			*( new_send_dms.dms + new_send_dms.length++ ) = '\n';
-
-			new_send_dms.num_dms++;
-		}
-
-		for( i = 0 ; i < E_DM_NUM ; i++ )
-		{
-			free( node[ i ].value );
-			node[ i ].value = NULL;
-		}
-
-		if( ana_result == 0 )
-		{
-			if( new_send_dms.num_dms == 0 )
-			{
-				return( -1 );
-			}
-			/* ---------------------------------------------------------------- */
-			/* analysis is done!												*/
+			/* analysis is done!												*/
 			/* ---------------------------------------------------------------- */
 			logMessage( "analysis is done!\n" );
 			break;
@@ -5051,9 +3537,10 @@ int readDM( E_TWFS_REQ requset,
 	/* ------------------------------------------------------------------------ */
 	while( ana.length < hctx.content_length )
 	{
-		char	buffer[ 1024 ];
-		int		buf_len;
-		int		ana_result;
+		char				buffer[ 1024 ];
+		int					buf_len;
+		int					ana_result;
+		struct twfs_status	status;
 
 		ana_result = analyzeJson( session, &hctx,
 								  ( uint8_t* )new_recp_dms.dms,
@@ -5159,14 +3646,13 @@ int readDM( E_TWFS_REQ requset,
 			/* ---------------------------------------------------------------- */
 			/* tweet id															*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"id:%s\n",
-								node[ E_DM_ID_STR ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
+			status.len = 0;
+			buf_len = printTwfsStatus( &status, "id:%s\n",
+									   node[ E_DM_ID_STR ].value );
 			new_recp_dms.text_len = buf_len;
 			/* copy id															*/
 			memcpy( new_recp_dms.dms + new_recp_dms.length,
-					buffer + 3,
+					node[ E_DM_ID_STR ].value,
 					buf_len - 4 );
 			new_recp_dms.length += buf_len - 4;	// without '\n'
 			/* fill residual space												*/
@@ -5176,13 +3662,12 @@ int readDM( E_TWFS_REQ requset,
 			/* ---------------------------------------------------------------- */
 			/* [user name] @ [screen name]										*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"To  :%s @%s\nFrom:%s @%s\n",
-								node[ E_DM_RECP_NAME ].value,
-								node[ E_DM_RECP_SNAME ].value,
-								node[ E_DM_SEND_NAME ].value,
-								node[ E_DM_SEND_SNAME ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
+			buf_len = printTwfsStatus( &status,
+									   "To  :%s @%s\nFrom:%s @%s\n",
+									   node[ E_DM_RECP_NAME ].value,
+									   node[ E_DM_RECP_SNAME ].value,
+									   node[ E_DM_SEND_NAME ].value,
+									   node[ E_DM_SEND_SNAME ].value );
 			new_recp_dms.text_len += buf_len;
 			/* copy screen name													*/
 			buf_len = node[ E_DM_RECP_SNAME ].length;
@@ -5206,25 +3691,24 @@ int readDM( E_TWFS_REQ requset,
 			/* ---------------------------------------------------------------- */
 			/* [text]															*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ), "%s\n",
-								node[ E_DM_TEXT ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
+			buf_len = printTwfsStatus( &status, "%s\n",
+									   node[ E_DM_TEXT ].value );
 			new_recp_dms.text_len += buf_len;
 			/* ---------------------------------------------------------------- */
 			/* [created_at]														*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ), "%s\n\n",
-								node[ E_DM_CREATED_AT ].value );
-			writeFile( fd, ( const void* )buffer, buf_len );
+			buf_len = printTwfsStatus( &status, "%s\n\n",
+									   node[ E_DM_CREATED_AT ].value );
 			new_recp_dms.text_len += buf_len;
 			/* ---------------------------------------------------------------- */
 			/* separator														*/
 			/* ---------------------------------------------------------------- */
-			buf_len = snprintf( buffer, sizeof( buffer ),
-								"---------------------------------------------\n" );
-			writeFile( fd, ( const void* )buffer, buf_len );
+			buf_len = printTwfsStatus( &status,
+									   "---------------------------------------------\n" );
 			new_recp_dms.text_len += buf_len;
 
+			writeFile( fd, ( const void* )status.text, status.len );
+
 			closeFile( fd );
 
 			/* fill text length													*/
@@ -5473,15 +3957,15 @@ int readDM( E_TWFS_REQ requset,
 	/* ------------------------------------------------------------------------ */
 	if( DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN < twfs_file->size )
 	{
-		result = ftruncate( twfs_file->fd,
-							twfs_file->size
-							+ ( DEF_TWFS_TL_RECORD_LEN * twfs_index ) );
+		result = resizeTwfsFile( twfs_file,
+								 twfs_file->size
+								 + ( DEF_TWFS_TL_RECORD_LEN * twfs_index ) );
 	}
 	else
 	{
-		result = ftruncate( twfs_file->fd,
-							DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-							+ ( DEF_TWFS_TL_RECORD_LEN * twfs_index ) );
+		result = resizeTwfsFile( twfs_file,
+								 DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
+								 + ( DEF_TWFS_TL_RECORD_LEN * twfs_index ) );
 	}
 
 	/* ------------------------------------------------------------------------ */
@@ -5878,7 +4362,10 @@ int readDM( E_TWFS_REQ requset,
 
 	if( twfs_index )
 	{
-		msync( twfs_file->tl, twfs_file->size, MS_SYNC );
+		queueTwfsFileFlush( twfs_file,
+							DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
+							DEF_TWFS_TL_RECORD_LEN * twfs_index );
+		updateTwfsAttrCache( twfs_file );
 	}
 
 	munmap( new_send_dms.dms, new_send_dms.unmap_length );
@@ -5952,6 +4439,7 @@ int readUsers( E_TWFS_REQ request,
 	int					i;
 	int					fd;
 	struct new_usr		new_usr = { NULL, 0, 0, 0};
+	bool				next_cursor;
 	struct jnode		root;
 	struct jnode		node[ E_LIST_NUM ];
 	char				usr_created_at[ ]	= "/" DEF_TWAPI_OBJ_USRS
@@ -6129,6 +4617,9 @@ int readUsers( E_TWFS_REQ request,
 	/* ------------------------------------------------------------------------ */
 	initJsonAnalysisCtx( &ana );
 
+	/* a page without users still has the cursor, the last one is "0"			*/
+	next_cursor = false;
+
 	/* ------------------------------------------------------------------------ */
 	/* allocat space for next_cursor, previsou_cursor							*/
 	/* ------------------------------------------------------------------------ */
@@ -6191,6 +4682,7 @@ int readUsers( E_TWFS_REQ request,
 						0x00, res_len );
 				*( new_usr.users
 				   + DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ) = '\n';
+				next_cursor = true;
 			}
 			if( node[ E_LIST_PREV_CUR ].value	!= NULL )
 			{
@@ -6221,7 +4713,7 @@ int readUsers( E_TWFS_REQ request,
 			if( ana_result == 0 )
 			{
 				logMessage( "analyzed finish(%d)!!!\n", new_usr.num_usrs );
-				if( new_usr.num_usrs == 0 )
+				if( ( new_usr.num_usrs == 0 ) && !next_cursor )
 				{
 					munmap( new_usr.users, hctx.content_length + 1 );
 					return( -1 );
@@ -6247,7 +4739,14 @@ int readUsers( E_TWFS_REQ request,
 
 		if( ( result = isDirectory( buffer ) ) < 0 )
 		{
-			result = makeUserHomeDirectory( node[ E_USR_SNAME ].value, true );
+			/* only account is needed for profile, the rest is made on access	*/
+			result = registerTwfsUser( node[ E_USR_ID_STR ].value,
+									   node[ E_USR_SNAME ].value );
+
+			if( 0 <= result )
+			{
+				result = makeUserAccountDir( node[ E_USR_SNAME ].value, true );
+			}
 
 			if( result < 0 )
 			{
@@ -6716,6 +5215,7 @@ int readUsers( E_TWFS_REQ request,
 					0x00, res_len );
 			*( new_usr.users
 			   + DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ) = '\n';
+			next_cursor = true;
 		}
 		if( node[ E_LIST_PREV_CUR ].value	!= NULL )
 		{
@@ -6745,7 +5245,7 @@ int readUsers( E_TWFS_REQ request,
 
 		if( ana_result == 0 )
 		{
-			if( new_usr.num_usrs == 0 )
+			if( ( new_usr.num_usrs == 0 ) && !next_cursor )
 			{
 				munmap( new_usr.users, hctx.content_length + 1 );
 				return( -1 );
@@ -6761,15 +5261,15 @@ int readUsers( E_TWFS_REQ request,
 #if 1
 	if( DEF_TWFS_HEAD_FF_LEN < twfs_file->size )
 	{
-		result = ftruncate( twfs_file->fd,
-							twfs_file->size
-							+ ( DEF_TWFS_TL_RECORD_LEN * new_usr.num_usrs ) );
+		result = resizeTwfsFile( twfs_file,
+								 twfs_file->size
+								 + ( DEF_TWFS_TL_RECORD_LEN * new_usr.num_usrs ) );
 	}
 	else
 	{
-		result = ftruncate( twfs_file->fd,
-							DEF_TWFS_HEAD_FF_LEN
-							+ ( DEF_TWFS_TL_RECORD_LEN * new_usr.num_usrs ) );
+		result = resizeTwfsFile( twfs_file,
+								 DEF_TWFS_HEAD_FF_LEN
+								 + ( DEF_TWFS_TL_RECORD_LEN * new_usr.num_usrs ) );
 	}
 
 	if( result < 0 )
@@ -6808,9 +5308,10 @@ int readUsers( E_TWFS_REQ request,
 				new_usr.num_usrs * DEF_TWFS_TL_RECORD_LEN );
 	}
 	/* ------------------------------------------------------------------------ */
-	/* update total follwer/following list file size							*/
+	/* update total follwer/following list file size. an empty list has only	*/
+	/* header with the last cursor												*/
 	/* ------------------------------------------------------------------------ */
-	if( new_usr.num_usrs )
+	if( new_usr.num_usrs || next_cursor )
 	{
 		result = snprintf( twfs_file->tl,
 						   DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
@@ -6835,7 +5336,11 @@ int readUsers( E_TWFS_REQ request,
 		}
 	
 
-		msync( twfs_file->tl, twfs_file->size, MS_SYNC );
+		shareTwfsFileSize( twfs_file );
+		queueTwfsFileFlush( twfs_file,
+							DEF_TWFS_HEAD_FF_LEN,
+							DEF_TWFS_TL_RECORD_LEN * new_usr.num_usrs );
+		updateTwfsAttrCache( twfs_file );
 	}
 #endif
 	munmap( new_usr.users, hctx.content_length + 1 );
@@ -7131,6 +5636,7 @@ int readLists( E_TWFS_REQ request,
 	int					i;
 	int					fd;
 	struct new_lst		new_lst = { NULL, 0, 0, 0 };
+	bool				next_cursor;
 	struct jnode		root;
 	struct jnode		node[ E_LISTS_NUM ];
 	char				lst_name[ ]			= "/" DEF_TWAPI_OBJ_LISTS
@@ -7266,6 +5772,9 @@ int readLists( E_TWFS_REQ request,
 	/* ------------------------------------------------------------------------ */
 	initJsonAnalysisCtx( &ana );
 
+	/* a page without lists still has the cursor, the last one is "0"			*/
+	next_cursor = false;
+
 	/* ------------------------------------------------------------------------ */
 	/* allocat space for next_cursor, previsou_cursor							*/
 	/* ------------------------------------------------------------------------ */
@@ -7324,6 +5833,7 @@ int readLists( E_TWFS_REQ request,
 						0x00, res_len );
 				*( new_lst.lists
 				   + DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ) = '\n';
+				next_cursor = true;
 			}
 			if( node[ E_LIST_PREV_CUR ].value	!= NULL )
 			{
@@ -7352,7 +5862,7 @@ int readLists( E_TWFS_REQ request,
 			}
 			if( ana_result == 0 )
 			{
-				if( new_lst.num_lsts == 0 )
+				if( ( new_lst.num_lsts == 0 ) && !next_cursor )
 				{
 					munmap( new_lst.lists, hctx.content_length + 1 );
 					return( -1 );
@@ -7717,6 +6227,7 @@ int readLists( E_TWFS_REQ request,
 					0x00, res_len );
 			*( new_lst.lists
 			   + DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD ) = '\n';
+			next_cursor = true;
 		}
 		if( node[ E_LIST_PREV_CUR ].value	!= NULL )
 		{
@@ -7746,7 +6257,7 @@ int readLists( E_TWFS_REQ request,
 
 		if( ana_result == 0 )
 		{
-			if( new_lst.num_lsts == 0 )
+			if( ( new_lst.num_lsts == 0 ) && !next_cursor )
 			{
 				munmap( new_lst.lists, hctx.content_length + 1 );
 				return( -1 );
@@ -7763,15 +6274,15 @@ int readLists( E_TWFS_REQ request,
 
 	if( DEF_TWFS_HEAD_FF_LEN < twfs_file->size )
 	{
-		result = ftruncate( twfs_file->fd,
-							twfs_file->size
-							+ ( DEF_TWFS_LISTS_RECORD_LEN * new_lst.num_lsts ) );
+		result = resizeTwfsFile( twfs_file,
+								 twfs_file->size
+								 + ( DEF_TWFS_LISTS_RECORD_LEN * new_lst.num_lsts ) );
 	}
 	else
 	{
-		result = ftruncate( twfs_file->fd,
-							DEF_TWFS_HEAD_FF_LEN
-							+ ( DEF_TWFS_LISTS_RECORD_LEN * new_lst.num_lsts ) );
+		result = resizeTwfsFile( twfs_file,
+								 DEF_TWFS_HEAD_FF_LEN
+								 + ( DEF_TWFS_LISTS_RECORD_LEN * new_lst.num_lsts ) );
 	}
 
 	if( result < 0 )
@@ -7810,9 +6321,10 @@ int readLists( E_TWFS_REQ request,
 				new_lst.num_lsts * DEF_TWFS_LISTS_RECORD_LEN );
 	}
 	/* ------------------------------------------------------------------------ */
-	/* update total lists list file size										*/
+	/* update total lists list file size. an empty list has only header with	*/
+	/* the last cursor															*/
 	/* ------------------------------------------------------------------------ */
-	if( new_lst.num_lsts )
+	if( new_lst.num_lsts || next_cursor )
 	{
 		result = snprintf( twfs_file->tl,
 						   DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN,
@@ -7837,7 +6349,11 @@ int readLists( E_TWFS_REQ request,
 		}
 	
 
-		msync( twfs_file->tl, twfs_file->size, MS_SYNC );
+		shareTwfsFileSize( twfs_file );
+		queueTwfsFileFlush( twfs_file,
+							DEF_TWFS_HEAD_FF_LEN,
+							DEF_TWFS_LISTS_RECORD_LEN * new_lst.num_lsts );
+		updateTwfsAttrCache( twfs_file );
 	}
 
 	munmap( new_lst.lists, hctx.content_length + 1 );
@@ -9256,6 +7772,133 @@ int getTotalSizeOfTlFile( struct twfs_file *twfs_file )
 	return( i );
 }
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsAttrCache
+	Input		:const struct stat *statbuf
+				 < statistics of backing file >
+				 size_t *tl_size
+				 < total size of timeline file >
+	Output		:size_t *tl_size
+				 < total size of timeline file >
+	Return		:int
+				 < -1 : not cached or backing file has been changed >
+	Description	:get total size of timeline file from attribute cache
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsAttrCache( const struct stat *statbuf, size_t *tl_size )
+{
+	struct twfs_attr_cache	*entry;
+	int						result = -1;
+
+	pthread_mutex_lock( &twfs_attr_lock );
+
+	entry = getTwfsAttrCacheEntry( statbuf );
+
+	/* ------------------------------------------------------------------------ */
+	/* record files only grow with their header, so size and mtime tell us		*/
+	/* whether the header has been rewritten since it was cached				*/
+	/* ------------------------------------------------------------------------ */
+	if( entry->valid &&
+		( entry->dev == statbuf->st_dev ) &&
+		( entry->ino == statbuf->st_ino ) &&
+		( entry->size == statbuf->st_size ) &&
+		( entry->mtime.tv_sec == statbuf->st_mtim.tv_sec ) &&
+		( entry->mtime.tv_nsec == statbuf->st_mtim.tv_nsec ) )
+	{
+		*tl_size	= entry->tl_size;
+		result		= 0;
+	}
+
+	pthread_mutex_unlock( &twfs_attr_lock );
+
+	return( result );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setTwfsAttrCache
+	Input		:const struct stat *statbuf
+				 < statistics of backing file >
+				 size_t tl_size
+				 < total size of timeline file >
+	Output		:void
+	Return		:void
+	Description	:cache total size of timeline file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setTwfsAttrCache( const struct stat *statbuf, size_t tl_size )
+{
+	struct twfs_attr_cache	*entry;
+
+	pthread_mutex_lock( &twfs_attr_lock );
+
+	entry = getTwfsAttrCacheEntry( statbuf );
+
+	entry->valid	= true;
+	entry->dev		= statbuf->st_dev;
+	entry->ino		= statbuf->st_ino;
+	entry->size		= statbuf->st_size;
+	entry->mtime	= statbuf->st_mtim;
+	entry->tl_size	= tl_size;
+
+	pthread_mutex_unlock( &twfs_attr_lock );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:updateTwfsAttrCache
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:void
+	Return		:void
+	Description	:cache total size of timeline file which has been updated
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void updateTwfsAttrCache( struct twfs_file *twfs_file )
+{
+	struct stat		statbuf;
+
+	if( fstat( twfs_file->fd, &statbuf ) < 0 )
+	{
+		return;
+	}
+
+	setTwfsAttrCache( &statbuf, twfs_file->tl_size );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:invalidateTwfsAttrCache
+	Input		:const char *r_path
+				 < path to file under root directory >
+	Output		:void
+	Return		:void
+	Description	:drop cached attributes of a file
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void invalidateTwfsAttrCache( const char *r_path )
+{
+	struct twfs_attr_cache	*entry;
+	struct stat				statbuf;
+
+	if( lstat( r_path, &statbuf ) < 0 )
+	{
+		return;
+	}
+
+	pthread_mutex_lock( &twfs_attr_lock );
+
+	entry = getTwfsAttrCacheEntry( &statbuf );
+
+	if( ( entry->dev == statbuf.st_dev ) && ( entry->ino == statbuf.st_ino ) )
+	{
+		entry->valid = false;
+	}
+
+	pthread_mutex_unlock( &twfs_attr_lock );
+}
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:getNextCursorOfTlFileFromFd
@@ -9746,26 +8389,15 @@ size_t readTimeLineFile( struct twfs_file *twfs_file,
 			int		msg_len;
 			int		i;
 
-			msg_len = snprintf( rtw_msg, sizeof( rtw_msg ),
-								"%s", DEF_TWFS_RTW_MESSAGE );
-		
-			for( i = 0 ; i < DEF_TWFS_SNAME_FIELD ; i ++ )
-			{
-				unsigned int	sname;
-				sname = ( unsigned int )( *( tl
-											 + twfs_read->twfs_offset
-											 + DEF_TWFS_OFFSET_SNAME_FIELD
-											 + i ) );
-				if( sname == 0x00 )
-				{
-					rtw_msg[ msg_len + i ] = '\0';
-					msg_len += i;
-					break;
-				}
-				rtw_msg[ msg_len + i ] = ( char )sname;
-			}
+			msg_len = snprintf( rtw_msg, sizeof( rtw_msg ),
+								"%s", DEF_TWFS_RTW_MESSAGE );
+		
+			i = getTwfsRecordScreenName( tl
+										 + twfs_read->twfs_offset
+										 + DEF_TWFS_OFFSET_SNAME_FIELD,
+										 &rtw_msg[ msg_len ] );
 
-			if( DEF_TWFS_SNAME_FIELD < i )
+			if( i < 0 )
 			{
 				/* go to next record												*/
 				twfs_read->state = E_TWFS_READ_NONE;
@@ -9775,6 +8407,7 @@ size_t readTimeLineFile( struct twfs_file *twfs_file,
 			else
 			{
 				int		rtw_offset;
+				msg_len += i;
 				i = 0;
 				rtw_offset = msg_len - ( msg_len -  read_head.off_read_len );
 
@@ -9851,838 +8484,1319 @@ size_t readTimeLineFile( struct twfs_file *twfs_file,
 				}
 			}
 
-			if( DEF_TWFS_TEXT_LEN_FIELD < i )
+			if( DEF_TWFS_TEXT_LEN_FIELD < i )
+			{
+				/* go to next record											*/
+				twfs_read->twfs_offset += tl_record_len;
+				twfs_read->state = E_TWFS_READ_NONE;
+				continue;
+			}
+
+			/* ---------------------------------------------------------------- */
+			/* read id															*/
+			/* ---------------------------------------------------------------- */
+			for( i = 0 ; i < id_len + 1 ; i++ )
+			{
+				unsigned int	temp_id;
+				temp_id = ( unsigned int )( *( tl
+											   + twfs_read->twfs_offset
+											   + id_offset
+											   + i ) );
+				if( ( temp_id - '0' ) < 10u )
+				{
+					id[ i ] = ( char )temp_id;
+					continue;
+				}
+				else if( temp_id == 0x00 )
+				{
+					id[ i ] = '\0';
+					break;
+				}
+				else
+				{
+					/* go to next record										*/
+					i = id_len + 1;
+					break;
+				}
+			}
+
+			if( id_len < i )
+			{
+				/* go to next record											*/
+				twfs_read->twfs_offset += tl_record_len;
+				twfs_read->state = E_TWFS_READ_NONE;
+				continue;
+			}
+	
+			/* ---------------------------------------------------------------- */
+			/* read screen name													*/
+			/* ---------------------------------------------------------------- */
+			if( getTwfsRecordScreenName( tl
+										 + twfs_read->twfs_offset
+										 + sname_offset,
+										 sname ) < 0 )
+			{
+				/* go to next record											*/
+				twfs_read->twfs_offset += tl_record_len;
+				twfs_read->state = E_TWFS_READ_NONE;
+				continue;
+			}
+
+			/* ---------------------------------------------------------------- */
+			/* read text 														*/
+			/* ---------------------------------------------------------------- */
+			switch( file_type )
+			{
+			case	E_TWFS_FILE_AUTH_DM_FR_MSG:
+			case	E_TWFS_FILE_AUTH_DM_MSG:
+				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s/%s",
+												   getRootDirPath( ),
+												   getTwapiScreenName( ),
+												   DEF_TWFS_PATH_DIR_DM,
+												   sname,
+												   id );
+				break;
+			case	E_TWFS_FILE_FL_LIST:
+			case	E_TWFS_FILE_FL_DOT_LIST:
+			case	E_TWFS_FILE_FR_LIST:
+			case	E_TWFS_FILE_FR_DOT_LIST:
+			case	E_TWFS_FILE_BLOCKS_LIST:
+			case	E_TWFS_FILE_DOT_BLOCKS_LIST:
+			case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
+			case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+
+			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
+			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
+			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
+			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+
+			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
+			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
+			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
+			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+
+			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
+			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
+			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
+			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
+				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
+												   getRootDirPath( ),
+												   sname,
+												   DEF_TWFS_PATH_DIR_ACCOUNT,
+												   DEF_TWFS_PATH_PROFILE );
+				break;
+			
+			case	E_TWFS_FILE_LISTS_SUB_LIST:
+			case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
+			case	E_TWFS_FILE_LISTS_OWN_LIST:
+			case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
+			case	E_TWFS_FILE_LISTS_ADD_LIST:
+			case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
+				snprintf( path, DEF_TWFS_PATH_MAX,
+						  "%s/%s/%s/%s/%s/%s",
+						  getRootDirPath( ),
+						  sname,
+						  DEF_TWFS_PATH_DIR_LISTS,
+						  DEF_TWFS_PATH_DIR_OWN,
+						  id,
+						  DEF_TWFS_PATH_LNAME_LDESC );
+
+				break;
+			default:
+				if( *( tl
+					   + twfs_read->twfs_offset
+					   + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
+				{
+					snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
+													   getRootDirPath( ),
+													   sname,
+													   DEF_TWFS_PATH_DIR_RETWEET,
+													   id );
+				}
+				else
+				{
+					snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
+													   getRootDirPath( ),
+													   sname,
+													   DEF_TWFS_PATH_DIR_STATUS,
+													   id );
+				}
+				break;
+			}
+
+			fd = openFile( path, O_RDONLY, 0666 );
+
+			if( fd < 0 )
+			{
+				int		text_offset;
+				//text_offset = text_len - ( text_len - read_head.off_read_len );
+				text_offset = text_len - read_head.off_read_len;
+				logMessage( "<0>read offset %s\n", path );
+				logMessage( "*********************************\n" );
+				logMessage( "text_offset : %d\n", text_offset );
+				/* ------------------------------------------------------------ */
+				/* unable to open or file is removed							*/
+				/* ------------------------------------------------------------ */
+				while( ( text_len - text_offset ) )
+				{
+					*( buf + read_head.read_len ) = ' ';
+					size--;
+					text_len--;
+					if( ( text_len - text_offset ) <= 0 )
+					{
+						*( buf + read_head.read_len ) = '\n';
+					}
+					if( !size )
+					{
+						return( read_head.read_len );
+					}
+					read_head.read_len++;
+				}
+
+				read_head.off_read_len = 0;
+				break;
+			}
+			else
+			{
+				int		sfile_len;
+				int		text_offset;
+				logMessage( "read offset\n" );
+				logMessage( "*********************************\n" );
+				logMessage( "read_head.off_read_len:%zu\n", read_head.off_read_len );
+				logMessage( "text_len:%d\n", text_len );
+				//text_offset = text_len - ( text_len - read_head.off_read_len );
+				text_offset = text_len - read_head.off_read_len;
+				logMessage( "text_offset : %d\n", text_offset );
+				//logMessage( "text_len - text_offset:%d\n", text_len - text_offset );
+				logMessage( "size:%zu\n", size );
+
+				if( ( text_len - read_head.off_read_len ) < size )
+				{
+					sfile_len = preadFile( fd,
+										   &buf[ read_head.read_len ],
+										   text_len - text_offset,
+										   text_offset );
+					logMessage( "pread:%s\n", &buf[ read_head.read_len ] );
+				}
+				else
+				{
+					sfile_len = preadFile( fd,
+										   &buf[ read_head.read_len ],
+										   size,
+										   text_offset );
+					closeFile( fd );
+					logMessage( "pread2:%s\n", &buf[ read_head.read_len ] );
+					
+					/* read is completed										*/
+					return( read_head.read_len + size );
+				}
+
+				read_head.read_len		+= sfile_len;
+				read_head.off_read_len	= 0;
+				size					-= sfile_len;
+				closeFile( fd );
+				if( sfile_len < 0 )
+				{
+					sfile_len = 0;
+				}
+
+				/* here residential content is read, go to next					*/
+				twfs_read->twfs_offset += tl_record_len;
+				//twfs_read->twfs_offset += text_len - text_offset;
+				twfs_read->state = E_TWFS_READ_NONE;
+				break;
+			}
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if( twfs_file->size
+		<= ( twfs_read->twfs_offset + offset_of_body ) )
+	{
+		if( save_size == size )
+		{
+			logMessage( "<2>end of file\n" );
+			return( 0 );
+		}
+		else
+		{
+			logMessage( "<3>?????\n" );
+			return( read_head.read_len );
+		}
+	}
+#endif
+	/* ------------------------------------------------------------------------ */
+	/* read contents 															*/
+	/* ------------------------------------------------------------------------ */
+	while( 0 < size )
+	{
+		int		text_len;
+		int		i;
+		int		fd;
+		int		result;
+		//char	id[ DEF_TWFS_ID_FIELD + 1 ];
+		char	id[ DEF_TWFS_SLUG_FIELD + 1 ];
+		char	sname[ DEF_TWFS_SNAME_FIELD + 1 ];
+		char	path[ DEF_TWFS_PATH_MAX ];
+
+		/* -------------------------------------------------------------------- */
+		/* read text length														*/
+		/* -------------------------------------------------------------------- */
+		text_len = 0;
+		for( i = 0 ; i < DEF_TWFS_TEXT_LEN_FIELD + 1 ; i++ )
+		{
+			unsigned int	text_len_1;
+			text_len_1 = ( unsigned int )( *( tl
+											  + twfs_read->twfs_offset
+											  + text_len_offset
+											  + i ) );
+			if( ( text_len_1 - '0' ) < 10u )
 			{
-				/* go to next record											*/
-				twfs_read->twfs_offset += tl_record_len;
-				twfs_read->state = E_TWFS_READ_NONE;
+				text_len_1	= text_len_1 - '0';
+				text_len	= text_len * 10 + text_len_1;
 				continue;
 			}
+			else if( text_len_1 == 0x00 )
+			{
+				break;
+			}
+			else
+			{
+				/* go to next record												*/
+				i = DEF_TWFS_TEXT_LEN_FIELD + 1;
+				break;
+			}
+		}
 
-			/* ---------------------------------------------------------------- */
-			/* read id															*/
-			/* ---------------------------------------------------------------- */
-			for( i = 0 ; i < id_len + 1 ; i++ )
+		if( DEF_TWFS_TEXT_LEN_FIELD < i )
+		{
+			/* go to next record												*/
+			logMessage( "go to next record<0>\n" );
+			twfs_read->twfs_offset += tl_record_len;
+			continue;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* read id																*/
+		/* -------------------------------------------------------------------- */
+		switch( file_type )
+		{
+		case	E_TWFS_FILE_FL_LIST:
+		case	E_TWFS_FILE_FL_DOT_LIST:
+		case	E_TWFS_FILE_FR_LIST:
+		case	E_TWFS_FILE_FR_DOT_LIST:
+		case	E_TWFS_FILE_BLOCKS_LIST:
+		case	E_TWFS_FILE_DOT_BLOCKS_LIST:
+		case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
+		case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
+			id[ 0 ] = '\0';
+			break;
+		default:
+			if( isLists )
 			{
-				unsigned int	temp_id;
-				temp_id = ( unsigned int )( *( tl
-											   + twfs_read->twfs_offset
-											   + id_offset
-											   + i ) );
-				if( ( temp_id - '0' ) < 10u )
-				{
-					id[ i ] = ( char )temp_id;
-					continue;
-				}
-				else if( temp_id == 0x00 )
+				for( i = 0 ; i < id_len + 1 ; i++ )
 				{
-					id[ i ] = '\0';
-					break;
+					id[ i ] = *( tl
+								 + twfs_read->twfs_offset
+								 + id_offset
+								 + i );
+
+					if( id[ i ] == 0x00 )
+					{
+						break;
+					}
 				}
-				else
+			}
+			else
+			{
+				for( i = 0 ; i < id_len + 1 ; i++ )
 				{
-					/* go to next record										*/
-					i = id_len + 1;
-					break;
+					unsigned int	temp_id;
+					temp_id = ( unsigned int )( *( tl
+												   + twfs_read->twfs_offset
+												   + id_offset
+												   + i ) );
+					if( ( temp_id - '0' ) < 10u )
+					{
+						id[ i ] = ( char )temp_id;
+						continue;
+					}
+					else if( temp_id == 0x00 )
+					{
+						id[ i ] = '\0';
+						break;
+					}
+					else
+					{
+						/* go to next record									*/
+						i = id_len + 1;
+						break;
+					}
 				}
 			}
-
+		
 			if( id_len < i )
 			{
 				/* go to next record											*/
+				logMessage( "go to next record<1>\n" );
 				twfs_read->twfs_offset += tl_record_len;
-				twfs_read->state = E_TWFS_READ_NONE;
 				continue;
 			}
-	
-			/* ---------------------------------------------------------------- */
-			/* read screen name													*/
-			/* ---------------------------------------------------------------- */
-			for( i = 0 ; i < DEF_TWFS_SNAME_FIELD + 1 ; i++ )
+
+			break;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* read screen name														*/
+		/* -------------------------------------------------------------------- */
+		if( getTwfsRecordScreenName( tl
+									 + twfs_read->twfs_offset
+									 + sname_offset,
+									 sname ) < 0 )
+		{
+			/* go to next record												*/
+			twfs_read->twfs_offset += tl_record_len;
+			continue;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* copy retweeted message 												*/
+		/* -------------------------------------------------------------------- */
+		if( !isLists )
+		{
+			if( *( tl + twfs_read->twfs_offset + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
 			{
-				unsigned int	temp_sname;
-				temp_sname = ( unsigned int )( *( tl
-												  + twfs_read->twfs_offset
-												  + sname_offset
-												  + i ) );
-				if( temp_sname != 0x00 )
-				{
-					sname[ i ] = ( char )temp_sname;
-				}
-				else
+				char	rtw_msg[ sizeof( DEF_TWFS_RTW_MESSAGE ) + DEF_TWFS_SNAME_FIELD + 1 ];
+				int		msg_len;
+
+				msg_len = snprintf( rtw_msg, sizeof( rtw_msg ),
+									"%s%s\n", DEF_TWFS_RTW_MESSAGE, sname );
+
+				i = 0;
+				while( msg_len-- )
 				{
-					sname[ i ] = '\0';
-					break;
+					*( buf + read_head.read_len++ ) = rtw_msg[ i++ ];
+					size--;
+					if( !size )
+					{
+						logMessage( "<4>?????\n" );
+						return( read_head.read_len );
+					}
 				}
 			}
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* read text 															*/
+		/* -------------------------------------------------------------------- */
+		switch( file_type )
+		{
+		case	E_TWFS_FILE_AUTH_DM_FR_MSG:
+		case	E_TWFS_FILE_AUTH_DM_MSG:
+			snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s/%s",
+											   getRootDirPath( ),
+											   getTwapiScreenName( ),
+											   DEF_TWFS_PATH_DIR_DM,
+											   sname,
+											   id );
+			break;
+		case	E_TWFS_FILE_FL_LIST:
+		case	E_TWFS_FILE_FL_DOT_LIST:
+		case	E_TWFS_FILE_FR_LIST:
+		case	E_TWFS_FILE_FR_DOT_LIST:
+		case	E_TWFS_FILE_BLOCKS_LIST:
+		case	E_TWFS_FILE_DOT_BLOCKS_LIST:
+		case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
+		case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
 
-			if( DEF_TWFS_SNAME_FIELD < i )
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
+			snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
+											   getRootDirPath( ),
+											   sname,
+											   DEF_TWFS_PATH_DIR_ACCOUNT,
+											   DEF_TWFS_PATH_PROFILE );
+			break;
+		case	E_TWFS_FILE_LISTS_SUB_LIST:
+		case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_LIST:
+		case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_LIST:
+		case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
+			snprintf( path, DEF_TWFS_PATH_MAX,
+					  "%s/%s/%s/%s/%s/%s",
+					  getRootDirPath( ),
+					  sname,
+					  DEF_TWFS_PATH_DIR_LISTS,
+					  DEF_TWFS_PATH_DIR_OWN,
+					  id,
+					  DEF_TWFS_PATH_LNAME_LDESC );
+			break;
+		default:
+			if( *( tl
+				   + twfs_read->twfs_offset
+				   + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
 			{
-				/* go to next record											*/
-				twfs_read->twfs_offset += tl_record_len;
-				twfs_read->state = E_TWFS_READ_NONE;
-				continue;
+				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
+												   getRootDirPath( ),
+												   sname,
+												   DEF_TWFS_PATH_DIR_RETWEET,
+												   id );
 			}
-
-			/* ---------------------------------------------------------------- */
-			/* read text 														*/
-			/* ---------------------------------------------------------------- */
-			switch( file_type )
+			else
 			{
-			case	E_TWFS_FILE_AUTH_DM_FR_MSG:
-			case	E_TWFS_FILE_AUTH_DM_MSG:
-				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s/%s",
+				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
 												   getRootDirPath( ),
-												   getTwapiScreenName( ),
-												   DEF_TWFS_PATH_DIR_DM,
 												   sname,
+												   DEF_TWFS_PATH_DIR_STATUS,
 												   id );
-				break;
-			case	E_TWFS_FILE_FL_LIST:
-			case	E_TWFS_FILE_FL_DOT_LIST:
-			case	E_TWFS_FILE_FR_LIST:
-			case	E_TWFS_FILE_FR_DOT_LIST:
-			case	E_TWFS_FILE_BLOCKS_LIST:
-			case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-			case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-			case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
-
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
-
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+			}
+			break;
+		}
 
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-												   getRootDirPath( ),
-												   sname,
-												   DEF_TWFS_PATH_DIR_ACCOUNT,
-												   DEF_TWFS_PATH_PROFILE );
-				break;
-			
-			case	E_TWFS_FILE_LISTS_SUB_LIST:
-			case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_LIST:
-			case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_LIST:
-			case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-				snprintf( path, DEF_TWFS_PATH_MAX,
-						  "%s/%s/%s/%s/%s/%s",
-						  getRootDirPath( ),
-						  sname,
-						  DEF_TWFS_PATH_DIR_LISTS,
-						  DEF_TWFS_PATH_DIR_OWN,
-						  id,
-						  DEF_TWFS_PATH_LNAME_LDESC );
 
-				break;
-			default:
-				if( *( tl
-					   + twfs_read->twfs_offset
-					   + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
+		fd = openFile( path, O_RDONLY, 0000 );
+		if( fd < 0 )
+		{
+			logMessage( "missing path :%s\n", path );
+			while( text_len-- )
+			{
+				if( text_len )
 				{
-					snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-													   getRootDirPath( ),
-													   sname,
-													   DEF_TWFS_PATH_DIR_RETWEET,
-													   id );
+					*( buf + read_head.read_len++ ) = ' ';
 				}
 				else
 				{
-					snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-													   getRootDirPath( ),
-													   sname,
-													   DEF_TWFS_PATH_DIR_STATUS,
-													   id );
+					*( buf + read_head.read_len++ ) = '\n';
+				}
+				size--;
+				if( !size )
+				{
+					logMessage( "<5>?????\n" );
+					return( read_head.read_len );
 				}
-				break;
 			}
-
-			fd = openFile( path, O_RDONLY, 0666 );
-
-			if( fd < 0 )
+		}
+		else
+		{
+			if( size <= text_len )
 			{
-				int		text_offset;
-				//text_offset = text_len - ( text_len - read_head.off_read_len );
-				text_offset = text_len - read_head.off_read_len;
-				logMessage( "<0>read offset %s\n", path );
-				logMessage( "*********************************\n" );
-				logMessage( "text_offset : %d\n", text_offset );
-				/* ------------------------------------------------------------ */
-				/* unable to open or file is removed							*/
-				/* ------------------------------------------------------------ */
-				while( ( text_len - text_offset ) )
+				result = preadFile( fd, &buf[ read_head.read_len ], size, 0 );
+				closeFile( fd );
+				if( result < 0 )
 				{
-					*( buf + read_head.read_len ) = ' ';
-					size--;
-					text_len--;
-					if( ( text_len - text_offset ) <= 0 )
-					{
-						*( buf + read_head.read_len ) = '\n';
-					}
-					if( !size )
-					{
-						return( read_head.read_len );
-					}
-					read_head.read_len++;
+					result = 0;
 				}
+				result = size;
 
-				read_head.off_read_len = 0;
-				break;
+				/* read is completed											*/
+				logMessage( "<6>?????\n" );
+				return( read_head.read_len + result );
 			}
 			else
 			{
-				int		sfile_len;
-				int		text_offset;
-				logMessage( "read offset\n" );
-				logMessage( "*********************************\n" );
-				logMessage( "read_head.off_read_len:%zu\n", read_head.off_read_len );
-				logMessage( "text_len:%d\n", text_len );
-				//text_offset = text_len - ( text_len - read_head.off_read_len );
-				text_offset = text_len - read_head.off_read_len;
-				logMessage( "text_offset : %d\n", text_offset );
-				//logMessage( "text_len - text_offset:%d\n", text_len - text_offset );
-				logMessage( "size:%zu\n", size );
-
-				if( ( text_len - read_head.off_read_len ) < size )
-				{
-					sfile_len = preadFile( fd,
-										   &buf[ read_head.read_len ],
-										   text_len - text_offset,
-										   text_offset );
-					logMessage( "pread:%s\n", &buf[ read_head.read_len ] );
-				}
-				else
+				result = preadFile( fd, &buf[ read_head.read_len ], text_len, 0 );
+				if( result < 0 )
 				{
-					sfile_len = preadFile( fd,
-										   &buf[ read_head.read_len ],
-										   size,
-										   text_offset );
-					closeFile( fd );
-					logMessage( "pread2:%s\n", &buf[ read_head.read_len ] );
-					
-					/* read is completed										*/
-					return( read_head.read_len + size );
+					result = 0;
 				}
 
-				read_head.read_len		+= sfile_len;
-				read_head.off_read_len	= 0;
-				size					-= sfile_len;
-				closeFile( fd );
-				if( sfile_len < 0 )
-				{
-					sfile_len = 0;
-				}
+				closeFile( fd );
+				//result = text_len;
+
+				read_head.read_len += result;
+				size -= result;
+			}
+		}
+
+		/* go to next record													*/
+		twfs_read->twfs_offset += tl_record_len;
+
+		if( twfs_file->size
+			<= ( twfs_read->twfs_offset + offset_of_body ) )
+		{
+			break;
+		}
+	}
+
+	logMessage( "eof : size : %d\n", read_head.read_len );
+
+	/* EOF																		*/
+	if( save_size == size )
+	{
+		return( 0 );
+	}
+	else
+	{
+		//return( save_size - read_head.read_len );
+		//buf[ read_head.read_len + 1] = 0x00;
+		return( read_head.read_len );
+	}
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:isTwitterId
+	Input		:const char *id_file
+				 < condidate file name of id or id string >
+	Output		:void
+	Return		:bool
+				 < true: id >
+	Description	:test whether file path name or id string is id file or not
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+bool isTwitterId( const char *id_file )
+{
+	int		i;
+
+	for( i = 0 ; i < DEF_TWAPI_MAX_USER_ID_LEN ; i++ )
+	{
+		unsigned int	digi;
+		digi = ( unsigned int )( *( id_file + i ) );
+
+		if( digi == 0 || digi == ' ' )
+		{
+			return( true );
+		}
+		else
+		{
+			if( 10 <= ( digi - '0' ) )
+			{
+				return( false );
+			}
+		}
+	}
+
+	return( false );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:makeUserListsSlugDir
+	Input		:const char *screen_name
+				 < screen name >
+				 const char *slug
+				 < slug of list >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/lists/my_list/slug directory
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int makeUserListsSlugDir( const char *screen_name, const char *slug )
+{
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
+
+	/* ------------------------------------------------------------------------ */
+	/* make slug directory														*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a directory : %s\n", path_dir );
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make slug/members directory												*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_MEM );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a directory : %s\n", path_dir );
+		return( result );
+	}
 
-				/* here residential content is read, go to next					*/
-				twfs_read->twfs_offset += tl_record_len;
-				//twfs_read->twfs_offset += text_len - text_offset;
-				twfs_read->state = E_TWFS_READ_NONE;
-				break;
-			}
-		}
-		else
-		{
-			break;
-		}
+	/* ------------------------------------------------------------------------ */
+	/* make slug/subscribers directory											*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_SUB );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a directory : %s\n", path_dir );
+		return( result );
 	}
 
-	if( twfs_file->size
-		<= ( twfs_read->twfs_offset + offset_of_body ) )
+	/* ------------------------------------------------------------------------ */
+	/* make slug/descriptions file												*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_LNAME_LDESC );
+
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
 	{
-		if( save_size == size )
-		{
-			logMessage( "<2>end of file\n" );
-			return( 0 );
-		}
-		else
-		{
-			logMessage( "<3>?????\n" );
-			return( read_head.read_len );
-		}
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
 	}
-#endif
+
 	/* ------------------------------------------------------------------------ */
-	/* read contents 															*/
+	/* make slug/timeline file													*/
 	/* ------------------------------------------------------------------------ */
-	while( 0 < size )
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_LNAME_TL );
+
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
 	{
-		int		text_len;
-		int		i;
-		int		fd;
-		int		result;
-		//char	id[ DEF_TWFS_ID_FIELD + 1 ];
-		char	id[ DEF_TWFS_SLUG_FIELD + 1 ];
-		char	sname[ DEF_TWFS_SNAME_FIELD + 1 ];
-		char	path[ DEF_TWFS_PATH_MAX ];
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
+	}
 
-		/* -------------------------------------------------------------------- */
-		/* read text length														*/
-		/* -------------------------------------------------------------------- */
-		text_len = 0;
-		for( i = 0 ; i < DEF_TWFS_TEXT_LEN_FIELD + 1 ; i++ )
-		{
-			unsigned int	text_len_1;
-			text_len_1 = ( unsigned int )( *( tl
-											  + twfs_read->twfs_offset
-											  + text_len_offset
-											  + i ) );
-			if( ( text_len_1 - '0' ) < 10u )
-			{
-				text_len_1	= text_len_1 - '0';
-				text_len	= text_len * 10 + text_len_1;
-				continue;
-			}
-			else if( text_len_1 == 0x00 )
-			{
-				break;
-			}
-			else
-			{
-				/* go to next record												*/
-				i = DEF_TWFS_TEXT_LEN_FIELD + 1;
-				break;
-			}
-		}
+	/* ------------------------------------------------------------------------ */
+	/* make slug/members/list file												*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_MEM,
+					   DEF_TWFS_PATH_LNAME_MEM_LIST );
 
-		if( DEF_TWFS_TEXT_LEN_FIELD < i )
-		{
-			/* go to next record												*/
-			logMessage( "go to next record<0>\n" );
-			twfs_read->twfs_offset += tl_record_len;
-			continue;
-		}
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
+	}
 
-		/* -------------------------------------------------------------------- */
-		/* read id																*/
-		/* -------------------------------------------------------------------- */
-		switch( file_type )
-		{
-		case	E_TWFS_FILE_FL_LIST:
-		case	E_TWFS_FILE_FL_DOT_LIST:
-		case	E_TWFS_FILE_FR_LIST:
-		case	E_TWFS_FILE_FR_DOT_LIST:
-		case	E_TWFS_FILE_BLOCKS_LIST:
-		case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-		case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-		case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+	/* ------------------------------------------------------------------------ */
+	/* make slug/members/.list file												*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_MEM,
+					   DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
 
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
+	}
 
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+	/* ------------------------------------------------------------------------ */
+	/* make slug/subscribers/list file											*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_SUB,
+					   DEF_TWFS_PATH_LNAME_SUB_LIST );
 
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-			id[ 0 ] = '\0';
-			break;
-		default:
-			if( isLists )
-			{
-				for( i = 0 ; i < id_len + 1 ; i++ )
-				{
-					id[ i ] = *( tl
-								 + twfs_read->twfs_offset
-								 + id_offset
-								 + i );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
+	}
 
-					if( id[ i ] == 0x00 )
-					{
-						break;
-					}
-				}
-			}
-			else
-			{
-				for( i = 0 ; i < id_len + 1 ; i++ )
-				{
-					unsigned int	temp_id;
-					temp_id = ( unsigned int )( *( tl
-												   + twfs_read->twfs_offset
-												   + id_offset
-												   + i ) );
-					if( ( temp_id - '0' ) < 10u )
-					{
-						id[ i ] = ( char )temp_id;
-						continue;
-					}
-					else if( temp_id == 0x00 )
-					{
-						id[ i ] = '\0';
-						break;
-					}
-					else
-					{
-						/* go to next record									*/
-						i = id_len + 1;
-						break;
-					}
-				}
-			}
-		
-			if( id_len < i )
-			{
-				/* go to next record											*/
-				logMessage( "go to next record<1>\n" );
-				twfs_read->twfs_offset += tl_record_len;
-				continue;
-			}
+	/* ------------------------------------------------------------------------ */
+	/* make slug/subscribers/.list file											*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   slug,
+					   DEF_TWFS_PATH_DIR_LNAME_SUB,
+					   DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
 
-			break;
-		}
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a file : %s\n", path_dir );
+		return( result );
+	}
 
-		/* -------------------------------------------------------------------- */
-		/* read screen name														*/
-		/* -------------------------------------------------------------------- */
-		for( i = 0 ; i < DEF_TWFS_SNAME_FIELD + 1 ; i++ )
-		//for( i = 0 ; i < 20 + 1 ; i++ )
-		{
-			unsigned int	temp_sname;
-			temp_sname = ( unsigned int )( *( tl
-											  + twfs_read->twfs_offset
-											  + sname_offset
-											  + i ) );
+	return( result );
+}
 
-			if( temp_sname != 0x00 )
-			{
-				sname[ i ] = ( char )temp_sname;
-			}
-			else
-			{
-				sname[ i ] = '\0';
-				break;
-			}
-		}
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:makeUserHomeOnAccess
+	Input		:const char *path
+				 < path from mount directory >
+				 bool dir
+				 < true:path itself may be [screen_name] directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make the rest of user home when a user which has been made
+				 with status directory only is accessed first
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int makeUserHomeOnAccess( const char *path, bool dir )
+{
+	struct twfs_user	*user;
+	const char			*end;
+	size_t				len;
+	int					result;
+	char				screen_name[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char				r_path[ DEF_TWFS_PATH_MAX ];
 
-		if( DEF_TWFS_SNAME_FIELD < i )
+	/* ------------------------------------------------------------------------ */
+	/* [screen_name] is the first name of path									*/
+	/* ------------------------------------------------------------------------ */
+	if( *path == '/' )
+	{
+		path++;
+	}
+
+	if( ( end = strchr( path, '/' ) ) )
+	{
+		len = end - path;
+	}
+	else
+	{
+		if( !dir )
 		{
-			/* go to next record												*/
-			twfs_read->twfs_offset += tl_record_len;
-			continue;
+			return( 0 );
 		}
 
-		/* -------------------------------------------------------------------- */
-		/* copy retweeted message 												*/
-		/* -------------------------------------------------------------------- */
-		if( !isLists )
-		{
-			if( *( tl + twfs_read->twfs_offset + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
-			{
-				char	rtw_msg[ sizeof( DEF_TWFS_RTW_MESSAGE ) + DEF_TWFS_SNAME_FIELD + 1 ];
-				int		msg_len;
+		len = strlen( path );
+	}
 
-				msg_len = snprintf( rtw_msg, sizeof( rtw_msg ),
-									"%s%s\n", DEF_TWFS_RTW_MESSAGE, sname );
+	if( ( len == 0 ) ||
+		( DEF_TWAPI_MAX_SCREEN_NAME_LEN <= len ) ||
+		( *path == '.' ) )
+	{
+		return( 0 );
+	}
 
-				i = 0;
-				while( msg_len-- )
-				{
-					*( buf + read_head.read_len++ ) = rtw_msg[ i++ ];
-					size--;
-					if( !size )
-					{
-						logMessage( "<4>?????\n" );
-						return( read_head.read_len );
-					}
-				}
-			}
-		}
+	memcpy( screen_name, path, len );
+	screen_name[ len ] = '\0';
 
-		/* -------------------------------------------------------------------- */
-		/* read text 															*/
-		/* -------------------------------------------------------------------- */
-		switch( file_type )
-		{
-		case	E_TWFS_FILE_AUTH_DM_FR_MSG:
-		case	E_TWFS_FILE_AUTH_DM_MSG:
-			snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s/%s",
-											   getRootDirPath( ),
-											   getTwapiScreenName( ),
-											   DEF_TWFS_PATH_DIR_DM,
-											   sname,
-											   id );
-			break;
-		case	E_TWFS_FILE_FL_LIST:
-		case	E_TWFS_FILE_FL_DOT_LIST:
-		case	E_TWFS_FILE_FR_LIST:
-		case	E_TWFS_FILE_FR_DOT_LIST:
-		case	E_TWFS_FILE_BLOCKS_LIST:
-		case	E_TWFS_FILE_DOT_BLOCKS_LIST:
-		case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
-		case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+	pthread_mutex_lock( &twfs_user_lock );
 
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+	if( ( user = findTwfsUser( screen_name ) ) && user->home )
+	{
+		pthread_mutex_unlock( &twfs_user_lock );
+		return( 0 );
+	}
 
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+	pthread_mutex_unlock( &twfs_user_lock );
 
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
-			snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-											   getRootDirPath( ),
-											   sname,
-											   DEF_TWFS_PATH_DIR_ACCOUNT,
-											   DEF_TWFS_PATH_PROFILE );
-			break;
-		case	E_TWFS_FILE_LISTS_SUB_LIST:
-		case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_LIST:
-		case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_LIST:
-		case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
-			snprintf( path, DEF_TWFS_PATH_MAX,
-					  "%s/%s/%s/%s/%s/%s",
-					  getRootDirPath( ),
-					  sname,
-					  DEF_TWFS_PATH_DIR_LISTS,
-					  DEF_TWFS_PATH_DIR_OWN,
-					  id,
-					  DEF_TWFS_PATH_LNAME_LDESC );
-			break;
-		default:
-			if( *( tl
-				   + twfs_read->twfs_offset
-				   + DEF_TWFS_OFFSET_RTW_FIELD ) == 'R' )
-			{
-				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-												   getRootDirPath( ),
-												   sname,
-												   DEF_TWFS_PATH_DIR_RETWEET,
-												   id );
-			}
-			else
-			{
-				snprintf( path, DEF_TWFS_PATH_MAX, "%s/%s/%s/%s",
-												   getRootDirPath( ),
-												   sname,
-												   DEF_TWFS_PATH_DIR_STATUS,
-												   id );
-			}
-			break;
-		}
+	/* ------------------------------------------------------------------------ */
+	/* lists directory is made last of user home								*/
+	/* ------------------------------------------------------------------------ */
+	snprintf( r_path, sizeof( r_path ), "%s/%s",
+			  getRootDirPath( ), screen_name );
 
+	if( isDirectory( r_path ) < 0 )
+	{
+		return( 0 );
+	}
 
-		fd = openFile( path, O_RDONLY, 0000 );
-		if( fd < 0 )
+	snprintf( r_path, sizeof( r_path ), "%s/%s/%s",
+			  getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_LISTS );
+
+	if( isDirectory( r_path ) < 0 )
+	{
+		if( ( result = makeUserHomeDirectory( screen_name, true ) ) < 0 )
 		{
-			logMessage( "missing path :%s\n", path );
-			while( text_len-- )
-			{
-				if( text_len )
-				{
-					*( buf + read_head.read_len++ ) = ' ';
-				}
-				else
-				{
-					*( buf + read_head.read_len++ ) = '\n';
-				}
-				size--;
-				if( !size )
-				{
-					logMessage( "<5>?????\n" );
-					return( read_head.read_len );
-				}
-			}
+			return( result );
 		}
-		else
-		{
-			if( size <= text_len )
-			{
-				result = preadFile( fd, &buf[ read_head.read_len ], size, 0 );
-				closeFile( fd );
-				if( result < 0 )
-				{
-					result = 0;
-				}
-				result = size;
+	}
 
-				/* read is completed											*/
-				logMessage( "<6>?????\n" );
-				return( read_head.read_len + result );
-			}
-			else
-			{
-				result = preadFile( fd, &buf[ read_head.read_len ], text_len, 0 );
-				if( result < 0 )
-				{
-					result = 0;
-				}
+	pthread_mutex_lock( &twfs_user_lock );
 
-				closeFile( fd );
-				//result = text_len;
+	if( ( user = findTwfsUser( screen_name ) ) ||
+		( user = addTwfsUser( screen_name ) ) )
+	{
+		user->home = true;
+	}
 
-				read_head.read_len += result;
-				size -= result;
-			}
-		}
+	pthread_mutex_unlock( &twfs_user_lock );
 
-		/* go to next record													*/
-		twfs_read->twfs_offset += tl_record_len;
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:void
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:void
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+================================================================================
+	Function	:findTwfsPathRule
+	Input		:E_TWFS_FILE_TYPE state
+				 < directory type where name is >
+				 const char *name
+				 < name in path; not null-terminated >
+				 size_t len
+				 < length of name >
+				 bool dir
+				 < true:another name follows >
+	Output		:void
+	Return		:const struct twfs_path_rule*
+				 < rule matched to name, NULL:no rule matches >
+	Description	:find a rule of the state which matches name
+================================================================================
+*/
+static const struct twfs_path_rule*
+findTwfsPathRule( E_TWFS_FILE_TYPE state,
+				  const char *name,
+				  size_t len,
+				  bool dir )
+{
+	const struct twfs_path_rule	*rule;
+	int							i;
+
+	if( !twfs_path_grammar[ state ].rules )
+	{
+		return( NULL );
+	}
+
+	for( i = 0 ; i < twfs_path_grammar[ state ].n_rules ; i++ )
+	{
+		rule = &twfs_path_grammar[ state ].rules[ i ];
+
+		if( ( rule->kind == E_TWFS_RULE_FILE ) == dir )
+		{
+			continue;
+		}
 
-		if( twfs_file->size
-			<= ( twfs_read->twfs_offset + offset_of_body ) )
+		switch( rule->match )
 		{
+		case	E_TWFS_MATCH_NAME:
+			/* length and first letter reject most of names					*/
+			if( ( rule->len == len ) &&
+				( rule->name[ 0 ] == name[ 0 ] ) &&
+				( memcmp( rule->name, name, len ) == 0 ) )
+			{
+				return( rule );
+			}
 			break;
+		case	E_TWFS_MATCH_ID:
+			if( isTwitterIdSpan( name, len ) )
+			{
+				return( rule );
+			}
+			break;
+		case	E_TWFS_MATCH_ANY:
+		default:
+			return( rule );
 		}
 	}
 
-	logMessage( "eof : size : %d\n", read_head.read_len );
-
-	/* EOF																		*/
-	if( save_size == size )
-	{
-		return( 0 );
-	}
-	else
-	{
-		//return( save_size - read_head.read_len );
-		//buf[ read_head.read_len + 1] = 0x00;
-		return( read_head.read_len );
-	}
+	return( NULL );
 }
 
 /*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:isTwitterId
-	Input		:const char *id_file
-				 < condidate file name of id or id string >
+================================================================================
+	Function	:isTwitterIdSpan
+	Input		:const char *name
+				 < name in path; not null-terminated >
+				 size_t len
+				 < length of name >
 	Output		:void
 	Return		:bool
-				 < true: id >
-	Description	:test whether file path name or id string is id file or not
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+				 < true:name is twitter id >
+	Description	:same as isTwitterId for not null-terminated name
+================================================================================
 */
-bool isTwitterId( const char *id_file )
+static bool isTwitterIdSpan( const char *name, size_t len )
 {
-	int		i;
+	size_t	i;
 
-	for( i = 0 ; i < DEF_TWAPI_MAX_USER_ID_LEN ; i++ )
+	for( i = 0 ; ( i < len ) && ( i < DEF_TWAPI_MAX_USER_ID_LEN ) ; i++ )
 	{
-		unsigned int	digi;
-		digi = ( unsigned int )( *( id_file + i ) );
-
-		if( digi == 0 || digi == ' ' )
+		if( name[ i ] == ' ' )
 		{
 			return( true );
 		}
-		else
+
+		if( 10 <= ( unsigned int )( name[ i ] - '0' ) )
 		{
-			if( 10 <= ( digi - '0' ) )
-			{
-				return( false );
-			}
+			return( false );
 		}
 	}
 
-	return( false );
+	return( len < DEF_TWAPI_MAX_USER_ID_LEN );
 }
 
 /*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:makeUserListsSlugDir
-	Input		:const char *screen_name
-				 < screen name >
-				 const char *slug
-				 < slug of list >
+================================================================================
+	Function	:copyTwfsPathSpan
+	Input		:char *dst
+				 < buffer to copy to >
+				 size_t size
+				 < size of dst >
+				 const struct twfs_path_span *span
+				 < name to copy >
+	Output		:char *dst
+				 < null-terminated name >
+	Return		:void
+	Description	:copy a name in path to a buffer, truncating it to the size
+================================================================================
+*/
+static void copyTwfsPathSpan( char *dst,
+							  size_t size,
+							  const struct twfs_path_span *span )
+{
+	size_t	len;
+
+	len = span->len;
+
+	if( size <= len )
+	{
+		len = size - 1;
+	}
+
+	memcpy( dst, span->name, len );
+	dst[ len ] = '\0';
+}
+
+/*
+================================================================================
+	Function	:getTwfsAttrCacheEntry
+	Input		:const struct stat *statbuf
+				 < statistics of backing file >
 	Output		:void
+	Return		:struct twfs_attr_cache*
+				 < slot of attribute cache for the file >
+	Description	:get slot of attribute cache. caller must hold twfs_attr_lock
+================================================================================
+*/
+static struct twfs_attr_cache*
+getTwfsAttrCacheEntry( const struct stat *statbuf )
+{
+	uint64_t	hash;
+
+	hash = ( ( uint64_t )statbuf->st_ino * 0x9e3779b97f4a7c15ULL )
+		   ^ ( uint64_t )statbuf->st_dev;
+
+	return( &twfs_attr_cache[ ( hash >> 32 )
+							  & ( DEF_TWFS_ATTR_CACHE_SIZE - 1 ) ] );
+}
+
+/*
+================================================================================
+	Function	:attachTwfsMap
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information, fd and size are set >
+	Output		:struct twfs_file *twfs_file
+				 < map and tl are set >
 	Return		:int
 				 < status >
-	Description	:make [screen_name]/lists/my_list/slug directory
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Description	:share mapping of a file with other handles of the file.
+				 an empty file is mapped when it is written first
+================================================================================
 */
-int makeUserListsSlugDir( const char *screen_name, const char *slug )
+static int attachTwfsMap( struct twfs_file *twfs_file )
 {
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+	struct stat		statbuf;
+	struct twfs_map	*map;
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug directory														*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	if( fstat( twfs_file->fd, &statbuf ) < 0 )
 	{
-		logMessage( "Cannot create a directory : %s\n", path_dir );
-		return( result );
+		return( -1 );
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/members directory												*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_MEM );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	pthread_mutex_lock( &twfs_map_lock );
+
+	for( map = twfs_maps ; map ; map = map->next )
 	{
-		logMessage( "Cannot create a directory : %s\n", path_dir );
-		return( result );
+		if( ( map->dev == statbuf.st_dev ) && ( map->ino == statbuf.st_ino ) )
+		{
+			break;
+		}
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/subscribers directory											*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_SUB );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	if( !map )
 	{
-		logMessage( "Cannot create a directory : %s\n", path_dir );
-		return( result );
+		if( !( map = malloc( sizeof( struct twfs_map ) ) ) )
+		{
+			pthread_mutex_unlock( &twfs_map_lock );
+			return( -1 );
+		}
+
+		map->dev	= statbuf.st_dev;
+		map->ino	= statbuf.st_ino;
+		map->refs	= 0;
+		map->addr		= NULL;
+		map->len		= 0;
+		map->backfill	= false;
+		map->oldest		= false;
+		map->history	= 0;
+		map->inserted	= 0;
+		map->size		= 0;
+		pthread_rwlock_init( &map->lock, NULL );
+
+		map->next	= twfs_maps;
+		twfs_maps	= map;
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/descriptions file												*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_LNAME_LDESC );
+	map->refs++;
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	pthread_mutex_unlock( &twfs_map_lock );
+
+	twfs_file->map = map;
+
+	if( growTwfsMap( twfs_file, statbuf.st_size ) < 0 )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		detachTwfsMap( twfs_file );
+		return( -1 );
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/timeline file													*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_LNAME_TL );
+	/* history saved before the oldest record from now is not seen by handle	*/
+	pthread_rwlock_rdlock( &map->lock );
+	twfs_file->history	= map->history;
+	twfs_file->inserted	= map->inserted;
+	pthread_rwlock_unlock( &map->lock );
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:detachTwfsMap
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+	Output		:struct twfs_file *twfs_file
+				 < map and tl are cleared >
+	Return		:void
+	Description	:unmap a file when its last handle detaches
+================================================================================
+*/
+static void detachTwfsMap( struct twfs_file *twfs_file )
+{
+	struct twfs_map	*map;
+	struct twfs_map	**link;
+
+	if( !( map = twfs_file->map ) )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		return;
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/members/list file												*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_MEM,
-					   DEF_TWFS_PATH_LNAME_MEM_LIST );
+	twfs_file->map	= NULL;
+	twfs_file->tl	= NULL;
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	pthread_mutex_lock( &twfs_map_lock );
+
+	if( --map->refs )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		pthread_mutex_unlock( &twfs_map_lock );
+		return;
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/members/.list file												*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_MEM,
-					   DEF_TWFS_PATH_LNAME_MEM_DOT_LIST );
+	for( link = &twfs_maps ; *link ; link = &( *link )->next )
+	{
+		if( *link == map )
+		{
+			*link = map->next;
+			break;
+		}
+	}
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+	pthread_mutex_unlock( &twfs_map_lock );
+
+	if( map->addr )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		munmap( map->addr, map->len );
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/subscribers/list file											*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_SUB,
-					   DEF_TWFS_PATH_LNAME_SUB_LIST );
+	pthread_rwlock_destroy( &map->lock );
+	free( map );
+}
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+/*
+================================================================================
+	Function	:growTwfsMap
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+				 size_t size
+				 < size of file to cover >
+	Output		:struct twfs_file *twfs_file
+				 < tl is updated to current mapping >
+	Return		:int
+				 < status >
+	Description	:map a file up to size. mapping may move, so readers of the
+				 file are waited for
+================================================================================
+*/
+static int growTwfsMap( struct twfs_file *twfs_file, size_t size )
+{
+	struct twfs_map	*map;
+	char			*addr;
+	size_t			len;
+	long			page;
+
+	map = twfs_file->map;
+
+	pthread_rwlock_wrlock( &map->lock );
+
+	if( map->len < size )
+	{
+		page	= sysconf( _SC_PAGESIZE );
+		len		= ( ( size + page - 1 ) / page ) * page;
+
+		if( map->addr )
+		{
+			addr = mremap( map->addr, map->len, len, MREMAP_MAYMOVE );
+		}
+		else
+		{
+			addr = mmap( NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED,
+						 twfs_file->fd, 0 );
+		}
+
+		if( addr == MAP_FAILED )
+		{
+			pthread_rwlock_unlock( &map->lock );
+			logMessage( "cannot map %zu bytes\n", len );
+			return( -1 );
+		}
+
+		map->addr	= addr;
+		map->len	= len;
+	}
+
+	twfs_file->tl = map->addr;
+
+	pthread_rwlock_unlock( &map->lock );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:resizeTwfsFile
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+				 size_t size
+				 < new size of file >
+	Output		:struct twfs_file *twfs_file
+				 < tl is updated to current mapping >
+	Return		:int
+				 < status >
+	Description	:extend a file to append records and its mapping with it
+================================================================================
+*/
+static int resizeTwfsFile( struct twfs_file *twfs_file, size_t size )
+{
+	if( ftruncate( twfs_file->fd, size ) < 0 )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		return( -1 );
 	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make slug/subscribers/.list file											*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   slug,
-					   DEF_TWFS_PATH_DIR_LNAME_SUB,
-					   DEF_TWFS_PATH_LNAME_SUB_DOT_LIST );
+	return( growTwfsMap( twfs_file, size ) );
+}
 
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, true ) ) < 0 )
+/*
+================================================================================
+	Function	:shareTwfsFileSize
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information of a builder >
+	Output		:void
+	Return		:void
+	Description	:let other handles of a file read records appended so far.
+				 they pick the size up at lockTwfsFile
+================================================================================
+*/
+static void shareTwfsFileSize( struct twfs_file *twfs_file )
+{
+	if( !twfs_file->map )
 	{
-		logMessage( "Cannot create a file : %s\n", path_dir );
-		return( result );
+		return;
 	}
 
-	return( result );
+	pthread_rwlock_wrlock( &twfs_file->map->lock );
+	twfs_file->map->size = twfs_file->size;
+	pthread_rwlock_unlock( &twfs_file->map->lock );
 }
 
 /*
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-	Function	:void
-	Input		:void
+================================================================================
+	Function	:queueTwfsFileFlush
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information updated by a fetch >
+				 size_t head_len
+				 < length of header of the file >
+				 size_t body_len
+				 < length of records written at the end of the file >
 	Output		:void
 	Return		:void
-	Description	:void
-_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Description	:queue header and records written by a fetch to flusher,
+				 records written before are left out
+================================================================================
 */
-/*
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-	< Local Functions >
+static void queueTwfsFileFlush( struct twfs_file *twfs_file,
+								size_t head_len,
+								size_t body_len )
+{
+	queueTwfsFlush( twfs_file->fd, 0, head_len );
+	queueTwfsFlush( twfs_file->fd, twfs_file->size - body_len, body_len );
+}
 
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-*/
 /*
 ================================================================================
 	Function	:makeUserHomeDirectory
@@ -10735,56 +9849,324 @@ static int makeUserHomeDirectory( const char *screen_name, bool daemon )
 				 getTwapiScreenName( ),
 				 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
 	{
-		/* -------------------------------------------------------------------- */
-		/* make notifications directory											*/
-		/* -------------------------------------------------------------------- */
-		if( ( result = makeUserNotificationsDir( screen_name, daemon ) ) < 0 )
+		/* -------------------------------------------------------------------- */
+		/* make notifications directory											*/
+		/* -------------------------------------------------------------------- */
+		if( ( result = makeUserNotificationsDir( screen_name, daemon ) ) < 0 )
+		{
+			return( result );
+		}
+		/* -------------------------------------------------------------------- */
+		/* make blocks directory												*/
+		/* -------------------------------------------------------------------- */
+		if( ( result = makeUserBlocksDir( screen_name, daemon ) ) < 0 )
+		{
+			return( result );
+		}
+	}
+	/* ------------------------------------------------------------------------ */
+	/* make favorites directory													*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result = makeUserFavoritesDir( screen_name, daemon ) ) < 0 )
+	{
+		return( result );
+	}
+	/* ------------------------------------------------------------------------ */
+	/* make follower directory													*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result = makeUserFollowerDir( screen_name, daemon ) ) < 0 )
+	{
+		return( result );
+	}
+	/* ------------------------------------------------------------------------ */
+	/* make following directory													*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result = makeUserFriendsDir( screen_name, daemon ) ) < 0 )
+	{
+		return( result );
+	}
+	/* ------------------------------------------------------------------------ */
+	/* make lists directory														*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result = makeUserListsDir( screen_name, daemon ) ) < 0 )
+	{
+		return( result );
+	}
+	
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:makeUserScreenNameDirectory
+	Input		:const char *screen_name
+				 < screen name >
+				 bool daemon
+				 < true:daemon mode >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name] directory
+================================================================================
+*/
+int makeUserScreenNameDir( const char *screen_name, bool daemon )
+{
+	int			result;
+	char		path_dir[ DEF_TWFS_PATH_MAX ];
+
+	/* ------------------------------------------------------------------------ */
+	/* make screen name directory												*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s",
+					   getRootDirPath( ), screen_name );
+
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make status directory													*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_STATUS );
+
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+	}
+#if 1
+	/* ------------------------------------------------------------------------ */
+	/* make tweet file															*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_TWEET );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		
+		if( daemon )
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+#endif
+
+	/* ------------------------------------------------------------------------ */
+	/* make home_timeline file													*/
+	/* ------------------------------------------------------------------------ */
+	if( strncmp( screen_name,
+				 getTwapiScreenName( ),
+				 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
+	{
+		result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+						   getRootDirPath( ), screen_name, DEF_TWFS_PATH_TL );
+	
+		if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+		{
+			if( daemon )
+			{
+				logMessage( "Cannot create a file : %s\n", path_dir );
+			}
+			else
+			{
+				printf( "Cannot create a file : %s\n", path_dir );
+			}
+			return( result );
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make user_timeline file													*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_USER_TL );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	return( result );
+}
+/*
+================================================================================
+	Function	:makeUserDirectMessageDir
+	Input		:const char *screen_name
+				 < screen name >
+				 const char *frineds_name
+				 < screen name of friends >
+				 bool daemon
+				 < true:daemon mode >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/direct_message/[friends_name] directory
+================================================================================
+*/
+static int makeUserDirectMessageDir( const char *screen_name,
+									 const char *friends_name,
+									 bool daemon )
+{
+	int			name_len;
+	int			result;
+	char		path_dir[ DEF_TWFS_PATH_MAX ];
+
+	/* ------------------------------------------------------------------------ */
+	/* make direct_massage directory											*/
+	/* ------------------------------------------------------------------------ */
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+						 getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_DM );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make direct_massage/[friends_name] directory								*/
+	/* ------------------------------------------------------------------------ */
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+						 getRootDirPath( ),screen_name,
+						 DEF_TWFS_PATH_DIR_DM, friends_name );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
 		{
-			return( result );
+			logMessage( "Cannot create a directory : %s\n", path_dir );
 		}
-		/* -------------------------------------------------------------------- */
-		/* make blocks directory												*/
-		/* -------------------------------------------------------------------- */
-		if( ( result = makeUserBlocksDir( screen_name, daemon ) ) < 0 )
+		else
 		{
-			return( result );
+			printf( "Cannot create a directory : %s\n", path_dir );
 		}
+		return( result );
 	}
+
 	/* ------------------------------------------------------------------------ */
-	/* make favorites directory													*/
+	/* make direct_massage/[friends_name]/message file							*/
 	/* ------------------------------------------------------------------------ */
-	if( ( result = makeUserFavoritesDir( screen_name, daemon ) ) < 0 )
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
+						 getRootDirPath( ),screen_name,
+						 DEF_TWFS_PATH_DIR_DM, friends_name,
+						 DEF_TWFS_PATH_DM_MSG );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
 		return( result );
 	}
+
 	/* ------------------------------------------------------------------------ */
-	/* make follower directory													*/
+	/* make direct_massage/[friends_name]/send_to file							*/
 	/* ------------------------------------------------------------------------ */
-	if( ( result = makeUserFollowerDir( screen_name, daemon ) ) < 0 )
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
+						 getRootDirPath( ),screen_name,
+						 DEF_TWFS_PATH_DIR_DM, friends_name,
+						 DEF_TWFS_PATH_DM_SEND_TO );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
 		return( result );
 	}
+
 	/* ------------------------------------------------------------------------ */
-	/* make following directory													*/
+	/* make direct_massage/message file											*/
 	/* ------------------------------------------------------------------------ */
-	if( ( result = makeUserFriendsDir( screen_name, daemon ) ) < 0 )
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+						 getRootDirPath( ),screen_name,
+						 DEF_TWFS_PATH_DIR_DM,
+						 DEF_TWFS_PATH_DM_MSG );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
 		return( result );
 	}
+
 	/* ------------------------------------------------------------------------ */
-	/* make lists directory														*/
+	/* make direct_massage/send_to file											*/
 	/* ------------------------------------------------------------------------ */
-	if( ( result = makeUserListsDir( screen_name, daemon ) ) < 0 )
+	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+						 getRootDirPath( ),screen_name,
+						 DEF_TWFS_PATH_DIR_DM,
+						 DEF_TWFS_PATH_DM_SEND_TO );
+	
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
 		return( result );
 	}
-	
-	return( 0 );
+	return( result );
 }
 
 /*
 ================================================================================
-	Function	:makeUserScreenNameDirectory
+	Function	:makeUserRetweetDir
 	Input		:const char *screen_name
 				 < screen name >
 				 bool daemon
@@ -10792,20 +10174,21 @@ static int makeUserHomeDirectory( const char *screen_name, bool daemon )
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:make [screen_name] directory
+	Description	:make [screen_name]/retweet directory
 ================================================================================
 */
-int makeUserScreenNameDir( const char *screen_name, bool daemon )
+int makeUserRetweetDir( const char *screen_name, bool daemon )
 {
-	int			result;
-	char		path_dir[ DEF_TWFS_PATH_MAX ];
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
 
 	/* ------------------------------------------------------------------------ */
-	/* make screen name directory												*/
+	/* make profile directory													*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s",
-					   getRootDirPath( ), screen_name );
-
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_RETWEET );
+	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -10816,14 +10199,37 @@ int makeUserScreenNameDir( const char *screen_name, bool daemon )
 		{
 			printf( "Cannot create a directory : %s\n", path_dir );
 		}
+		return( result );
 	}
 
+	return( result );
+}
+
+/*
+================================================================================
+	Function	:makeUserAccountDir
+	Input		:const char *screen_name
+				 < screen name >
+				 bool daemon
+				 < true:daemon mode >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/account directory
+================================================================================
+*/
+int makeUserAccountDir( const char *screen_name, bool daemon )
+{
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
+
 	/* ------------------------------------------------------------------------ */
-	/* make status directory													*/
+	/* make profile directory													*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_STATUS );
-
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_ACCOUNT );
+	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -10834,20 +10240,21 @@ int makeUserScreenNameDir( const char *screen_name, bool daemon )
 		{
 			printf( "Cannot create a directory : %s\n", path_dir );
 		}
+		return( result );
 	}
-#if 1
+
 	/* ------------------------------------------------------------------------ */
-	/* make tweet file															*/
+	/* make profile file														*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_TWEET );
-	
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_ACCOUNT,
+					   DEF_TWFS_PATH_PROFILE );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
-		
 		if( daemon )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			logMessage( "Cannot create a file : %s\n", path_dir );
 		}
 		else
 		{
@@ -10855,38 +10262,95 @@ int makeUserScreenNameDir( const char *screen_name, bool daemon )
 		}
 		return( result );
 	}
-#endif
 
 	/* ------------------------------------------------------------------------ */
-	/* make home_timeline file													*/
+	/* make settings file														*/
 	/* ------------------------------------------------------------------------ */
-	if( strncmp( screen_name,
-				 getTwapiScreenName( ),
-				 DEF_TWAPI_MAX_SCREEN_NAME_LEN ) == 0 )
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_ACCOUNT,
+					   DEF_TWFS_PATH_SETTINGS );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
-		result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-						   getRootDirPath( ), screen_name, DEF_TWFS_PATH_TL );
-	
-		if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+		if( daemon )
 		{
-			if( daemon )
-			{
-				logMessage( "Cannot create a file : %s\n", path_dir );
-			}
-			else
-			{
-				printf( "Cannot create a file : %s\n", path_dir );
-			}
-			return( result );
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
 		}
+		return( result );
 	}
 
+	return( result );
+}
+
+/*
+================================================================================
+	Function	:makeUserNotificationsDir
+	Input		:const char *screen_name
+				 < screen name >
+				 bool daemon
+				 < true:daemon mode >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/notifications directory
+================================================================================
+*/
+int makeUserNotificationsDir( const char *screen_name, bool daemon )
+{
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
+
 	/* ------------------------------------------------------------------------ */
-	/* make user_timeline file													*/
+	/* make notifications directory												*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name, DEF_TWFS_PATH_USER_TL );
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_NOTI );
 	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make @tweet file															*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_NOTI,
+					   DEF_TWFS_PATH_AT_TW );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make retweets_of_me file													*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_NOTI,
+					   DEF_TWFS_PATH_RTW );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -10902,54 +10366,31 @@ int makeUserScreenNameDir( const char *screen_name, bool daemon )
 
 	return( result );
 }
+
 /*
 ================================================================================
-	Function	:makeUserDirectMessageDir
+	Function	:makeUserBlocksDir
 	Input		:const char *screen_name
 				 < screen name >
-				 const char *frineds_name
-				 < screen name of friends >
 				 bool daemon
 				 < true:daemon mode >
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:make [screen_name]/direct_message/[friends_name] directory
+	Description	:make [screen_name]/blocks directory
 ================================================================================
 */
-static int makeUserDirectMessageDir( const char *screen_name,
-									 const char *friends_name,
-									 bool daemon )
+int makeUserBlocksDir( const char *screen_name, bool daemon )
 {
-	int			name_len;
-	int			result;
-	char		path_dir[ DEF_TWFS_PATH_MAX ];
-
-	/* ------------------------------------------------------------------------ */
-	/* make direct_massage directory											*/
-	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-						 getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_DM );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
-	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
-		return( result );
-	}
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
 
 	/* ------------------------------------------------------------------------ */
-	/* make direct_massage/[friends_name] directory								*/
+	/* make blocks directory													*/
 	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-						 getRootDirPath( ),screen_name,
-						 DEF_TWFS_PATH_DIR_DM, friends_name );
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_BLOCKS );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
@@ -10965,13 +10406,12 @@ static int makeUserDirectMessageDir( const char *screen_name,
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make direct_massage/[friends_name]/message file							*/
+	/* make list file															*/
 	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-						 getRootDirPath( ),screen_name,
-						 DEF_TWFS_PATH_DIR_DM, friends_name,
-						 DEF_TWFS_PATH_DM_MSG );
-	
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_BLOCKS,
+					   DEF_TWFS_PATH_BLOCK_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -10986,13 +10426,12 @@ static int makeUserDirectMessageDir( const char *screen_name,
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make direct_massage/[friends_name]/send_to file							*/
+	/* make .list file															*/
 	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-						 getRootDirPath( ),screen_name,
-						 DEF_TWFS_PATH_DIR_DM, friends_name,
-						 DEF_TWFS_PATH_DM_SEND_TO );
-	
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_BLOCKS,
+					   DEF_TWFS_PATH_DOT_BLOCK_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11006,35 +10445,53 @@ static int makeUserDirectMessageDir( const char *screen_name,
 		return( result );
 	}
 
+	return( result );
+}
+/*
+================================================================================
+	Function	:makeUserFavoritesDir
+	Input		:const char *screen_name
+				 < screen name >
+				 bool daemon
+				 < true:daemon mode >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/favorites directory
+================================================================================
+*/
+int makeUserFavoritesDir( const char *screen_name, bool daemon )
+{
+	int		result;
+	char	path_dir[ DEF_TWFS_PATH_MAX ];
+
 	/* ------------------------------------------------------------------------ */
-	/* make direct_massage/message file											*/
+	/* make favorites directory													*/
 	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-						 getRootDirPath( ),screen_name,
-						 DEF_TWFS_PATH_DIR_DM,
-						 DEF_TWFS_PATH_DM_MSG );
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_FAV );
 	
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
 		if( daemon )
 		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
+			logMessage( "Cannot create a directory : %s\n", path_dir );
 		}
 		else
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			printf( "Cannot create a directory : %s\n", path_dir );
 		}
 		return( result );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make direct_massage/send_to file											*/
+	/* make list file															*/
 	/* ------------------------------------------------------------------------ */
-	name_len = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-						 getRootDirPath( ),screen_name,
-						 DEF_TWFS_PATH_DIR_DM,
-						 DEF_TWFS_PATH_DM_SEND_TO );
-	
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_FAV,
+					   DEF_TWFS_PATH_FAV_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11047,12 +10504,12 @@ static int makeUserDirectMessageDir( const char *screen_name,
 		}
 		return( result );
 	}
+
 	return( result );
 }
-
 /*
 ================================================================================
-	Function	:makeUserRetweetDir
+	Function	:makeUserFollowerDir
 	Input		:const char *screen_name
 				 < screen name >
 				 bool daemon
@@ -11060,20 +10517,20 @@ static int makeUserDirectMessageDir( const char *screen_name,
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:make [screen_name]/retweet directory
+	Description	:make [screen_name]/follwer directory
 ================================================================================
 */
-int makeUserRetweetDir( const char *screen_name, bool daemon )
+int makeUserFollowerDir( const char *screen_name, bool daemon )
 {
 	int		result;
 	char	path_dir[ DEF_TWFS_PATH_MAX ];
 
 	/* ------------------------------------------------------------------------ */
-	/* make profile directory													*/
+	/* make follower directory													*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_RETWEET );
+					   DEF_TWFS_PATH_DIR_FOLLOWERS );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
@@ -11088,12 +10545,52 @@ int makeUserRetweetDir( const char *screen_name, bool daemon )
 		return( result );
 	}
 
+	/* ------------------------------------------------------------------------ */
+	/* make follower list file													*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_FOLLOWERS,
+					   DEF_TWFS_PATH_FF_LIST );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make follower list file													*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_FOLLOWERS,
+					   DEF_TWFS_PATH_FF_DOT_LIST );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+
 	return( result );
 }
 
 /*
 ================================================================================
-	Function	:makeUserAccountDir
+	Function	:makeUserFriendsDir
 	Input		:const char *screen_name
 				 < screen name >
 				 bool daemon
@@ -11101,20 +10598,20 @@ int makeUserRetweetDir( const char *screen_name, bool daemon )
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:make [screen_name]/account directory
+	Description	:make [screen_name]/following directory
 ================================================================================
 */
-int makeUserAccountDir( const char *screen_name, bool daemon )
+int makeUserFriendsDir( const char *screen_name, bool daemon )
 {
 	int		result;
 	char	path_dir[ DEF_TWFS_PATH_MAX ];
 
 	/* ------------------------------------------------------------------------ */
-	/* make profile directory													*/
+	/* make following directory													*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_ACCOUNT );
+					   DEF_TWFS_PATH_DIR_FRIENDS );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
@@ -11130,12 +10627,12 @@ int makeUserAccountDir( const char *screen_name, bool daemon )
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make profile file														*/
+	/* make following list file													*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_ACCOUNT,
-					   DEF_TWFS_PATH_PROFILE );
+					   DEF_TWFS_PATH_DIR_FRIENDS,
+					   DEF_TWFS_PATH_FF_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11150,12 +10647,12 @@ int makeUserAccountDir( const char *screen_name, bool daemon )
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make settings file														*/
+	/* make following .list file												*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_ACCOUNT,
-					   DEF_TWFS_PATH_SETTINGS );
+					   DEF_TWFS_PATH_DIR_FRIENDS,
+					   DEF_TWFS_PATH_FF_DOT_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11174,7 +10671,7 @@ int makeUserAccountDir( const char *screen_name, bool daemon )
 
 /*
 ================================================================================
-	Function	:makeUserNotificationsDir
+	Function	:makeUserListsDir
 	Input		:const char *screen_name
 				 < screen name >
 				 bool daemon
@@ -11182,41 +10679,107 @@ int makeUserAccountDir( const char *screen_name, bool daemon )
 	Output		:void
 	Return		:int
 				 < status >
-	Description	:make [screen_name]/notifications directory
+	Description	:make [screen_name]/lists directory
 ================================================================================
 */
-int makeUserNotificationsDir( const char *screen_name, bool daemon )
+int makeUserListsDir( const char *screen_name, bool daemon )
 {
 	int		result;
 	char	path_dir[ DEF_TWFS_PATH_MAX ];
 
 	/* ------------------------------------------------------------------------ */
-	/* make notifications directory												*/
+	/* make lists directory														*/
 	/* ------------------------------------------------------------------------ */
 	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_NOTI );
+					   DEF_TWFS_PATH_DIR_LISTS );
+	
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make [screen_name]/lists/list file										*/
+	/* ------------------------------------------------------------------------ */
+#if 0
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_LIST );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+#endif
+	
+	/* ------------------------------------------------------------------------ */
+	/* make [screen_name]/lists/subscriptions/ directory						*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_SUB );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
 		if( daemon )
 		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
+			logMessage( "Cannot create a directory : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a directory : %s\n", path_dir );
+		}
+		return( result );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* make [screen_name]/lists/subscriptions/list file							*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_SUB,
+					   DEF_TWFS_PATH_SUB_LIST );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
 		}
 		else
 		{
-			printf( "Cannot create a directory : %s\n", path_dir );
+			printf( "Cannot create a file : %s\n", path_dir );
 		}
 		return( result );
 	}
 
+#if 0
 	/* ------------------------------------------------------------------------ */
-	/* make @tweet file															*/
+	/* make [screen_name]/lists/subscriptions/subscribers file					*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_NOTI,
-					   DEF_TWFS_PATH_AT_TW );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_SUB,
+					   DEF_TWFS_PATH_SUB_SUBSCRIBERS );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11231,12 +10794,13 @@ int makeUserNotificationsDir( const char *screen_name, bool daemon )
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make retweets_of_me file													*/
+	/* make [screen_name]/lists/subscriptions/members file						*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_NOTI,
-					   DEF_TWFS_PATH_RTW );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_SUB,
+					   DEF_TWFS_PATH_SUB_MEMBERSHIPS );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11249,34 +10813,15 @@ int makeUserNotificationsDir( const char *screen_name, bool daemon )
 		}
 		return( result );
 	}
-
-	return( result );
-}
-
-/*
-================================================================================
-	Function	:makeUserBlocksDir
-	Input		:const char *screen_name
-				 < screen name >
-				 bool daemon
-				 < true:daemon mode >
-	Output		:void
-	Return		:int
-				 < status >
-	Description	:make [screen_name]/blocks directory
-================================================================================
-*/
-int makeUserBlocksDir( const char *screen_name, bool daemon )
-{
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+#endif
 
 	/* ------------------------------------------------------------------------ */
-	/* make blocks directory													*/
+	/* make [screen_name]/lists/my_list/ directory								*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_BLOCKS );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
@@ -11292,12 +10837,13 @@ int makeUserBlocksDir( const char *screen_name, bool daemon )
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make list file															*/
+	/* make [screen_name]/lists/my_list/list file								*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_BLOCKS,
-					   DEF_TWFS_PATH_BLOCK_LIST );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   DEF_TWFS_PATH_OWN_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11311,13 +10857,15 @@ int makeUserBlocksDir( const char *screen_name, bool daemon )
 		return( result );
 	}
 
+#if 0
 	/* ------------------------------------------------------------------------ */
-	/* make .list file															*/
+	/* make [screen_name]/lists/my_list/subscribers file						*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_BLOCKS,
-					   DEF_TWFS_PATH_DOT_BLOCK_LIST );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   DEF_TWFS_PATH_OWN_SUBSCRIBERS );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11331,32 +10879,35 @@ int makeUserBlocksDir( const char *screen_name, bool daemon )
 		return( result );
 	}
 
-	return( result );
-}
-/*
-================================================================================
-	Function	:makeUserFavoritesDir
-	Input		:const char *screen_name
-				 < screen name >
-				 bool daemon
-				 < true:daemon mode >
-	Output		:void
-	Return		:int
-				 < status >
-	Description	:make [screen_name]/favorites directory
-================================================================================
-*/
-int makeUserFavoritesDir( const char *screen_name, bool daemon )
-{
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+	/* ------------------------------------------------------------------------ */
+	/* make [screen_name]/lists/my_list/members file							*/
+	/* ------------------------------------------------------------------------ */
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
+					   getRootDirPath( ), screen_name,
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_OWN,
+					   DEF_TWFS_PATH_OWN_MEMBERSHIPS );
+	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	{
+		if( daemon )
+		{
+			logMessage( "Cannot create a file : %s\n", path_dir );
+		}
+		else
+		{
+			printf( "Cannot create a file : %s\n", path_dir );
+		}
+		return( result );
+	}
+#endif
 
 	/* ------------------------------------------------------------------------ */
-	/* make favorites directory													*/
+	/* make [screen_name]/lists/added/ directory								*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FAV );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_ADD );
 	
 	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
 	{
@@ -11372,12 +10923,13 @@ int makeUserFavoritesDir( const char *screen_name, bool daemon )
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make list file															*/
+	/* make [screen_name]/lists/added/list file									*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
+	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
 					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FAV,
-					   DEF_TWFS_PATH_FAV_LIST );
+					   DEF_TWFS_PATH_DIR_LISTS,
+					   DEF_TWFS_PATH_DIR_ADD,
+					   DEF_TWFS_PATH_ADD_LIST );
 	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
 	{
 		if( daemon )
@@ -11393,484 +10945,879 @@ int makeUserFavoritesDir( const char *screen_name, bool daemon )
 
 	return( result );
 }
+
+
+
 /*
 ================================================================================
-	Function	:makeUserFollowerDir
-	Input		:const char *screen_name
-				 < screen name >
-				 bool daemon
-				 < true:daemon mode >
+	Function	:getTwfsPageCount
+	Input		:struct twfs_file *twfs_file
+				 < twfs file information >
+				 int def_count
+				 < number of tweets if it is not set to the file >
 	Output		:void
 	Return		:int
-				 < status >
-	Description	:make [screen_name]/follwer directory
+				 < number of tweets to read at once >
+	Description	:get number of tweets to read at once set by
+				 DEF_TWFS_XATTR_PAGE_COUNT attribute of the timeline file
 ================================================================================
 */
-int makeUserFollowerDir( const char *screen_name, bool daemon )
+static int getTwfsPageCount( struct twfs_file *twfs_file, int def_count )
 {
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+	char	value[ DEF_REST_INT_MAX_LENGTH + 1 ];
+	ssize_t	len;
+	int		count;
 
-	/* ------------------------------------------------------------------------ */
-	/* make follower directory													*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FOLLOWERS );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	len = fgetxattr( twfs_file->fd, DEF_TWFS_XATTR_PAGE_COUNT,
+					 value, sizeof( value ) - 1 );
+
+	if( len <= 0 )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
-		return( result );
+		return( def_count );
+	}
+
+	value[ len ] = '\0';
+	count = atoi( value );
+
+	if( count <= 0 )
+	{
+		return( def_count );
 	}
 
+	if( DEF_TWOPE_MAX_TWEET_PAGE_COUNT < count )
+	{
+		return( DEF_TWOPE_MAX_TWEET_PAGE_COUNT );
+	}
+
+	return( count );
+}
+
+/*
+================================================================================
+	Function	:runTwfsBackfill
+	Input		:void *arg
+				 < struct twfs_backfill >
+	Output		:void
+	Return		:void*
+				 < NULL >
+	Description	:get a page of tweets older than the oldest record of a
+				 timeline file and save it before the record
+================================================================================
+*/
+static void* runTwfsBackfill( void *arg )
+{
+	struct twfs_backfill	*backfill;
+	struct twfs_file		*twfs_file;
+	struct stat				statbuf;
+	unsigned long long		oldest;
+	off_t					offset;
+	char					max_id[ DEF_TWFS_ID_FIELD + 1 ];
+	int						result;
+
+	backfill	= ( struct twfs_backfill* )arg;
+	twfs_file	= backfill->twfs_file;
+	oldest		= 0;
+	result		= -1;
+
+	/* opens by users are not kept waiting for rate limit by history			*/
+	setTwitterOperationBackground( true );
+
 	/* ------------------------------------------------------------------------ */
-	/* make follower list file													*/
+	/* writers of timeline files hold the session								*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FOLLOWERS,
-					   DEF_TWFS_PATH_FF_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	lockSSLSession( getCurrentSSLSession( ) );
+
+	if( ( fstat( twfs_file->fd, &statbuf ) == 0 ) &&
+		( growTwfsMap( twfs_file, statbuf.st_size ) == 0 ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
+		twfs_file->size = statbuf.st_size;
+	}
+
+	if( 0 <= getTotalSizeOfTlFile( twfs_file ) )
+	{
+		/* the first record with an id is the oldest						*/
+		for( offset = DEF_TWFS_OFFSET_BODY_OF_TL ;
+			 ( offset + DEF_TWFS_TL_RECORD_LEN ) <= twfs_file->size ;
+			 offset += DEF_TWFS_TL_RECORD_LEN )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			if( ( ( unsigned int )( *( twfs_file->tl + offset ) ) - '0' ) < 10u )
+			{
+				oldest = strtoull( twfs_file->tl + offset, NULL, 10 );
+				break;
+			}
 		}
-		return( result );
 	}
 
+	if( 1 < oldest )
+	{
+		snprintf( max_id, sizeof( max_id ), "%llu", oldest - 1 );
+
+		result = readTweetPage( backfill->request,
+								getCurrentSSLSession( ),
+								twfs_file,
+								backfill->screen_name,
+								NULL,
+								max_id,
+								backfill->slug,
+								DEF_TWOPE_MAX_TWEET_PAGE_COUNT,
+								0, true );
+	}
+
+	unlockSSLSession( getCurrentSSLSession( ) );
+
 	/* ------------------------------------------------------------------------ */
-	/* make follower list file													*/
+	/* nothing older is got again until the file is opened again				*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FOLLOWERS,
-					   DEF_TWFS_PATH_FF_DOT_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	pthread_mutex_lock( &twfs_map_lock );
+	twfs_file->map->backfill = false;
+	if( result < 0 )
 	{
-		if( daemon )
+		twfs_file->map->oldest = true;
+	}
+	pthread_mutex_unlock( &twfs_map_lock );
+
+	closeTwfsFile( &backfill->twfs_file );
+	free( backfill );
+
+	return( NULL );
+}
+
+/*
+================================================================================
+	Function	:startTwfsListGeneration
+	Input		:struct twfs_list_gen *gen
+				 < list to build next generation. freed by this >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:build next generation of a list file in background, unless
+				 it is already being built
+================================================================================
+*/
+static int startTwfsListGeneration( struct twfs_list_gen *gen )
+{
+	struct twfs_list_gen	*running;
+	struct twfs_list_gen	**link;
+	pthread_attr_t			attr;
+	pthread_t				thread;
+	int						result;
+
+	pthread_mutex_lock( &twfs_list_gen_lock );
+
+	for( running = twfs_list_gens ; running ; running = running->next )
+	{
+		if( strcmp( running->list_path, gen->list_path ) == 0 )
 		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
+			break;
 		}
-		else
+	}
+
+	if( running )
+	{
+		pthread_mutex_unlock( &twfs_list_gen_lock );
+		free( gen );
+		return( 0 );
+	}
+
+	gen->next		= twfs_list_gens;
+	twfs_list_gens	= gen;
+
+	pthread_mutex_unlock( &twfs_list_gen_lock );
+
+	pthread_attr_init( &attr );
+	pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+
+	result = pthread_create( &thread, &attr, runTwfsListGeneration, gen );
+
+	pthread_attr_destroy( &attr );
+
+	if( result != 0 )
+	{
+		logMessage( "cannot start generation of %s\n", gen->list_path );
+
+		pthread_mutex_lock( &twfs_list_gen_lock );
+
+		for( link = &twfs_list_gens ; *link ; link = &( *link )->next )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			if( *link == gen )
+			{
+				*link = gen->next;
+				break;
+			}
 		}
-		return( result );
+
+		pthread_mutex_unlock( &twfs_list_gen_lock );
+
+		free( gen );
+
+		return( -1 );
 	}
 
-	return( result );
+	return( 0 );
 }
 
 /*
 ================================================================================
-	Function	:makeUserFriendsDir
-	Input		:const char *screen_name
-				 < screen name >
-				 bool daemon
-				 < true:daemon mode >
+	Function	:runTwfsListGeneration
+	Input		:void *arg
+				 < struct twfs_list_gen >
 	Output		:void
-	Return		:int
-				 < status >
-	Description	:make [screen_name]/following directory
+	Return		:void*
+				 < NULL >
+	Description	:build next generation of a list file and forget it
 ================================================================================
 */
-int makeUserFriendsDir( const char *screen_name, bool daemon )
+static void* runTwfsListGeneration( void *arg )
 {
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+	struct twfs_list_gen	*gen;
+	struct twfs_list_gen	**link;
 
-	/* ------------------------------------------------------------------------ */
-	/* make following directory													*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FRIENDS );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
-	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
-		return( result );
-	}
+	gen = ( struct twfs_list_gen* )arg;
 
-	/* ------------------------------------------------------------------------ */
-	/* make following list file													*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FRIENDS,
-					   DEF_TWFS_PATH_FF_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
-	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
-	}
+	/* opens by users are not kept waiting for rate limit by lists				*/
+	setTwitterOperationBackground( true );
 
-	/* ------------------------------------------------------------------------ */
-	/* make following .list file												*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_FRIENDS,
-					   DEF_TWFS_PATH_FF_DOT_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	buildTwfsListGeneration( gen );
+
+	pthread_mutex_lock( &twfs_list_gen_lock );
+
+	for( link = &twfs_list_gens ; *link ; link = &( *link )->next )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
+		if( *link == gen )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			*link = gen->next;
+			break;
 		}
-		return( result );
 	}
 
-	return( result );
+	pthread_mutex_unlock( &twfs_list_gen_lock );
+
+	free( gen );
+
+	return( NULL );
 }
 
 /*
 ================================================================================
-	Function	:makeUserListsDir
-	Input		:const char *screen_name
-				 < screen name >
-				 bool daemon
-				 < true:daemon mode >
+	Function	:buildTwfsListGeneration
+	Input		:struct twfs_list_gen *gen
+				 < list to build next generation >
 	Output		:void
 	Return		:int
-				 < status >
-	Description	:make [screen_name]/lists directory
+				 < 1:published 0:not completed yet -1:error >
+	Description	:get pages of a list through its cursor chain into .list, and
+				 publish it by renaming it to list when the chain ends. pages
+				 got so far are kept, next build resumes from its cursor
 ================================================================================
 */
-int makeUserListsDir( const char *screen_name, bool daemon )
+static int buildTwfsListGeneration( struct twfs_list_gen *gen )
 {
-	int		result;
-	char	path_dir[ DEF_TWFS_PATH_MAX ];
+	struct twfs_file	*twfs_file;
+	char				cursor[ DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD + 1 ];
+	char				next[ DEF_TWFS_HEAD_FF_NEXT_CUR_FIELD + 1 ];
+	char				value[ DEF_TWFS_LIST_GEN_FIELD + 1 ];
+	unsigned long		generation;
+	ssize_t				length;
+	size_t				size;
+	bool				complete;
+	int					result;
+	int					page;
 
-	/* ------------------------------------------------------------------------ */
-	/* make lists directory														*/
-	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	if( !( twfs_file = ( struct twfs_file* )allocTwfsFile( ) ) )
 	{
-		if( daemon )
+		return( -1 );
+	}
+
+	/* twfs file is freed on failure											*/
+	if( openTwfsFile( twfs_file, gen->work_path, gen->file_type ) < 0 )
+	{
+		return( -1 );
+	}
+
+	complete = false;
+
+	for( page = 0 ; page < DEF_TWFS_LIST_GEN_PAGES ; page++ )
+	{
+		/* -------------------------------------------------------------------- */
+		/* writers of list files hold the session								*/
+		/* -------------------------------------------------------------------- */
+		lockSSLSession( getCurrentSSLSession( ) );
+
+		getTotalSizeOfTlFile( twfs_file );
+
+		memset( cursor, 0x00, sizeof( cursor ) );
+		size = twfs_file->size;
+
+		if( ( getNextCursorOfListFile( twfs_file, cursor ) <= 0 ) ||
+			( cursor[ 0 ] == '\0' ) )
 		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
+			/* a generation starts from the first page							*/
+			result = readTwfsListPage( gen, twfs_file, NULL );
+		}
+		else if( ( cursor[ 0 ] == '0' ) && ( cursor[ 1 ] == '\0' ) )
+		{
+			/* end of the cursor chain											*/
+			complete	= true;
+			result		= 0;
 		}
 		else
 		{
-			printf( "Cannot create a directory : %s\n", path_dir );
+			result = readTwfsListPage( gen, twfs_file, cursor );
 		}
-		return( result );
-	}
 
-	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/list file										*/
-	/* ------------------------------------------------------------------------ */
-#if 0
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
-	{
-		if( daemon )
+		unlockSSLSession( getCurrentSSLSession( ) );
+
+		/* rate limit, next build resumes from the cursor						*/
+		if( complete || ( result < 0 ) )
 		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
+			break;
 		}
-		else
+
+		/* -------------------------------------------------------------------- */
+		/* a page without users may still end the chain, stop only when the	*/
+		/* cursor does not move either											*/
+		/* -------------------------------------------------------------------- */
+		if( size == twfs_file->size )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			memset( next, 0x00, sizeof( next ) );
+			getNextCursorOfListFile( twfs_file, next );
+
+			if( strcmp( next, cursor ) == 0 )
+			{
+				break;
+			}
 		}
-		return( result );
 	}
-#endif
-	
+
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/subscriptions/ directory						*/
+	/* number the generation after the published one							*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_SUB );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	if( complete )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
-		return( result );
+		length = getxattr( gen->list_path, DEF_TWFS_XATTR_LIST_GEN,
+						   value, sizeof( value ) - 1 );
+		value[ ( 0 < length ) ? length : 0 ] = '\0';
+		generation = strtoul( value, NULL, 10 ) + 1;
+
+		snprintf( value, sizeof( value ), "%lu", generation );
+		fsetxattr( twfs_file->fd, DEF_TWFS_XATTR_LIST_GEN,
+				   value, strlen( value ), 0 );
+	}
+
+	closeTwfsFile( &twfs_file );
+
+	if( !complete )
+	{
+		return( 0 );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/subscriptions/list file							*/
+	/* publish at once. readers of old generation keep reading it				*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_SUB,
-					   DEF_TWFS_PATH_SUB_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( rename( gen->work_path, gen->list_path ) < 0 )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		logMessage( "cannot publish %s\n", gen->list_path );
+		return( -1 );
 	}
 
-#if 0
+	logMessage( "publish %s generation %lu\n", gen->list_path, generation );
+
+	return( 1 );
+}
+
+/*
+================================================================================
+	Function	:readTwfsListPage
+	Input		:struct twfs_list_gen *gen
+				 < list to build next generation >
+				 struct twfs_file *twfs_file
+				 < twfs file information of .list >
+				 const char *cursor
+				 < cursor in the list. NULL:first page >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:get a page of a list and append it to .list
+================================================================================
+*/
+static int readTwfsListPage( struct twfs_list_gen *gen,
+							 struct twfs_file *twfs_file,
+							 const char *cursor )
+{
+	switch( gen->file_type )
+	{
+	case	E_TWFS_FILE_FL_LIST:
+	case	E_TWFS_FILE_FL_DOT_LIST:
+		return( readUsers( E_TWFS_REQ_READ_FOLLOWER_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor,
+						   NULL ) );
+	case	E_TWFS_FILE_FR_LIST:
+	case	E_TWFS_FILE_FR_DOT_LIST:
+		return( readUsers( E_TWFS_REQ_READ_FOLLOWING_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor,
+						   NULL ) );
+	case	E_TWFS_FILE_AUTH_BLOCKS_LIST:
+	case	E_TWFS_FILE_AUTH_DOT_BLOCKS_LIST:
+		return( readUsers( E_TWFS_REQ_READ_AUTH_BLOCK_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor,
+						   NULL ) );
+	case	E_TWFS_FILE_LISTS_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_SUB_DOT_LIST:
+		return( readLists( E_TWFS_REQ_READ_LISTS_SUB_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor ) );
+	case	E_TWFS_FILE_LISTS_OWN_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_DOT_LIST:
+		return( readLists( E_TWFS_REQ_READ_LISTS_OWN_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor ) );
+	case	E_TWFS_FILE_LISTS_ADD_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_DOT_LIST:
+		return( readLists( E_TWFS_REQ_READ_LISTS_ADD_LIST,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor ) );
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_LIST:
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_MEM_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_MEM_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_LNAME_MEM_DOT_LIST:
+		return( readUsers( E_TWFS_REQ_READ_LISTS_MEMBERS,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor,
+						   gen->slug ) );
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_SUB_LNAME_SUB_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_OWN_LNAME_SUB_DOT_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_LIST:
+	case	E_TWFS_FILE_LISTS_ADD_LNAME_SUB_DOT_LIST:
+		return( readUsers( E_TWFS_REQ_READ_LISTS_SUBSCRIBERS,
+						   getCurrentSSLSession( ),
+						   twfs_file,
+						   gen->screen_name,
+						   cursor,
+						   gen->slug ) );
+	default:
+		return( -1 );
+	}
+}
+
+/*
+================================================================================
+	Function	:registerTwfsUser
+	Input		:const char *user_id
+				 < user id of a user in a response, NULL:unknown >
+				 const char *screen_name
+				 < screen name of the user >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make [screen_name]/status for a user not seen yet. the rest
+				 of user home is made by makeUserHomeOnAccess
+================================================================================
+*/
+static int registerTwfsUser( const char *user_id, const char *screen_name )
+{
+	struct twfs_user	*user;
+	int					result;
+	char				path_dir[ DEF_TWFS_PATH_MAX ];
+	char				old_sname[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/subscriptions/subscribers file					*/
+	/* home of a renamed user moves to new screen name							*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_SUB,
-					   DEF_TWFS_PATH_SUB_SUBSCRIBERS );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( user_id &&
+		( 0 <= internTwfsUser( user_id, screen_name, old_sname ) ) &&
+		( old_sname[ 0 ] != '\0' ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		moveUserHomeDirectory( old_sname, screen_name );
+	}
+
+	pthread_mutex_lock( &twfs_user_lock );
+	user = findTwfsUser( screen_name );
+	pthread_mutex_unlock( &twfs_user_lock );
+
+	if( user )
+	{
+		return( 0 );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/subscriptions/members file						*/
+	/* name left as a link by a renamed user may be taken by another user		*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_SUB,
-					   DEF_TWFS_PATH_SUB_MEMBERSHIPS );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( user_id )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		reclaimUserHomeDirectory( user_id, screen_name );
 	}
-#endif
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/my_list/ directory								*/
+	/* make [screen_name]/status directory										*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	snprintf( path_dir, sizeof( path_dir ), "%s/%s",
+			  getRootDirPath( ), screen_name );
+
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
+		logMessage( "Cannot create a directory : %s\n", path_dir );
+		return( result );
+	}
+
+	snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s",
+			  getRootDirPath( ), screen_name, DEF_TWFS_PATH_DIR_STATUS );
+
+	if( ( result = makeDirectory( ( const char* )path_dir, 0770, true ) ) < 0 )
+	{
+		logMessage( "Cannot create a directory : %s\n", path_dir );
 		return( result );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/my_list/list file								*/
+	/* a user failed to be registered is made again when it is seen next		*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   DEF_TWFS_PATH_OWN_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	pthread_mutex_lock( &twfs_user_lock );
+
+	if( !findTwfsUser( screen_name ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		addTwfsUser( screen_name );
+	}
+
+	pthread_mutex_unlock( &twfs_user_lock );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:moveUserHomeDirectory
+	Input		:const char *old_sname
+				 < previous screen name of a user >
+				 const char *new_sname
+				 < current screen name of the user >
+	Output		:void
+	Return		:void
+	Description	:move home of a renamed user to its new screen name. old name
+				 is left as a link to new one, so that records of timelines
+				 which have old name still find status files until another
+				 user takes the name
+================================================================================
+*/
+static void moveUserHomeDirectory( const char *old_sname, const char *new_sname )
+{
+	struct stat	statbuf;
+	char		old_path[ DEF_TWFS_PATH_MAX ];
+	char		new_path[ DEF_TWFS_PATH_MAX ];
+
+	snprintf( old_path, sizeof( old_path ), "%s/%s",
+			  getRootDirPath( ), old_sname );
+	snprintf( new_path, sizeof( new_path ), "%s/%s",
+			  getRootDirPath( ), new_sname );
+
+	if( ( lstat( old_path, &statbuf ) < 0 ) || !S_ISDIR( statbuf.st_mode ) )
+	{
+		return;
 	}
 
-#if 0
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/my_list/subscribers file						*/
+	/* user renamed back to a name it has left as a link						*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   DEF_TWFS_PATH_OWN_SUBSCRIBERS );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( ( lstat( new_path, &statbuf ) == 0 ) && S_ISLNK( statbuf.st_mode ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		unlink( new_path );
 	}
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/my_list/members file							*/
+	/* home which is made for new name already is left as it is					*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_OWN,
-					   DEF_TWFS_PATH_OWN_MEMBERSHIPS );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( isDirectory( new_path ) == 0 )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a file : %s\n", path_dir );
-		}
-		return( result );
+		return;
+	}
+
+	if( rename( old_path, new_path ) < 0 )
+	{
+		logMessage( "cannot move home of %s to %s:%s\n",
+					old_sname, new_sname, strerror( errno ) );
+		return;
+	}
+
+	if( symlink( new_sname, old_path ) < 0 )
+	{
+		logMessage( "cannot link %s to %s:%s\n",
+					old_sname, new_sname, strerror( errno ) );
 	}
-#endif
 
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/added/ directory								*/
+	/* old name is checked by reclaimUserHomeDirectory when it is seen next		*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_ADD );
-	
-	if( ( result = makeDirectory( ( const char* )path_dir, 0770, daemon ) ) < 0 )
+	pthread_mutex_lock( &twfs_user_lock );
+	removeTwfsUser( old_sname );
+	pthread_mutex_unlock( &twfs_user_lock );
+}
+
+/*
+================================================================================
+	Function	:reclaimUserHomeDirectory
+	Input		:const char *user_id
+				 < user id of a user in a response >
+				 const char *screen_name
+				 < screen name of the user >
+	Output		:void
+	Return		:void
+	Description	:remove a link left at screen name by moveUserHomeDirectory
+				 when the name is taken by another user, so that writes for
+				 the user do not go into home of the renamed user
+================================================================================
+*/
+static void reclaimUserHomeDirectory( const char *user_id,
+									  const char *screen_name )
+{
+	struct stat	statbuf;
+	char		path[ DEF_TWFS_PATH_MAX ];
+	char		target[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	char		owner_id[ DEF_TWFS_ID_FIELD + 1 ];
+	ssize_t		len;
+
+	snprintf( path, sizeof( path ), "%s/%s", getRootDirPath( ), screen_name );
+
+	if( ( lstat( path, &statbuf ) < 0 ) || !S_ISLNK( statbuf.st_mode ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a directory : %s\n", path_dir );
-		}
-		else
-		{
-			printf( "Cannot create a directory : %s\n", path_dir );
-		}
-		return( result );
+		return;
+	}
+
+	if( ( len = readlink( path, target, sizeof( target ) - 1 ) ) < 0 )
+	{
+		return;
 	}
 
+	target[ len ] = '\0';
+
 	/* ------------------------------------------------------------------------ */
-	/* make [screen_name]/lists/added/list file									*/
+	/* link to home of the user itself is kept									*/
 	/* ------------------------------------------------------------------------ */
-	result = snprintf( path_dir, sizeof( path_dir ), "%s/%s/%s/%s/%s",
-					   getRootDirPath( ), screen_name,
-					   DEF_TWFS_PATH_DIR_LISTS,
-					   DEF_TWFS_PATH_DIR_ADD,
-					   DEF_TWFS_PATH_ADD_LIST );
-	if( ( result = createNewFile( ( const char* )path_dir, 0660, daemon ) ) < 0 )
+	if( ( getTwfsUserId( target, owner_id ) == 0 ) &&
+		( strcmp( owner_id, user_id ) == 0 ) )
 	{
-		if( daemon )
-		{
-			logMessage( "Cannot create a file : %s\n", path_dir );
-		}
-		else
+		return;
+	}
+
+	if( unlink( path ) < 0 )
+	{
+		logMessage( "cannot unlink %s:%s\n", path, strerror( errno ) );
+		return;
+	}
+
+	logMessage( "%s is taken by another user, unlink it from %s\n",
+				screen_name, target );
+}
+
+/*
+================================================================================
+	Function	:findTwfsUser
+	Input		:const char *screen_name
+				 < screen name >
+	Output		:void
+	Return		:struct twfs_user*
+				 < registered user, NULL:not registered >
+	Description	:find a registered user. caller must hold twfs_user_lock
+================================================================================
+*/
+static struct twfs_user* findTwfsUser( const char *screen_name )
+{
+	struct twfs_user	*user;
+
+	for( user = twfs_users[ hashTwfsUser( screen_name ) ] ;
+		 user ;
+		 user = user->next )
+	{
+		if( strcmp( user->screen_name, screen_name ) == 0 )
 		{
-			printf( "Cannot create a file : %s\n", path_dir );
+			return( user );
 		}
-		return( result );
 	}
 
-	return( result );
+	return( NULL );
+}
+
+/*
+================================================================================
+	Function	:addTwfsUser
+	Input		:const char *screen_name
+				 < screen name >
+	Output		:void
+	Return		:struct twfs_user*
+				 < registered user, NULL:no memory >
+	Description	:register a user whose home is not made yet. caller must hold
+				 twfs_user_lock
+================================================================================
+*/
+static struct twfs_user* addTwfsUser( const char *screen_name )
+{
+	struct twfs_user	*user;
+	unsigned int		hash;
+
+	if( !( user = malloc( sizeof( struct twfs_user ) ) ) )
+	{
+		return( NULL );
+	}
+
+	snprintf( user->screen_name, sizeof( user->screen_name ),
+			  "%s", screen_name );
+	user->home			= false;
+
+	hash				= hashTwfsUser( screen_name );
+	user->next			= twfs_users[ hash ];
+	twfs_users[ hash ]	= user;
+
+	return( user );
 }
 
+/*
+================================================================================
+	Function	:removeTwfsUser
+	Input		:const char *screen_name
+				 < screen name >
+	Output		:void
+	Return		:void
+	Description	:unregister a user whose name is no longer its home. caller
+				 must hold twfs_user_lock
+================================================================================
+*/
+static void removeTwfsUser( const char *screen_name )
+{
+	struct twfs_user	**link;
+	struct twfs_user	*user;
 
+	for( link = &twfs_users[ hashTwfsUser( screen_name ) ] ;
+		 ( user = *link ) ;
+		 link = &user->next )
+	{
+		if( strcmp( user->screen_name, screen_name ) == 0 )
+		{
+			*link = user->next;
+			free( user );
+			return;
+		}
+	}
+}
 
 /*
 ================================================================================
-	Function	:mmapTwfsListFile
-	Input		:struct *twfs_file
-				 < twfs file information >
+	Function	:hashTwfsUser
+	Input		:const char *screen_name
+				 < screen name >
 	Output		:void
+	Return		:unsigned int
+				 < index of twfs_users >
+	Description	:hash screen name of a user
+================================================================================
+*/
+static unsigned int hashTwfsUser( const char *screen_name )
+{
+	uint32_t	hash;
+
+	/* ------------------------------------------------------------------------ */
+	/* fnv-1a of screen name													*/
+	/* ------------------------------------------------------------------------ */
+	hash = 2166136261u;
+
+	for( ; *screen_name ; screen_name++ )
+	{
+		hash ^= ( uint8_t )*screen_name;
+		hash *= 16777619u;
+	}
+
+	return( hash & ( DEF_TWFS_USER_HASH_SIZE - 1 ) );
+}
+
+/*
+================================================================================
+	Function	:getTwfsRecordScreenName
+	Input		:const char *field
+				 < screen name field of a record >
+				 char *sname
+				 < buffer of DEF_TWFS_SNAME_FIELD + 1 >
+	Output		:char *sname
+				 < screen name terminated by null >
 	Return		:int
-				 < status >
-	Description	:mmap list file
+				 < length of screen name, -1:field is not terminated >
+	Description	:copy screen name out of a record at once
 ================================================================================
 */
-int mmapTwfsListFile( struct twfs_file *twfs_file )
+static int getTwfsRecordScreenName( const char *field, char *sname )
 {
-	size_t	mmap_size;
+	const char	*end;
 
-	if( twfs_file->size < DEF_TWFS_HEAD_FF_LEN )
+	if( !( end = memchr( field, 0x00, DEF_TWFS_SNAME_FIELD + 1 ) ) )
 	{
-		mmap_size = DEF_TWFS_HEAD_TL_SIZE_FIELD_LEN
-					+ ( DEF_TWFS_TL_RECORD_LEN
-						* DEF_TWOPE_MAX_FF_COUNT );
+		return( -1 );
 	}
-	else
+
+	memcpy( sname, field, end - field + 1 );
+
+	return( end - field );
+}
+
+/*
+================================================================================
+	Function	:printTwfsStatus
+	Input		:struct twfs_status *status
+				 < body of a status file >
+				 const char *format
+				 < format of a part >
+				 ...
+				 < arguments of format >
+	Output		:struct twfs_status *status
+				 < the part is appended >
+	Return		:int
+				 < length of the part appended >
+	Description	:render a part of status file after parts rendered so far.
+				 a part is cut when the body is full
+================================================================================
+*/
+static int printTwfsStatus( struct twfs_status *status, const char *format, ... )
+{
+	va_list	ap;
+	int		rest;
+	int		len;
+
+	rest = sizeof( status->text ) - status->len;
+
+	va_start( ap, format );
+	len = vsnprintf( status->text + status->len, rest, format, ap );
+	va_end( ap );
+
+	if( len < 0 )
 	{
-		mmap_size = twfs_file->size
-					+ ( DEF_TWFS_TL_RECORD_LEN
-						* DEF_TWOPE_MAX_FF_COUNT );
+		return( 0 );
 	}
-	twfs_file->tl = ( char* )mmap( NULL, mmap_size,
-								   PROT_WRITE, MAP_SHARED,
-								   twfs_file->fd, 0 );
 
-	if( twfs_file->tl == MAP_FAILED )
+	/* ------------------------------------------------------------------------ */
+	/* without null of the cut part												*/
+	/* ------------------------------------------------------------------------ */
+	if( rest <= len )
 	{
-		logMessage( "mmap failed at twfsOpen\n" );
-		closeTwfsFile( &twfs_file );
-		return( -ENOMEM );
+		len = rest - 1;
 	}
 
-	return( 0 );
+	status->len += len;
+
+	return( len );
 }
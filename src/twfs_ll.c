@@ -0,0 +1,2428 @@
+/*******************************************************************************
+ File:twfs_ll.c
+ Description:Low-level frontend of twitter pesudo filesystem
+
+*******************************************************************************/
+#include <errno.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/types.h>
+
+#include <dirent.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+
+#include "twfs.h"
+#include "twfs_internal.h"
+#include "twfs_ll.h"
+#include "lib/log.h"
+#include "lib/utf.h"
+#include "net/twitter_api.h"
+
+/* fuse headers must be included here	*/
+#include <fuse.h>
+#include <fuse_lowlevel.h>
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+struct twfs_inode;
+
+static void initTwfsLowLevel( void *userdata, struct fuse_conn_info *conn );
+static void destroyTwfsLowLevel( void *userdata );
+static void twfsLlLookup( fuse_req_t req, fuse_ino_t parent, const char *name );
+static void twfsLlForget( fuse_req_t req, fuse_ino_t ino, unsigned long nlookup );
+static void
+twfsLlGetAttributes( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi );
+static void twfsLlSetAttributes( fuse_req_t req,
+								 fuse_ino_t ino,
+								 struct stat *attr,
+								 int to_set,
+								 struct fuse_file_info *fi );
+static void twfsLlReadLink( fuse_req_t req, fuse_ino_t ino );
+static void twfsLlMakeNode( fuse_req_t req,
+							fuse_ino_t parent,
+							const char *name,
+							mode_t mode,
+							dev_t rdev );
+static void twfsLlMakeDirectory( fuse_req_t req,
+								 fuse_ino_t parent,
+								 const char *name,
+								 mode_t mode );
+static void twfsLlUnlink( fuse_req_t req, fuse_ino_t parent, const char *name );
+static void
+twfsLlRemoveDirectory( fuse_req_t req, fuse_ino_t parent, const char *name );
+static void twfsLlSymbolicLink( fuse_req_t req,
+								const char *link,
+								fuse_ino_t parent,
+								const char *name );
+static void twfsLlRename( fuse_req_t req,
+						  fuse_ino_t parent,
+						  const char *name,
+						  fuse_ino_t newparent,
+						  const char *newname );
+static void twfsLlHardLink( fuse_req_t req,
+							fuse_ino_t ino,
+							fuse_ino_t newparent,
+							const char *newname );
+static void
+twfsLlOpen( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi );
+static void twfsLlRead( fuse_req_t req,
+						fuse_ino_t ino,
+						size_t size,
+						off_t offset,
+						struct fuse_file_info *fi );
+static void twfsLlWrite( fuse_req_t req,
+						 fuse_ino_t ino,
+						 const char *buf,
+						 size_t size,
+						 off_t offset,
+						 struct fuse_file_info *fi );
+static void
+twfsLlFlush( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi );
+static void
+twfsLlRelease( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi );
+static void twfsLlFileSync( fuse_req_t req,
+							fuse_ino_t ino,
+							int datasync,
+							struct fuse_file_info *fi );
+static void
+twfsLlOpenDirectory( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi );
+static void twfsLlReadDirectory( fuse_req_t req,
+								 fuse_ino_t ino,
+								 size_t size,
+								 off_t offset,
+								 struct fuse_file_info *fi );
+static void twfsLlReleaseDirectory( fuse_req_t req,
+									fuse_ino_t ino,
+									struct fuse_file_info *fi );
+static void twfsLlFileSyncDirectory( fuse_req_t req,
+									 fuse_ino_t ino,
+									 int datasync,
+									 struct fuse_file_info *fi );
+static void twfsLlStatisticsFileSystem( fuse_req_t req, fuse_ino_t ino );
+static void twfsLlSetExtendedAttributes( fuse_req_t req,
+										 fuse_ino_t ino,
+										 const char *name,
+										 const char *value,
+										 size_t size,
+										 int flags );
+static void twfsLlGetExtendedAttributes( fuse_req_t req,
+										 fuse_ino_t ino,
+										 const char *name,
+										 size_t size );
+static void
+twfsLlListExtendedAttributes( fuse_req_t req, fuse_ino_t ino, size_t size );
+static void twfsLlRemoveExtendedAttributes( fuse_req_t req,
+											fuse_ino_t ino,
+											const char *name );
+static void twfsLlAccess( fuse_req_t req, fuse_ino_t ino, int mask );
+static void twfsLlCreate( fuse_req_t req,
+						  fuse_ino_t parent,
+						  const char *name,
+						  mode_t mode,
+						  struct fuse_file_info *fi );
+
+static int getTwfsInodePath( fuse_ino_t ino, char *path );
+static int getTwfsChildPath( fuse_ino_t parent, const char *name, char *path );
+static int makeTwfsInodePath( const struct twfs_inode *inode, char *path );
+static int getTwfsInodeAttributes( fuse_ino_t ino, struct stat *statbuf );
+static int replyTwfsEntry( fuse_req_t req,
+						   fuse_ino_t parent,
+						   const char *name,
+						   struct fuse_entry_param *entry );
+static struct twfs_inode* findTwfsInode( fuse_ino_t ino );
+static fuse_ino_t getTwfsEntryInode( fuse_ino_t ino, const char *name );
+static struct twfs_inode*
+findTwfsChildInode( const struct twfs_inode *parent, const char *name );
+static struct twfs_inode*
+allocTwfsInode( struct twfs_inode *parent, const char *name );
+static void hashTwfsInode( struct twfs_inode *inode );
+static void unhashTwfsInode( struct twfs_inode *inode );
+static void putTwfsInode( struct twfs_inode *inode );
+static void classifyTwfsInode( struct twfs_inode *inode, const char *path );
+static unsigned int hashTwfsName( const struct twfs_inode *parent,
+								  const char *name );
+static void replyTwfsStatus( fuse_req_t req, int result );
+static int runTwfsLlWorkers( struct fuse_session *se, int workers );
+static void* runTwfsLlWorker( void *arg );
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+#define	DEF_TWFS_INODE_HASH_SIZE		4096	// must be power of 2
+
+/* entry of a directory which the kernel has not looked up has no number yet.	*/
+/* same value as fuse high-level api reports without use_ino					*/
+#define	DEF_TWFS_UNKNOWN_INO			0xffffffff
+
+/* node of the twfs hierarchy which the kernel knows by its inode number		*/
+struct twfs_inode
+{
+	struct twfs_inode	*ino_next;		// chain of inode number hash
+	struct twfs_inode	*name_next;		// chain of parent and name hash
+	struct twfs_inode	*parent;		// NULL:root
+	char				*name;
+	fuse_ino_t			ino;
+	unsigned long		nlookup;		// lookup count of the kernel
+	unsigned long		nchild;			// children refering to this node
+	int					hashed;			// 0:unlinked or renamed over
+	unsigned long		generation;		// classified at this generation
+	E_TWFS_FILE_TYPE	file_type;
+	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+};
+
+/* threads serving requests of the kernel on a session						*/
+struct twfs_ll_workers
+{
+	struct fuse_session	*se;
+	sem_t				finished;	// posted when a worker stops
+};
+
+/* directory stream opened by twfsLlOpenDirectory								*/
+struct twfs_ll_dir
+{
+	DIR				*dp;
+	struct dirent	*entry;		// read but not replied yet
+	off_t			offset;		// offset of next entry to reply
+};
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+static struct twfs_inode	twfs_root_inode;
+static struct twfs_inode	*twfs_ino_hash[ DEF_TWFS_INODE_HASH_SIZE ];
+static struct twfs_inode	*twfs_name_hash[ DEF_TWFS_INODE_HASH_SIZE ];
+static fuse_ino_t			twfs_next_ino = FUSE_ROOT_ID + 1;
+static unsigned long		twfs_generation;	// bumped when a node moves
+static pthread_mutex_t		twfs_inode_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const struct fuse_lowlevel_ops twfs_ll_operations =
+{
+	.init			= initTwfsLowLevel,
+	.destroy		= destroyTwfsLowLevel,
+	.lookup			= twfsLlLookup,
+	.forget			= twfsLlForget,
+	.getattr		= twfsLlGetAttributes,
+	.setattr		= twfsLlSetAttributes,
+	.readlink		= twfsLlReadLink,
+	.mknod			= twfsLlMakeNode,
+	.mkdir			= twfsLlMakeDirectory,
+	.unlink			= twfsLlUnlink,
+	.rmdir			= twfsLlRemoveDirectory,
+	.symlink		= twfsLlSymbolicLink,
+	.rename			= twfsLlRename,
+	.link			= twfsLlHardLink,
+	.open			= twfsLlOpen,
+	.read			= twfsLlRead,
+	.write			= twfsLlWrite,
+	.flush			= twfsLlFlush,
+	.release		= twfsLlRelease,
+	.fsync			= twfsLlFileSync,
+	.opendir		= twfsLlOpenDirectory,
+	.readdir		= twfsLlReadDirectory,
+	.releasedir		= twfsLlReleaseDirectory,
+	.fsyncdir		= twfsLlFileSyncDirectory,
+	.statfs			= twfsLlStatisticsFileSystem,
+	.setxattr		= twfsLlSetExtendedAttributes,
+	.getxattr		= twfsLlGetExtendedAttributes,
+	.listxattr		= twfsLlListExtendedAttributes,
+	.removexattr	= twfsLlRemoveExtendedAttributes,
+	.access			= twfsLlAccess,
+	.create			= twfsLlCreate,
+};
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:startTwfsLowLevel
+	Input		:int argc
+				 < number of arguments >
+				 char *argv[ ]
+				 < arguments >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:start twfs with fuse low-level api
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int startTwfsLowLevel( int argc, char *argv[ ] )
+{
+	int						result = -1;
+	char					*mountpoint;
+	int						multithreaded;
+	int						workers;
+	int						foreground;
+	struct fuse_chan		*ch;
+	struct fuse_session		*se;
+	struct fuse_args		args = FUSE_ARGS_INIT( 0, NULL );
+
+	/* ------------------------------------------------------------------------ */
+	/* root of the hierarchy													*/
+	/* ------------------------------------------------------------------------ */
+	twfs_root_inode.name	= "";
+	twfs_root_inode.ino		= FUSE_ROOT_ID;
+	twfs_root_inode.nlookup	= 1;
+	twfs_root_inode.hashed	= 1;
+	classifyTwfsInode( &twfs_root_inode, "/" );
+	twfs_ino_hash[ FUSE_ROOT_ID & ( DEF_TWFS_INODE_HASH_SIZE - 1 ) ]
+		= &twfs_root_inode;
+
+	if( ( getTwfsFuseArgs( argc, argv, &args ) < 0 ) ||
+		( fuse_parse_cmdline( &args, &mountpoint, &multithreaded, &foreground )
+		  < 0 ) )
+	{
+		fuse_opt_free_args( &args );
+		return( -1 );
+	}
+
+	if( !( ch = fuse_mount( mountpoint, &args ) ) )
+	{
+		free( mountpoint );
+		fuse_opt_free_args( &args );
+		return( -1 );
+	}
+
+	se = fuse_lowlevel_new( &args,
+							&twfs_ll_operations,
+							sizeof( twfs_ll_operations ),
+							NULL );
+
+	if( se )
+	{
+		if( fuse_set_signal_handlers( se ) != -1 )
+		{
+			fuse_session_add_chan( se, ch );
+
+			/* i/o threads are started by init after daemonizing				*/
+			fuse_daemonize( foreground );
+
+			workers = getTwfsWorkers( argc, argv );
+
+			if( multithreaded && ( 1 < workers ) )
+			{
+				result = runTwfsLlWorkers( se, workers );
+			}
+			else
+			{
+				result = fuse_session_loop( se );
+			}
+
+			fuse_remove_signal_handlers( se );
+			fuse_session_remove_chan( ch );
+		}
+
+		fuse_session_destroy( se );
+	}
+
+	fuse_unmount( mountpoint, ch );
+	free( mountpoint );
+	fuse_opt_free_args( &args );
+
+	return( result );
+}
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+==================================================================================
+	Function	:initTwfsLowLevel
+	Input		:void *userdata
+				 < user data >
+				 struct fuse_conn_info *conn
+				 < fuse connection information >
+	Output		:void
+	Return		:void
+	Description	:initialize twitter file system
+==================================================================================
+*/
+static void initTwfsLowLevel( void *userdata, struct fuse_conn_info *conn )
+{
+	getTwfsOperations( )->init( conn );
+}
+
+/*
+==================================================================================
+	Function	:destroyTwfsLowLevel
+	Input		:void *userdata
+				 < user data >
+	Output		:void
+	Return		:void
+	Description	:close twitter file system
+==================================================================================
+*/
+static void destroyTwfsLowLevel( void *userdata )
+{
+	getTwfsOperations( )->destroy( userdata );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlLookup
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of entry >
+	Output		:void
+	Return		:void
+	Description	:look up a directory entry by name
+==================================================================================
+*/
+static void twfsLlLookup( fuse_req_t req, fuse_ino_t parent, const char *name )
+{
+	int						result;
+	struct fuse_entry_param	entry;
+
+	if( ( result = replyTwfsEntry( req, parent, name, &entry ) ) < 0 )
+	{
+		fuse_reply_err( req, -result );
+	}
+}
+
+/*
+==================================================================================
+	Function	:twfsLlForget
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 unsigned long nlookup
+				 < number of lookups to forget >
+	Output		:void
+	Return		:void
+	Description	:forget an inode which the kernel does not refer any more
+==================================================================================
+*/
+static void twfsLlForget( fuse_req_t req, fuse_ino_t ino, unsigned long nlookup )
+{
+	struct twfs_inode	*inode;
+
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( ( inode = findTwfsInode( ino ) ) && ( inode != &twfs_root_inode ) )
+	{
+		if( inode->nlookup < nlookup )
+		{
+			logMessage( "forget too much:%lu\n", ( unsigned long )ino );
+			inode->nlookup = 0;
+		}
+		else
+		{
+			inode->nlookup -= nlookup;
+		}
+
+		putTwfsInode( inode );
+	}
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	fuse_reply_none( req );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlGetAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information, NULL:not opened >
+	Output		:void
+	Return		:void
+	Description	:get file attributes
+==================================================================================
+*/
+static void
+twfsLlGetAttributes( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi )
+{
+	int				result;
+	struct stat		statbuf;
+	char			path[ DEF_TWFS_PATH_MAX ];
+
+	memset( &statbuf, 0x00, sizeof( statbuf ) );
+
+	if( fi )
+	{
+		if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+		{
+			result = getTwfsOperations( )->fgetattr( path, &statbuf, fi );
+		}
+	}
+	else
+	{
+		result = getTwfsInodeAttributes( ino, &statbuf );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	statbuf.st_ino = ino;
+
+	fuse_reply_attr( req, &statbuf, DEF_TWFS_LL_ATTR_TIMEOUT );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlSetAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct stat *attr
+				 < attributes to set >
+				 int to_set
+				 < FUSE_SET_ATTR_* >
+				 struct fuse_file_info *fi
+				 < fuse file information, NULL:not opened >
+	Output		:void
+	Return		:void
+	Description	:change mode, owner, size or times of a file
+==================================================================================
+*/
+static void twfsLlSetAttributes( fuse_req_t req,
+								 fuse_ino_t ino,
+								 struct stat *attr,
+								 int to_set,
+								 struct fuse_file_info *fi )
+{
+	int								result;
+	const struct fuse_operations	*ops;
+	char							path[ DEF_TWFS_PATH_MAX ];
+
+	ops = getTwfsOperations( );
+
+	if( ( result = getTwfsInodePath( ino, path ) ) < 0 )
+	{
+		fuse_reply_err( req, -result );
+		return;
+	}
+
+	if( to_set & FUSE_SET_ATTR_MODE )
+	{
+		if( ( result = ops->chmod( path, attr->st_mode ) ) < 0 )
+		{
+			replyTwfsStatus( req, result );
+			return;
+		}
+	}
+
+	if( to_set & ( FUSE_SET_ATTR_UID | FUSE_SET_ATTR_GID ) )
+	{
+		result = ops->chown( path,
+							 ( to_set & FUSE_SET_ATTR_UID )
+							 ? attr->st_uid : ( uid_t )-1,
+							 ( to_set & FUSE_SET_ATTR_GID )
+							 ? attr->st_gid : ( gid_t )-1 );
+		if( result < 0 )
+		{
+			replyTwfsStatus( req, result );
+			return;
+		}
+	}
+
+	if( to_set & FUSE_SET_ATTR_SIZE )
+	{
+		if( fi )
+		{
+			result = ops->ftruncate( path, attr->st_size, fi );
+		}
+		else
+		{
+			result = ops->truncate( path, attr->st_size );
+		}
+
+		if( result < 0 )
+		{
+			replyTwfsStatus( req, result );
+			return;
+		}
+	}
+
+	if( to_set & ( FUSE_SET_ATTR_ATIME | FUSE_SET_ATTR_MTIME ) )
+	{
+		struct stat		now;
+		struct utimbuf	ubuf;
+
+		/* -------------------------------------------------------------------- */
+		/* utime sets both times, so keep the one which is not requested		*/
+		/* -------------------------------------------------------------------- */
+		if( ( result = getTwfsInodeAttributes( ino, &now ) ) < 0 )
+		{
+			replyTwfsStatus( req, result );
+			return;
+		}
+
+		ubuf.actime		= ( to_set & FUSE_SET_ATTR_ATIME )
+						  ? attr->st_atime : now.st_atime;
+		ubuf.modtime	= ( to_set & FUSE_SET_ATTR_MTIME )
+						  ? attr->st_mtime : now.st_mtime;
+
+		if( ( result = ops->utime( path, &ubuf ) ) < 0 )
+		{
+			replyTwfsStatus( req, result );
+			return;
+		}
+	}
+
+	twfsLlGetAttributes( req, ino, fi );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlReadLink
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+	Output		:void
+	Return		:void
+	Description	:read link
+==================================================================================
+*/
+static void twfsLlReadLink( fuse_req_t req, fuse_ino_t ino )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+	char	link[ DEF_TWFS_PATH_MAX ];
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->readlink( path, link, sizeof( link ) );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	fuse_reply_readlink( req, link );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlMakeNode
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of node >
+				 mode_t mode
+				 < file mode >
+				 dev_t rdev
+				 < device >
+	Output		:void
+	Return		:void
+	Description	:make node
+==================================================================================
+*/
+static void twfsLlMakeNode( fuse_req_t req,
+							fuse_ino_t parent,
+							const char *name,
+							mode_t mode,
+							dev_t rdev )
+{
+	int						result;
+	char					path[ DEF_TWFS_PATH_MAX ];
+	struct fuse_entry_param	entry;
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->mknod( path, mode, rdev );
+	}
+
+	if( ( result < 0 ) ||
+		( ( result = replyTwfsEntry( req, parent, name, &entry ) ) < 0 ) )
+	{
+		replyTwfsStatus( req, result );
+	}
+}
+
+/*
+==================================================================================
+	Function	:twfsLlMakeDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of directory >
+				 mode_t mode
+				 < file mode >
+	Output		:void
+	Return		:void
+	Description	:make a directory
+==================================================================================
+*/
+static void twfsLlMakeDirectory( fuse_req_t req,
+								 fuse_ino_t parent,
+								 const char *name,
+								 mode_t mode )
+{
+	int						result;
+	char					path[ DEF_TWFS_PATH_MAX ];
+	struct fuse_entry_param	entry;
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->mkdir( path, mode );
+	}
+
+	if( ( result < 0 ) ||
+		( ( result = replyTwfsEntry( req, parent, name, &entry ) ) < 0 ) )
+	{
+		replyTwfsStatus( req, result );
+	}
+}
+
+/*
+==================================================================================
+	Function	:twfsLlUnlink
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of file >
+	Output		:void
+	Return		:void
+	Description	:remove a file
+==================================================================================
+*/
+static void twfsLlUnlink( fuse_req_t req, fuse_ino_t parent, const char *name )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	struct twfs_inode	*inode;
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->unlink( path );
+	}
+
+	if( result == 0 )
+	{
+		/* -------------------------------------------------------------------- */
+		/* the name no longer leads to the inode; opened files keep it			*/
+		/* -------------------------------------------------------------------- */
+		pthread_mutex_lock( &twfs_inode_lock );
+
+		if( ( inode = findTwfsInode( parent ) ) &&
+			( inode = findTwfsChildInode( inode, name ) ) )
+		{
+			unhashTwfsInode( inode );
+		}
+
+		pthread_mutex_unlock( &twfs_inode_lock );
+	}
+
+	replyTwfsStatus( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlRemoveDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of directory >
+	Output		:void
+	Return		:void
+	Description	:remove a directory
+==================================================================================
+*/
+static void
+twfsLlRemoveDirectory( fuse_req_t req, fuse_ino_t parent, const char *name )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	struct twfs_inode	*inode;
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->rmdir( path );
+	}
+
+	if( result == 0 )
+	{
+		pthread_mutex_lock( &twfs_inode_lock );
+
+		if( ( inode = findTwfsInode( parent ) ) &&
+			( inode = findTwfsChildInode( inode, name ) ) )
+		{
+			unhashTwfsInode( inode );
+		}
+
+		pthread_mutex_unlock( &twfs_inode_lock );
+	}
+
+	replyTwfsStatus( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlSymbolicLink
+	Input		:fuse_req_t req
+				 < request >
+				 const char *link
+				 < contents of link >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of link >
+	Output		:void
+	Return		:void
+	Description	:create a symbolic link
+==================================================================================
+*/
+static void twfsLlSymbolicLink( fuse_req_t req,
+								const char *link,
+								fuse_ino_t parent,
+								const char *name )
+{
+	int						result;
+	char					path[ DEF_TWFS_PATH_MAX ];
+	struct fuse_entry_param	entry;
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->symlink( link, path );
+	}
+
+	if( ( result < 0 ) ||
+		( ( result = replyTwfsEntry( req, parent, name, &entry ) ) < 0 ) )
+	{
+		replyTwfsStatus( req, result );
+	}
+}
+
+/*
+==================================================================================
+	Function	:twfsLlRename
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of file >
+				 fuse_ino_t newparent
+				 < inode number of new parent directory >
+				 const char *newname
+				 < new name of file >
+	Output		:void
+	Return		:void
+	Description	:rename a file
+==================================================================================
+*/
+static void twfsLlRename( fuse_req_t req,
+						  fuse_ino_t parent,
+						  const char *name,
+						  fuse_ino_t newparent,
+						  const char *newname )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	char				newpath[ DEF_TWFS_PATH_MAX ];
+	char				*dup_name;
+	struct twfs_inode	*old_parent;
+	struct twfs_inode	*new_parent;
+	struct twfs_inode	*inode;
+	struct twfs_inode	*target;
+
+	if( ( ( result = getTwfsChildPath( parent, name, path ) ) < 0 ) ||
+		( ( result = getTwfsChildPath( newparent, newname, newpath ) ) < 0 ) )
+	{
+		fuse_reply_err( req, -result );
+		return;
+	}
+
+	if( ( result = getTwfsOperations( )->rename( path, newpath ) ) < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* move the node to its new name. nodes under it are classified again		*/
+	/* ------------------------------------------------------------------------ */
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	old_parent = findTwfsInode( parent );
+	new_parent = findTwfsInode( newparent );
+
+	if( new_parent && ( target = findTwfsChildInode( new_parent, newname ) ) )
+	{
+		unhashTwfsInode( target );
+	}
+
+	if( old_parent && new_parent &&
+		( inode = findTwfsChildInode( old_parent, name ) ) )
+	{
+		if( ( dup_name = strdup( newname ) ) )
+		{
+			unhashTwfsInode( inode );
+
+			new_parent->nchild++;
+			old_parent->nchild--;
+			inode->parent	= new_parent;
+			free( inode->name );
+			inode->name		= dup_name;
+
+			hashTwfsInode( inode );
+			putTwfsInode( old_parent );
+		}
+		else
+		{
+			/* the kernel looks it up again by the new name						*/
+			unhashTwfsInode( inode );
+		}
+	}
+
+	twfs_generation++;
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	fuse_reply_err( req, 0 );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlHardLink
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number of file >
+				 fuse_ino_t newparent
+				 < inode number of parent directory of link >
+				 const char *newname
+				 < name of link >
+	Output		:void
+	Return		:void
+	Description	:create a hard link
+==================================================================================
+*/
+static void twfsLlHardLink( fuse_req_t req,
+							fuse_ino_t ino,
+							fuse_ino_t newparent,
+							const char *newname )
+{
+	int						result;
+	char					path[ DEF_TWFS_PATH_MAX ];
+	char					newpath[ DEF_TWFS_PATH_MAX ];
+	struct fuse_entry_param	entry;
+
+	if( ( ( result = getTwfsInodePath( ino, path ) ) == 0 ) &&
+		( ( result = getTwfsChildPath( newparent, newname, newpath ) ) == 0 ) )
+	{
+		result = getTwfsOperations( )->link( path, newpath );
+	}
+
+	if( ( result < 0 ) ||
+		( ( result = replyTwfsEntry( req, newparent, newname, &entry ) ) < 0 ) )
+	{
+		replyTwfsStatus( req, result );
+	}
+}
+
+/*
+==================================================================================
+	Function	:twfsLlOpen
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:open a file
+==================================================================================
+*/
+static void
+twfsLlOpen( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->open( path, fi );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	fuse_reply_open( req, fi );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlRead
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 size_t size
+				 < size to read >
+				 off_t offset
+				 < read position >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:read a file
+==================================================================================
+*/
+static void twfsLlRead( fuse_req_t req,
+						fuse_ino_t ino,
+						size_t size,
+						off_t offset,
+						struct fuse_file_info *fi )
+{
+	int					result;
+	struct fuse_bufvec	*bufv;
+
+	/* ------------------------------------------------------------------------ */
+	/* opened file is found from its handle, path is only logged				*/
+	/* ------------------------------------------------------------------------ */
+	result = getTwfsOperations( )->read_buf( "", &bufv, size, offset, fi );
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	/* file descriptor is spliced to the kernel if it can be					*/
+	fuse_reply_data( req, bufv, FUSE_BUF_SPLICE_MOVE );
+
+	if( !( bufv->buf[ 0 ].flags & FUSE_BUF_IS_FD ) )
+	{
+		free( bufv->buf[ 0 ].mem );
+	}
+	free( bufv );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlWrite
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 const char *buf
+				 < data to write >
+				 size_t size
+				 < size of data >
+				 off_t offset
+				 < write position >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:write a file
+==================================================================================
+*/
+static void twfsLlWrite( fuse_req_t req,
+						 fuse_ino_t ino,
+						 const char *buf,
+						 size_t size,
+						 off_t offset,
+						 struct fuse_file_info *fi )
+{
+	int		result;
+
+	result = getTwfsOperations( )->write( "", buf, size, offset, fi );
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	fuse_reply_write( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlFlush
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:flush read/memory buffer
+==================================================================================
+*/
+static void
+twfsLlFlush( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi )
+{
+	replyTwfsStatus( req, getTwfsOperations( )->flush( "", fi ) );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlRelease
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:close a file
+==================================================================================
+*/
+static void
+twfsLlRelease( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi )
+{
+	replyTwfsStatus( req, getTwfsOperations( )->release( "", fi ) );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlFileSync
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 int datasync
+				 < flag to sync >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:synchronize a file
+==================================================================================
+*/
+static void twfsLlFileSync( fuse_req_t req,
+							fuse_ino_t ino,
+							int datasync,
+							struct fuse_file_info *fi )
+{
+	replyTwfsStatus( req, getTwfsOperations( )->fsync( "", datasync, fi ) );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlOpenDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:open a directory
+==================================================================================
+*/
+static void
+twfsLlOpenDirectory( fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	char				r_path[ DEF_TWFS_PATH_MAX ];
+	struct twfs_ll_dir	*dir;
+
+	if( ( result = getTwfsInodePath( ino, path ) ) < 0 )
+	{
+		fuse_reply_err( req, -result );
+		return;
+	}
+
+	if( !( dir = malloc( sizeof( struct twfs_ll_dir ) ) ) )
+	{
+		fuse_reply_err( req, ENOMEM );
+		return;
+	}
+
+	getRootAbsPath( r_path, path );
+
+	logMessage( "opendir:%s\n", r_path );
+
+	makeUserHomeOnAccess( path, true );
+
+	if( !( dir->dp = opendir( r_path ) ) )
+	{
+		result = errno;
+		free( dir );
+		fuse_reply_err( req, result );
+		return;
+	}
+
+	dir->entry	= NULL;
+	dir->offset	= 0;
+
+	fi->fh = ( uintptr_t )dir;
+
+	fuse_reply_open( req, fi );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlReadDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 size_t size
+				 < size of reply buffer >
+				 off_t offset
+				 < offset of first entry to read >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:read entries of a directory from the offset
+==================================================================================
+*/
+static void twfsLlReadDirectory( fuse_req_t req,
+								 fuse_ino_t ino,
+								 size_t size,
+								 off_t offset,
+								 struct fuse_file_info *fi )
+{
+	struct twfs_ll_dir	*dir;
+	char				*buf;
+	char				*p;
+	size_t				rem;
+	size_t				entsize;
+	off_t				nextoff;
+	struct stat			statbuf;
+
+	dir = ( struct twfs_ll_dir* )( uintptr_t )fi->fh;
+
+	if( !( buf = malloc( size ) ) )
+	{
+		fuse_reply_err( req, ENOMEM );
+		return;
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* seek only when the kernel does not continue from the last reply			*/
+	/* ------------------------------------------------------------------------ */
+	if( offset != dir->offset )
+	{
+		seekdir( dir->dp, offset );
+		dir->entry	= NULL;
+		dir->offset	= offset;
+	}
+
+	p	= buf;
+	rem	= size;
+
+	memset( &statbuf, 0x00, sizeof( statbuf ) );
+
+	for( ; ; )
+	{
+		if( !dir->entry )
+		{
+			errno = 0;
+
+			if( !( dir->entry = readdir( dir->dp ) ) )
+			{
+				if( errno && ( rem == size ) )
+				{
+					int		err = errno;
+
+					free( buf );
+					fuse_reply_err( req, err );
+					return;
+				}
+				break;
+			}
+		}
+
+		/* inode of backing directory is not the one lookup gives			*/
+		nextoff			= telldir( dir->dp );
+		statbuf.st_ino	= getTwfsEntryInode( ino, dir->entry->d_name );
+		statbuf.st_mode	= DTTOIF( dir->entry->d_type );
+
+		entsize = fuse_add_direntry( req, p, rem,
+									 dir->entry->d_name, &statbuf, nextoff );
+
+		if( rem < entsize )
+		{
+			/* keep the entry for next request									*/
+			break;
+		}
+
+		p			+= entsize;
+		rem			-= entsize;
+		dir->entry	= NULL;
+		dir->offset	= nextoff;
+	}
+
+	fuse_reply_buf( req, buf, size - rem );
+
+	free( buf );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlReleaseDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:close a directory
+==================================================================================
+*/
+static void twfsLlReleaseDirectory( fuse_req_t req,
+									fuse_ino_t ino,
+									struct fuse_file_info *fi )
+{
+	struct twfs_ll_dir	*dir;
+
+	dir = ( struct twfs_ll_dir* )( uintptr_t )fi->fh;
+
+	closedir( dir->dp );
+	free( dir );
+
+	fuse_reply_err( req, 0 );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlFileSyncDirectory
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 int datasync
+				 < flag to sync >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:synchronize a directory
+==================================================================================
+*/
+static void twfsLlFileSyncDirectory( fuse_req_t req,
+									 fuse_ino_t ino,
+									 int datasync,
+									 struct fuse_file_info *fi )
+{
+	fuse_reply_err( req, 0 );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlStatisticsFileSystem
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+	Output		:void
+	Return		:void
+	Description	:get file system statistics
+==================================================================================
+*/
+static void twfsLlStatisticsFileSystem( fuse_req_t req, fuse_ino_t ino )
+{
+	int				result;
+	struct statvfs	statv;
+
+	memset( &statv, 0x00, sizeof( statv ) );
+
+	if( ( result = getTwfsOperations( )->statfs( "/", &statv ) ) < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	fuse_reply_statfs( req, &statv );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlSetExtendedAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 const char *name
+				 < name of attribute >
+				 const char *value
+				 < value of attribute >
+				 size_t size
+				 < size of value >
+				 int flags
+				 < XATTR_* >
+	Output		:void
+	Return		:void
+	Description	:set extended attributes
+==================================================================================
+*/
+static void twfsLlSetExtendedAttributes( fuse_req_t req,
+										 fuse_ino_t ino,
+										 const char *name,
+										 const char *value,
+										 size_t size,
+										 int flags )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->setxattr( path, name, value, size, flags );
+	}
+
+	replyTwfsStatus( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlGetExtendedAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 const char *name
+				 < name of attribute >
+				 size_t size
+				 < size of reply buffer, 0:ask size of value >
+	Output		:void
+	Return		:void
+	Description	:get extended attributes
+==================================================================================
+*/
+static void twfsLlGetExtendedAttributes( fuse_req_t req,
+										 fuse_ino_t ino,
+										 const char *name,
+										 size_t size )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+	char	*value = NULL;
+
+	if( size && !( value = malloc( size ) ) )
+	{
+		fuse_reply_err( req, ENOMEM );
+		return;
+	}
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->getxattr( path, name, value, size );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+	}
+	else if( size )
+	{
+		fuse_reply_buf( req, value, result );
+	}
+	else
+	{
+		fuse_reply_xattr( req, result );
+	}
+
+	free( value );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlListExtendedAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 size_t size
+				 < size of reply buffer, 0:ask size of list >
+	Output		:void
+	Return		:void
+	Description	:list extended attributes
+==================================================================================
+*/
+static void
+twfsLlListExtendedAttributes( fuse_req_t req, fuse_ino_t ino, size_t size )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+	char	*list = NULL;
+
+	if( size && !( list = malloc( size ) ) )
+	{
+		fuse_reply_err( req, ENOMEM );
+		return;
+	}
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->listxattr( path, list, size );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+	}
+	else if( size )
+	{
+		fuse_reply_buf( req, list, result );
+	}
+	else
+	{
+		fuse_reply_xattr( req, result );
+	}
+
+	free( list );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlRemoveExtendedAttributes
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 const char *name
+				 < name of attribute >
+	Output		:void
+	Return		:void
+	Description	:remove extended attributes
+==================================================================================
+*/
+static void twfsLlRemoveExtendedAttributes( fuse_req_t req,
+											fuse_ino_t ino,
+											const char *name )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->removexattr( path, name );
+	}
+
+	replyTwfsStatus( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlAccess
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t ino
+				 < inode number >
+				 int mask
+				 < mask >
+	Output		:void
+	Return		:void
+	Description	:check file access permissions
+==================================================================================
+*/
+static void twfsLlAccess( fuse_req_t req, fuse_ino_t ino, int mask )
+{
+	int		result;
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	if( ( result = getTwfsInodePath( ino, path ) ) == 0 )
+	{
+		result = getTwfsOperations( )->access( path, mask );
+	}
+
+	replyTwfsStatus( req, result );
+}
+
+/*
+==================================================================================
+	Function	:twfsLlCreate
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of file >
+				 mode_t mode
+				 < file mode >
+				 struct fuse_file_info *fi
+				 < fuse file information >
+	Output		:void
+	Return		:void
+	Description	:create and open a file
+==================================================================================
+*/
+static void twfsLlCreate( fuse_req_t req,
+						  fuse_ino_t parent,
+						  const char *name,
+						  mode_t mode,
+						  struct fuse_file_info *fi )
+{
+	int								result;
+	char							path[ DEF_TWFS_PATH_MAX ];
+	const struct fuse_operations	*ops;
+	struct fuse_entry_param			entry;
+	struct twfs_inode				*dir;
+	struct twfs_inode				*inode;
+
+	ops = getTwfsOperations( );
+
+	if( ( result = getTwfsChildPath( parent, name, path ) ) == 0 )
+	{
+		result = ops->create( path, mode, fi );
+	}
+
+	if( result < 0 )
+	{
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	memset( &entry, 0x00, sizeof( entry ) );
+
+	/* ------------------------------------------------------------------------ */
+	/* twfs files such as tweet are created without their backing file, so		*/
+	/* attributes of opened file are replied									*/
+	/* ------------------------------------------------------------------------ */
+	if( ( result = ops->fgetattr( path, &entry.attr, fi ) ) < 0 )
+	{
+		ops->release( path, fi );
+		replyTwfsStatus( req, result );
+		return;
+	}
+
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( ( dir = findTwfsInode( parent ) ) )
+	{
+		if( !( inode = findTwfsChildInode( dir, name ) ) &&
+			!( inode = allocTwfsInode( dir, name ) ) )
+		{
+			pthread_mutex_unlock( &twfs_inode_lock );
+			ops->release( path, fi );
+			fuse_reply_err( req, ENOMEM );
+			return;
+		}
+		inode->nlookup++;
+		entry.ino = inode->ino;
+	}
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	if( !entry.ino )
+	{
+		ops->release( path, fi );
+		fuse_reply_err( req, ENOENT );
+		return;
+	}
+
+	entry.attr.st_ino		= entry.ino;
+	entry.attr_timeout		= DEF_TWFS_LL_ATTR_TIMEOUT;
+	entry.entry_timeout		= DEF_TWFS_LL_ENTRY_TIMEOUT;
+
+	fuse_reply_create( req, &entry, fi );
+}
+
+/*
+==================================================================================
+	Function	:getTwfsInodePath
+	Input		:fuse_ino_t ino
+				 < inode number >
+				 char *path
+				 < buffer of DEF_TWFS_PATH_MAX for path over twfs >
+	Output		:char *path
+				 < path to file over twfs >
+	Return		:int
+				 < -ENOENT:unknown inode, -ENAMETOOLONG:path is too long >
+	Description	:get path of an inode
+==================================================================================
+*/
+static int getTwfsInodePath( fuse_ino_t ino, char *path )
+{
+	int					result;
+	struct twfs_inode	*inode;
+
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( ( inode = findTwfsInode( ino ) ) )
+	{
+		result = makeTwfsInodePath( inode, path );
+	}
+	else
+	{
+		result = -ENOENT;
+	}
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	return( result );
+}
+
+/*
+==================================================================================
+	Function	:getTwfsChildPath
+	Input		:fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of entry >
+				 char *path
+				 < buffer of DEF_TWFS_PATH_MAX for path over twfs >
+	Output		:char *path
+				 < path to entry over twfs >
+	Return		:int
+				 < -ENOENT:unknown inode, -ENAMETOOLONG:path is too long >
+	Description	:get path of an entry in a directory inode
+==================================================================================
+*/
+static int getTwfsChildPath( fuse_ino_t parent, const char *name, char *path )
+{
+	int		result;
+	size_t	len;
+	size_t	name_len;
+
+	if( ( result = getTwfsInodePath( parent, path ) ) < 0 )
+	{
+		return( result );
+	}
+
+	len			= strlen( path );
+	name_len	= strlen( name );
+
+	if( ( len == 1 ) && ( path[ 0 ] == '/' ) )
+	{
+		len = 0;
+	}
+
+	if( DEF_TWFS_PATH_MAX <= ( len + 1 + name_len ) )
+	{
+		return( -ENAMETOOLONG );
+	}
+
+	path[ len ] = '/';
+	memcpy( path + len + 1, name, name_len + 1 );
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:makeTwfsInodePath
+	Input		:const struct twfs_inode *inode
+				 < inode >
+				 char *path
+				 < buffer of DEF_TWFS_PATH_MAX for path over twfs >
+	Output		:char *path
+				 < path to file over twfs >
+	Return		:int
+				 < -ENAMETOOLONG:path is too long >
+	Description	:make path of an inode from names of its ancestors. caller must
+				 hold twfs_inode_lock
+==================================================================================
+*/
+static int makeTwfsInodePath( const struct twfs_inode *inode, char *path )
+{
+	char						buf[ DEF_TWFS_PATH_MAX ];
+	char						*p;
+	size_t						len;
+	const struct twfs_inode		*node;
+
+	if( !inode->parent )
+	{
+		path[ 0 ] = '/';
+		path[ 1 ] = '\0';
+		return( 0 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* fill names from the end of buffer while going up to root				*/
+	/* ------------------------------------------------------------------------ */
+	p		= buf + sizeof( buf ) - 1;
+	*p		= '\0';
+
+	for( node = inode ; node->parent ; node = node->parent )
+	{
+		len = strlen( node->name );
+
+		if( ( size_t )( p - buf ) < ( len + 1 ) )
+		{
+			return( -ENAMETOOLONG );
+		}
+
+		p -= len;
+		memcpy( p, node->name, len );
+		*( --p ) = '/';
+	}
+
+	memcpy( path, p, ( buf + sizeof( buf ) ) - p );
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:getTwfsInodeAttributes
+	Input		:fuse_ino_t ino
+				 < inode number >
+				 struct stat *statbuf
+				 < statistics information buffer >
+	Output		:struct stat *statbuf
+				 < statistics information buffer >
+	Return		:int
+				 < status >
+	Description	:get attributes of an inode without classifying its path
+				 again
+==================================================================================
+*/
+static int getTwfsInodeAttributes( fuse_ino_t ino, struct stat *statbuf )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	char				r_path[ DEF_TWFS_PATH_MAX ];
+	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	E_TWFS_FILE_TYPE	file_type;
+	struct twfs_inode	*inode;
+
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( !( inode = findTwfsInode( ino ) ) )
+	{
+		pthread_mutex_unlock( &twfs_inode_lock );
+		return( -ENOENT );
+	}
+
+	if( ( result = makeTwfsInodePath( inode, path ) ) < 0 )
+	{
+		pthread_mutex_unlock( &twfs_inode_lock );
+		return( result );
+	}
+
+	if( inode->generation != twfs_generation )
+	{
+		classifyTwfsInode( inode, path );
+	}
+
+	file_type = inode->file_type;
+	memcpy( sname1, inode->sname1, sizeof( sname1 ) );
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	getRootAbsPath( r_path, path );
+
+	return( getTwfsAttributes( file_type, sname1, r_path, statbuf ) );
+}
+
+/*
+==================================================================================
+	Function	:replyTwfsEntry
+	Input		:fuse_req_t req
+				 < request >
+				 fuse_ino_t parent
+				 < inode number of parent directory >
+				 const char *name
+				 < name of entry >
+				 struct fuse_entry_param *entry
+				 < buffer for entry >
+	Output		:struct fuse_entry_param *entry
+				 < replied entry >
+	Return		:int
+				 < status. request has been replied only if it is 0 >
+	Description	:look up an entry, count the lookup and reply it
+==================================================================================
+*/
+static int replyTwfsEntry( fuse_req_t req,
+						   fuse_ino_t parent,
+						   const char *name,
+						   struct fuse_entry_param *entry )
+{
+	int					result;
+	char				path[ DEF_TWFS_PATH_MAX ];
+	char				r_path[ DEF_TWFS_PATH_MAX ];
+	char				sname1[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+	E_TWFS_FILE_TYPE	file_type;
+	struct twfs_inode	*dir;
+	struct twfs_inode	*inode;
+
+	memset( entry, 0x00, sizeof( *entry ) );
+
+	if( DEF_TWFS_PATH_MAX <= strlen( name ) )
+	{
+		return( -ENAMETOOLONG );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* find or make the node, path is classified only when it is new			*/
+	/* ------------------------------------------------------------------------ */
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( !( dir = findTwfsInode( parent ) ) )
+	{
+		pthread_mutex_unlock( &twfs_inode_lock );
+		return( -ENOENT );
+	}
+
+	if( !( inode = findTwfsChildInode( dir, name ) ) )
+	{
+		if( !( inode = allocTwfsInode( dir, name ) ) )
+		{
+			pthread_mutex_unlock( &twfs_inode_lock );
+			return( -ENOMEM );
+		}
+	}
+
+	if( ( result = makeTwfsInodePath( inode, path ) ) < 0 )
+	{
+		putTwfsInode( inode );
+		pthread_mutex_unlock( &twfs_inode_lock );
+		return( result );
+	}
+
+	if( inode->generation != twfs_generation )
+	{
+		classifyTwfsInode( inode, path );
+	}
+
+	file_type = inode->file_type;
+	memcpy( sname1, inode->sname1, sizeof( sname1 ) );
+
+	/* hold the node while its backing file is looked up						*/
+	inode->nlookup++;
+	entry->ino = inode->ino;
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	getRootAbsPath( r_path, path );
+
+	/* user home is made when something under it is looked up first			*/
+	makeUserHomeOnAccess( path, false );
+
+	result = getTwfsAttributes( file_type, sname1, r_path, &entry->attr );
+
+	if( result < 0 )
+	{
+		pthread_mutex_lock( &twfs_inode_lock );
+		inode->nlookup--;
+		putTwfsInode( inode );
+		pthread_mutex_unlock( &twfs_inode_lock );
+		return( result );
+	}
+
+	entry->attr.st_ino		= entry->ino;
+	entry->attr_timeout		= DEF_TWFS_LL_ATTR_TIMEOUT;
+	entry->entry_timeout	= DEF_TWFS_LL_ENTRY_TIMEOUT;
+
+	fuse_reply_entry( req, entry );
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:findTwfsInode
+	Input		:fuse_ino_t ino
+				 < inode number >
+	Output		:void
+	Return		:struct twfs_inode*
+				 < inode, NULL:not found >
+	Description	:find an inode by its number. caller must hold twfs_inode_lock
+==================================================================================
+*/
+static struct twfs_inode* findTwfsInode( fuse_ino_t ino )
+{
+	struct twfs_inode	*inode;
+
+	inode = twfs_ino_hash[ ino & ( DEF_TWFS_INODE_HASH_SIZE - 1 ) ];
+
+	for( ; inode ; inode = inode->ino_next )
+	{
+		if( inode->ino == ino )
+		{
+			return( inode );
+		}
+	}
+
+	return( NULL );
+}
+
+/*
+==================================================================================
+	Function	:getTwfsEntryInode
+	Input		:fuse_ino_t ino
+				 < inode number of directory >
+				 const char *name
+				 < name of entry in the directory >
+	Output		:void
+	Return		:fuse_ino_t
+				 < inode number given by lookup, DEF_TWFS_UNKNOWN_INO:not
+				   looked up >
+	Description	:get inode number of an entry to report by readdir
+==================================================================================
+*/
+static fuse_ino_t getTwfsEntryInode( fuse_ino_t ino, const char *name )
+{
+	struct twfs_inode	*dir;
+	struct twfs_inode	*inode;
+	fuse_ino_t			entry_ino;
+
+	entry_ino = DEF_TWFS_UNKNOWN_INO;
+
+	pthread_mutex_lock( &twfs_inode_lock );
+
+	if( ( dir = findTwfsInode( ino ) ) )
+	{
+		if( strcmp( name, "." ) == 0 )
+		{
+			entry_ino = dir->ino;
+		}
+		else if( strcmp( name, ".." ) == 0 )
+		{
+			entry_ino = dir->parent ? dir->parent->ino : dir->ino;
+		}
+		else if( ( inode = findTwfsChildInode( dir, name ) ) )
+		{
+			entry_ino = inode->ino;
+		}
+	}
+
+	pthread_mutex_unlock( &twfs_inode_lock );
+
+	return( entry_ino );
+}
+
+/*
+==================================================================================
+	Function	:findTwfsChildInode
+	Input		:const struct twfs_inode *parent
+				 < parent directory >
+				 const char *name
+				 < name of entry >
+	Output		:void
+	Return		:struct twfs_inode*
+				 < inode, NULL:not found >
+	Description	:find an inode by its parent and name. caller must hold
+				 twfs_inode_lock
+==================================================================================
+*/
+static struct twfs_inode*
+findTwfsChildInode( const struct twfs_inode *parent, const char *name )
+{
+	struct twfs_inode	*inode;
+
+	inode = twfs_name_hash[ hashTwfsName( parent, name ) ];
+
+	for( ; inode ; inode = inode->name_next )
+	{
+		if( ( inode->parent == parent ) && ( strcmp( inode->name, name ) == 0 ) )
+		{
+			return( inode );
+		}
+	}
+
+	return( NULL );
+}
+
+/*
+==================================================================================
+	Function	:allocTwfsInode
+	Input		:struct twfs_inode *parent
+				 < parent directory >
+				 const char *name
+				 < name of entry >
+	Output		:void
+	Return		:struct twfs_inode*
+				 < new inode, NULL:no memory >
+	Description	:allocate an inode with a new number and hash it. caller must
+				 hold twfs_inode_lock
+==================================================================================
+*/
+static struct twfs_inode*
+allocTwfsInode( struct twfs_inode *parent, const char *name )
+{
+	struct twfs_inode	*inode;
+	unsigned int		hash;
+
+	if( !( inode = calloc( 1, sizeof( struct twfs_inode ) ) ) )
+	{
+		return( NULL );
+	}
+
+	if( !( inode->name = strdup( name ) ) )
+	{
+		free( inode );
+		return( NULL );
+	}
+
+	inode->parent		= parent;
+	inode->ino			= twfs_next_ino++;
+	inode->generation	= twfs_generation - 1;	// not classified yet
+	parent->nchild++;
+
+	hash = inode->ino & ( DEF_TWFS_INODE_HASH_SIZE - 1 );
+	inode->ino_next			= twfs_ino_hash[ hash ];
+	twfs_ino_hash[ hash ]	= inode;
+
+	hashTwfsInode( inode );
+
+	return( inode );
+}
+
+/*
+==================================================================================
+	Function	:hashTwfsInode
+	Input		:struct twfs_inode *inode
+				 < inode >
+	Output		:void
+	Return		:void
+	Description	:make an inode found by its parent and name. caller must hold
+				 twfs_inode_lock
+==================================================================================
+*/
+static void hashTwfsInode( struct twfs_inode *inode )
+{
+	unsigned int	hash;
+
+	hash = hashTwfsName( inode->parent, inode->name );
+
+	inode->name_next		= twfs_name_hash[ hash ];
+	twfs_name_hash[ hash ]	= inode;
+	inode->hashed			= 1;
+}
+
+/*
+==================================================================================
+	Function	:unhashTwfsInode
+	Input		:struct twfs_inode *inode
+				 < inode >
+	Output		:void
+	Return		:void
+	Description	:make an inode not found by its parent and name any more.
+				 caller must hold twfs_inode_lock
+==================================================================================
+*/
+static void unhashTwfsInode( struct twfs_inode *inode )
+{
+	struct twfs_inode	**pp;
+
+	if( !inode->hashed )
+	{
+		return;
+	}
+
+	pp = &twfs_name_hash[ hashTwfsName( inode->parent, inode->name ) ];
+
+	for( ; *pp ; pp = &( *pp )->name_next )
+	{
+		if( *pp == inode )
+		{
+			*pp = inode->name_next;
+			break;
+		}
+	}
+
+	inode->name_next	= NULL;
+	inode->hashed		= 0;
+}
+
+/*
+==================================================================================
+	Function	:putTwfsInode
+	Input		:struct twfs_inode *inode
+				 < inode >
+	Output		:void
+	Return		:void
+	Description	:free an inode and its unused ancestors if neither the kernel
+				 nor children refer it. caller must hold twfs_inode_lock
+==================================================================================
+*/
+static void putTwfsInode( struct twfs_inode *inode )
+{
+	struct twfs_inode	*parent;
+	struct twfs_inode	**pp;
+
+	while( inode && inode->parent && !inode->nlookup && !inode->nchild )
+	{
+		unhashTwfsInode( inode );
+
+		pp = &twfs_ino_hash[ inode->ino & ( DEF_TWFS_INODE_HASH_SIZE - 1 ) ];
+
+		for( ; *pp ; pp = &( *pp )->ino_next )
+		{
+			if( *pp == inode )
+			{
+				*pp = inode->ino_next;
+				break;
+			}
+		}
+
+		parent = inode->parent;
+		parent->nchild--;
+
+		free( inode->name );
+		free( inode );
+
+		inode = parent;
+	}
+}
+
+/*
+==================================================================================
+	Function	:classifyTwfsInode
+	Input		:struct twfs_inode *inode
+				 < inode >
+				 const char *path
+				 < path to inode over twfs >
+	Output		:void
+	Return		:void
+	Description	:classify path of an inode and remember it. caller must hold
+				 twfs_inode_lock
+==================================================================================
+*/
+static void classifyTwfsInode( struct twfs_inode *inode, const char *path )
+{
+	char	sname2[ DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 ];
+	char	sname3[ DEF_TWAPI_MAX_SCREEN_NAME_LEN ];
+
+	inode->file_type	= whichTwfsPath( path, inode->sname1, sname2, sname3 );
+	inode->generation	= twfs_generation;
+}
+
+/*
+==================================================================================
+	Function	:hashTwfsName
+	Input		:const struct twfs_inode *parent
+				 < parent directory >
+				 const char *name
+				 < name of entry >
+	Output		:void
+	Return		:unsigned int
+				 < index of twfs_name_hash >
+	Description	:hash parent and name of an entry
+==================================================================================
+*/
+static unsigned int hashTwfsName( const struct twfs_inode *parent,
+								  const char *name )
+{
+	uint32_t	hash;
+
+	/* ------------------------------------------------------------------------ */
+	/* fnv-1a of name, seeded with parent										*/
+	/* ------------------------------------------------------------------------ */
+	hash = 2166136261u ^ ( uint32_t )( parent ? parent->ino : 0 );
+
+	for( ; *name ; name++ )
+	{
+		hash ^= ( uint8_t )*name;
+		hash *= 16777619u;
+	}
+
+	return( hash & ( DEF_TWFS_INODE_HASH_SIZE - 1 ) );
+}
+
+/*
+==================================================================================
+	Function	:replyTwfsStatus
+	Input		:fuse_req_t req
+				 < request >
+				 int result
+				 < result of twfs operation >
+	Output		:void
+	Return		:void
+	Description	:reply result of an operation which has no data to reply
+==================================================================================
+*/
+static void replyTwfsStatus( fuse_req_t req, int result )
+{
+	/* ------------------------------------------------------------------------ */
+	/* some operations return -1 of system call as it is, which is -EPERM as	*/
+	/* fuse high-level api treats it											*/
+	/* ------------------------------------------------------------------------ */
+	if( result < 0 )
+	{
+		fuse_reply_err( req, -result );
+	}
+	else
+	{
+		fuse_reply_err( req, 0 );
+	}
+}
+
+/*
+==================================================================================
+	Function	:runTwfsLlWorkers
+	Input		:struct fuse_session *se
+				 < fuse session >
+				 int workers
+				 < number of threads serving requests >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:serve requests of the kernel with a fixed number of threads
+				 until the session exits
+==================================================================================
+*/
+static int runTwfsLlWorkers( struct fuse_session *se, int workers )
+{
+	int						i;
+	int						started;
+	pthread_t				*threads;
+	struct twfs_ll_workers	pool;
+
+	if( !( threads = malloc( sizeof( pthread_t ) * workers ) ) )
+	{
+		return( -1 );
+	}
+
+	pool.se = se;
+	sem_init( &pool.finished, 0, 0 );
+
+	for( started = 0 ; started < workers ; started++ )
+	{
+		if( pthread_create( &threads[ started ], NULL, runTwfsLlWorker, &pool ) )
+		{
+			logMessage( "cannot start worker %d\n", started );
+			break;
+		}
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* wait for unmounting or a signal. the signal may be caught by a worker	*/
+	/* ------------------------------------------------------------------------ */
+	while( started && !fuse_session_exited( se ) )
+	{
+		if( sem_wait( &pool.finished ) == 0 )
+		{
+			break;
+		}
+	}
+
+	/* workers blocked in receiving a request never see the exit flag		*/
+	for( i = 0 ; i < started ; i++ )
+	{
+		pthread_cancel( threads[ i ] );
+	}
+
+	for( i = 0 ; i < started ; i++ )
+	{
+		pthread_join( threads[ i ], NULL );
+	}
+
+	sem_destroy( &pool.finished );
+	free( threads );
+
+	if( !started )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:runTwfsLlWorker
+	Input		:void *arg
+				 < workers of session >
+	Output		:void
+	Return		:void*
+				 < NULL >
+	Description	:receive requests of the kernel and process them.
+				 the thread can be cancelled only while it waits for a request
+==================================================================================
+*/
+static void* runTwfsLlWorker( void *arg )
+{
+	int						result;
+	char					*mem;
+	size_t					bufsize;
+	struct fuse_chan		*ch;
+	struct fuse_chan		*tmpch;
+	struct fuse_buf			fbuf;
+	struct twfs_ll_workers	*pool;
+
+	pthread_setcancelstate( PTHREAD_CANCEL_DISABLE, NULL );
+
+	pool	= ( struct twfs_ll_workers* )arg;
+	ch		= fuse_session_next_chan( pool->se, NULL );
+	bufsize	= fuse_chan_bufsize( ch );
+
+	if( !( mem = malloc( bufsize ) ) )
+	{
+		fuse_session_exit( pool->se );
+		sem_post( &pool->finished );
+		return( NULL );
+	}
+
+	pthread_cleanup_push( free, mem );
+
+	while( !fuse_session_exited( pool->se ) )
+	{
+		memset( &fbuf, 0x00, sizeof( fbuf ) );
+		fbuf.mem	= mem;
+		fbuf.size	= bufsize;
+		tmpch		= ch;
+
+		pthread_setcancelstate( PTHREAD_CANCEL_ENABLE, NULL );
+		result = fuse_session_receive_buf( pool->se, &fbuf, &tmpch );
+		pthread_setcancelstate( PTHREAD_CANCEL_DISABLE, NULL );
+
+		if( result == -EINTR )
+		{
+			continue;
+		}
+
+		if( result <= 0 )
+		{
+			break;
+		}
+
+		fuse_session_process_buf( pool->se, &fbuf, tmpch );
+	}
+
+	pthread_cleanup_pop( 1 );
+
+	fuse_session_exit( pool->se );
+	sem_post( &pool->finished );
+
+	return( NULL );
+}
@@ -0,0 +1,1071 @@
+/*******************************************************************************
+ File:twfs_queue.c
+ Description:Outbound queue of mutations to twitter
+
+ journal is a text file which is only appended to, and truncated when the
+ queue becomes empty.
+	+ seq op arg1 arg2 arg3 size\n[ message of size ]\n	: queued
+	! seq attempts\n										: retry later
+	- seq done|failed|rejected\n							: finished
+*******************************************************************************/
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "twfs.h"
+#include "twfs_queue.h"
+#include "twitter_operation.h"
+#include "lib/log.h"
+#include "lib/utils.h"
+#include "lib/utf.h"
+#include "net/twitter_api.h"
+#include "net/ssl.h"
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+struct twfs_mutation;
+
+static void* runTwfsQueue( void *arg );
+static int getTwfsBatch( const struct twfs_mutation *mutation, char *names );
+static int sendTwfsBatch( struct ssl_session *session,
+						  const struct twfs_mutation *mutation,
+						  const char *names );
+static int sendTwfsMutation( struct ssl_session *session,
+							 const struct twfs_mutation *mutation );
+static bool isTwfsRetryable( int status_code );
+static int replayTwfsJournal( void );
+static int appendTwfsJournal( const char *record, size_t size, bool sync );
+static struct twfs_mutation* allocTwfsMutation( E_TWFS_MUT mut,
+												const char *arg1,
+												const char *arg2,
+												const char *arg3,
+												const char *msg,
+												int size );
+static void pushTwfsMutation( struct twfs_mutation *mutation );
+static E_TWFS_MUT getTwfsMutationType( const char *name );
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+#define	DEF_TWFS_QUEUE_ARG_LEN			( DEF_REST_ACTUAL_SLUG_MAX_LENGTH + 1 )
+#define	DEF_TWFS_QUEUE_RECORD_LEN		( 64 + DEF_TWFS_QUEUE_ARG_LEN * 3 )
+#define	DEF_TWFS_QUEUE_NO_ARG			"-"
+
+/* ---------------------------------------------------------------------------- */
+/* members of a list queued within the window are added or removed at once.		*/
+/* names of a batch are limited by the buffer of oauth signature				*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWFS_QUEUE_BATCH_WINDOW		1		// sec
+#define	DEF_TWFS_QUEUE_BATCH_LEN		512
+
+/* mutation waiting to be sent													*/
+struct twfs_mutation
+{
+	struct twfs_mutation	*next;
+	unsigned long			seq;
+	E_TWFS_MUT				mut;
+	int						attempts;
+	time_t					queued;
+	time_t					next_try;		// not sent before this time
+	bool					single;			// true:failed in a batch
+	char					arg[ 3 ][ DEF_TWFS_QUEUE_ARG_LEN ];
+	int						size;
+	char					msg[ ];			// terminated by null
+};
+
+struct twfs_queue
+{
+	pthread_mutex_t			lock;			// protects all members below
+	pthread_cond_t			cond;			// signaled when queued or stopped
+	pthread_t				thread;
+	bool					running;
+	bool					stop;
+	int						fd;				// journal
+	unsigned long			next_seq;
+	struct twfs_mutation	*head;
+	struct twfs_mutation	*tail;
+};
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+static struct twfs_queue twfs_queue =
+{
+	.lock	= PTHREAD_MUTEX_INITIALIZER,
+	.cond	= PTHREAD_COND_INITIALIZER,
+	.fd		= -1,
+};
+
+static const char *twfs_mut_names[ E_TWFS_MUT_NUM ] =
+{
+	[ E_TWFS_MUT_TWEET ]			= "tweet",
+	[ E_TWFS_MUT_DM ]				= "dm",
+	[ E_TWFS_MUT_REMOVE_TWEET ]		= "remove_tweet",
+	[ E_TWFS_MUT_REMOVE_DM ]		= "remove_dm",
+	[ E_TWFS_MUT_FOLLOW ]			= "follow",
+	[ E_TWFS_MUT_UNFOLLOW ]			= "unfollow",
+	[ E_TWFS_MUT_FAVORITE ]			= "favorite",
+	[ E_TWFS_MUT_UNFAVORITE ]		= "unfavorite",
+	[ E_TWFS_MUT_BLOCK ]			= "block",
+	[ E_TWFS_MUT_UNBLOCK ]			= "unblock",
+	[ E_TWFS_MUT_ADD_MEMBER ]		= "add_member",
+	[ E_TWFS_MUT_REMOVE_MEMBER ]	= "remove_member",
+	[ E_TWFS_MUT_SUBSCRIBE ]		= "subscribe",
+	[ E_TWFS_MUT_UNSUBSCRIBE ]		= "unsubscribe",
+	[ E_TWFS_MUT_DELETE_LISTS ]		= "delete_lists",
+};
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsQueue
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:open journal of the queue, queue mutations left in it and
+				 start to send them
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsQueue( const char *root_path )
+{
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	if( twfs_queue.running )
+	{
+		return( 0 );
+	}
+
+	snprintf( path, sizeof( path ), "%s/%s", root_path, DEF_TWFS_QUEUE_FILE );
+
+	if( ( twfs_queue.fd = openFile( path, O_RDWR | O_CREAT, 0644 ) ) < 0 )
+	{
+		logMessage( "cannot open journal:%s\n", path );
+		return( -1 );
+	}
+
+	twfs_queue.next_seq	= 1;
+	twfs_queue.head		= NULL;
+	twfs_queue.tail		= NULL;
+	twfs_queue.stop		= false;
+
+	/* ------------------------------------------------------------------------ */
+	/* mutations which were not sent at last mount go first						*/
+	/* ------------------------------------------------------------------------ */
+	if( replayTwfsJournal( ) < 0 )
+	{
+		logMessage( "cannot replay journal:%s\n", path );
+	}
+
+	if( pthread_create( &twfs_queue.thread, NULL, runTwfsQueue, NULL ) != 0 )
+	{
+		close( twfs_queue.fd );
+		twfs_queue.fd = -1;
+		return( -1 );
+	}
+
+	twfs_queue.running = true;
+
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsQueue
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:stop sending mutations. mutations not sent yet are kept in
+				 the journal for next mount
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsQueue( void )
+{
+	struct twfs_mutation	*mutation;
+
+	if( !twfs_queue.running )
+	{
+		return;
+	}
+
+	pthread_mutex_lock( &twfs_queue.lock );
+	twfs_queue.stop = true;
+	pthread_cond_broadcast( &twfs_queue.cond );
+	pthread_mutex_unlock( &twfs_queue.lock );
+
+	pthread_join( twfs_queue.thread, NULL );
+
+	while( ( mutation = twfs_queue.head ) != NULL )
+	{
+		twfs_queue.head = mutation->next;
+		free( mutation );
+	}
+
+	twfs_queue.tail = NULL;
+
+	fsync( twfs_queue.fd );
+	close( twfs_queue.fd );
+
+	twfs_queue.fd		= -1;
+	twfs_queue.running	= false;
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:queueTwfsMutation
+	Input		:E_TWFS_MUT mut
+				 < mutation >
+				 const char *arg1
+				 < first argument of operation, NULL:none >
+				 const char *arg2
+				 < second argument of operation, NULL:none >
+				 const char *arg3
+				 < third argument of operation, NULL:none >
+				 const char *msg
+				 < message of tweet or direct message, NULL:none >
+				 int size
+				 < size of message >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:journal a mutation and queue it to be sent in order
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int queueTwfsMutation( E_TWFS_MUT mut,
+					   const char *arg1,
+					   const char *arg2,
+					   const char *arg3,
+					   const char *msg,
+					   int size )
+{
+	struct twfs_mutation	*mutation;
+	char					*record;
+	int						len;
+
+	if( !twfs_queue.running )
+	{
+		return( -1 );
+	}
+
+	if( !( mutation = allocTwfsMutation( mut, arg1, arg2, arg3, msg, size ) ) )
+	{
+		return( -1 );
+	}
+
+	if( !( record = malloc( DEF_TWFS_QUEUE_RECORD_LEN + mutation->size + 1 ) ) )
+	{
+		free( mutation );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* records are appended in order of sequence, so journal under the lock		*/
+	/* ------------------------------------------------------------------------ */
+	pthread_mutex_lock( &twfs_queue.lock );
+
+	mutation->seq = twfs_queue.next_seq;
+
+	len = snprintf( record, DEF_TWFS_QUEUE_RECORD_LEN,
+					"+ %lu %s %s %s %s %d\n",
+					mutation->seq,
+					twfs_mut_names[ mut ],
+					mutation->arg[ 0 ],
+					mutation->arg[ 1 ],
+					mutation->arg[ 2 ],
+					mutation->size );
+
+	memcpy( &record[ len ], mutation->msg, mutation->size );
+	len += mutation->size;
+	record[ len++ ] = '\n';
+
+	if( appendTwfsJournal( record, len, true ) < 0 )
+	{
+		pthread_mutex_unlock( &twfs_queue.lock );
+		free( record );
+		free( mutation );
+		return( -1 );
+	}
+
+	twfs_queue.next_seq++;
+
+	pushTwfsMutation( mutation );
+	pthread_cond_signal( &twfs_queue.cond );
+
+	pthread_mutex_unlock( &twfs_queue.lock );
+
+	free( record );
+
+	return( 0 );
+}
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+==================================================================================
+	Function	:runTwfsQueue
+	Input		:void *arg
+				 < not used >
+	Output		:void
+	Return		:void*
+				 < NULL >
+	Description	:send queued mutations in order. a failed mutation is retried
+				 before next one, so they reach twitter in order. a mutation
+				 refused by twitter is dropped at once. members of a list
+				 queued in a row are sent at once
+==================================================================================
+*/
+static void* runTwfsQueue( void *arg )
+{
+	int						result;
+	int						len;
+	int						interval;
+	int						count;
+	int						status_code;
+	int						i;
+	bool					rejected;
+	char					record[ DEF_TWFS_QUEUE_RECORD_LEN ];
+	char					names[ DEF_TWFS_QUEUE_BATCH_LEN ];
+	struct timespec			until;
+	struct ssl_session		*session;
+	struct twfs_mutation	*mutation;
+
+	pthread_mutex_lock( &twfs_queue.lock );
+
+	while( !twfs_queue.stop )
+	{
+		/* -------------------------------------------------------------------- */
+		/* wait for a mutation, and for its retry time if it failed				*/
+		/* -------------------------------------------------------------------- */
+		if( !( mutation = twfs_queue.head ) )
+		{
+			pthread_cond_wait( &twfs_queue.cond, &twfs_queue.lock );
+			continue;
+		}
+
+		if( time( NULL ) < mutation->next_try )
+		{
+			until.tv_sec	= mutation->next_try;
+			until.tv_nsec	= 0;
+			pthread_cond_timedwait( &twfs_queue.cond, &twfs_queue.lock, &until );
+			continue;
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* give members of a list following the first one a moment to arrive	*/
+		/* -------------------------------------------------------------------- */
+		count = getTwfsBatch( mutation, names );
+
+		if( ( 0 < count ) && ( mutation->attempts == 0 ) &&
+			( count < DEF_REST_LISTS_MEMS_ALL_MAX_USERS ) &&
+			( time( NULL ) < mutation->queued + DEF_TWFS_QUEUE_BATCH_WINDOW ) )
+		{
+			until.tv_sec	= mutation->queued + DEF_TWFS_QUEUE_BATCH_WINDOW;
+			until.tv_nsec	= 0;
+			pthread_cond_timedwait( &twfs_queue.cond, &twfs_queue.lock, &until );
+			continue;
+		}
+
+		pthread_mutex_unlock( &twfs_queue.lock );
+
+		session = getCurrentSSLSession( );
+
+		lockSSLSession( session );
+
+		session->status_code = 0;
+
+		if( 1 < count )
+		{
+			result = sendTwfsBatch( session, mutation, names );
+		}
+		else
+		{
+			result = sendTwfsMutation( session, mutation );
+		}
+
+		status_code = session->status_code;
+
+		unlockSSLSession( session );
+
+		pthread_mutex_lock( &twfs_queue.lock );
+
+		/* -------------------------------------------------------------------- */
+		/* a failed batch is sent again one by one not to fail all of members	*/
+		/* by one of them														*/
+		/* -------------------------------------------------------------------- */
+		if( ( result < 0 ) && ( 1 < count ) )
+		{
+			logMessage( "batch of %s(%lu) failed\n",
+						twfs_mut_names[ mutation->mut ], mutation->seq );
+			mutation->single = true;
+			continue;
+		}
+
+		mutation->attempts++;
+
+		/* -------------------------------------------------------------------- */
+		/* twitter refuses the mutation itself, it fails again however retried	*/
+		/* -------------------------------------------------------------------- */
+		rejected = ( result < 0 ) && !isTwfsRetryable( status_code );
+
+		if( ( result < 0 ) && !rejected &&
+			( mutation->attempts < DEF_TWFS_QUEUE_MAX_ATTEMPTS ) )
+		{
+			interval = DEF_TWFS_QUEUE_RETRY_MIN << ( mutation->attempts - 1 );
+
+			if( DEF_TWFS_QUEUE_RETRY_MAX < interval )
+			{
+				interval = DEF_TWFS_QUEUE_RETRY_MAX;
+			}
+
+			mutation->next_try = time( NULL ) + interval;
+
+			len = snprintf( record, sizeof( record ), "! %lu %d\n",
+							mutation->seq, mutation->attempts );
+			appendTwfsJournal( record, len, false );
+
+			logMessage( "retry %s(%lu) after %d sec\n",
+						twfs_mut_names[ mutation->mut ], mutation->seq, interval );
+			continue;
+		}
+
+		if( result < 0 )
+		{
+			logMessage( "%s %s(%lu) %s %s %s:%d\n",
+						rejected ? "reject" : "give up",
+						twfs_mut_names[ mutation->mut ],
+						mutation->seq,
+						mutation->arg[ 0 ],
+						mutation->arg[ 1 ],
+						mutation->arg[ 2 ],
+						status_code );
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* members of a batch are at the head since only this thread removes	*/
+		/* -------------------------------------------------------------------- */
+		if( count < 1 )
+		{
+			count = 1;
+		}
+
+		for( i = 0 ; i < count ; i++ )
+		{
+			mutation = twfs_queue.head;
+
+			len = snprintf( record, sizeof( record ), "- %lu %s\n",
+							mutation->seq,
+							( 0 <= result ) ? "done" :
+							rejected ? "rejected" : "failed" );
+			appendTwfsJournal( record, len, false );
+
+			twfs_queue.head = mutation->next;
+
+			free( mutation );
+		}
+
+		/* -------------------------------------------------------------------- */
+		/* every mutation in journal is finished, start it over					*/
+		/* -------------------------------------------------------------------- */
+		if( !twfs_queue.head )
+		{
+			twfs_queue.tail = NULL;
+
+			if( ftruncate( twfs_queue.fd, 0 ) < 0 )
+			{
+				logMessage( "cannot truncate journal:%d\n", errno );
+			}
+		}
+	}
+
+	pthread_mutex_unlock( &twfs_queue.lock );
+
+	return( NULL );
+}
+
+/*
+==================================================================================
+	Function	:getTwfsBatch
+	Input		:const struct twfs_mutation *mutation
+				 < mutation at the head of queue >
+				 char *names
+				 < buffer of DEF_TWFS_QUEUE_BATCH_LEN bytes >
+	Output		:char *names
+				 < screen names of the batch separated by comma >
+	Return		:int
+				 < number of mutations in the batch, 0:not to be batched >
+	Description	:gather members of a list queued in a row after a mutation.
+				 caller holds the queue lock
+==================================================================================
+*/
+static int getTwfsBatch( const struct twfs_mutation *mutation, char *names )
+{
+	const struct twfs_mutation	*next;
+	int							count;
+	int							len;
+	int							name_len;
+
+	if( ( ( mutation->mut != E_TWFS_MUT_ADD_MEMBER ) &&
+		  ( mutation->mut != E_TWFS_MUT_REMOVE_MEMBER ) ) ||
+		mutation->single )
+	{
+		return( 0 );
+	}
+
+	count	= 0;
+	len		= 0;
+
+	for( next = mutation ; next ; next = next->next )
+	{
+		if( ( next->mut != mutation->mut ) || next->single ||
+			( strcmp( next->arg[ 0 ], mutation->arg[ 0 ] ) != 0 ) ||
+			( strcmp( next->arg[ 1 ], mutation->arg[ 1 ] ) != 0 ) )
+		{
+			break;
+		}
+
+		if( DEF_REST_LISTS_MEMS_ALL_MAX_USERS <= count )
+		{
+			break;
+		}
+
+		/* names are percent encoded twice in oauth signature, so a comma	*/
+		/* costs 5 bytes there. keep the signature in its buffer			*/
+		name_len = strlen( next->arg[ 2 ] );
+
+		if( DEF_TWFS_QUEUE_BATCH_LEN <= ( len + name_len + 5 ) )
+		{
+			break;
+		}
+
+		if( count )
+		{
+			names[ len++ ] = ',';
+		}
+
+		memcpy( &names[ len ], next->arg[ 2 ], name_len );
+		len += name_len;
+
+		count++;
+	}
+
+	names[ len ] = '\0';
+
+	return( count );
+}
+
+/*
+==================================================================================
+	Function	:sendTwfsBatch
+	Input		:struct ssl_session *session
+				 < ssl session held by caller >
+				 const struct twfs_mutation *mutation
+				 < first mutation of the batch >
+				 const char *names
+				 < screen names of the batch separated by comma >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:add or remove members of a list at once
+==================================================================================
+*/
+static int sendTwfsBatch( struct ssl_session *session,
+						  const struct twfs_mutation *mutation,
+						  const char *names )
+{
+	switch( mutation->mut )
+	{
+	case	E_TWFS_MUT_ADD_MEMBER:
+		return( createAllListsMembers( session,
+									   mutation->arg[ 0 ],
+									   mutation->arg[ 1 ],
+									   names ) );
+	case	E_TWFS_MUT_REMOVE_MEMBER:
+		return( destroyAllListsMembers( session,
+										mutation->arg[ 0 ],
+										mutation->arg[ 1 ],
+										names ) );
+	default:
+		break;
+	}
+
+	return( -1 );
+}
+
+/*
+==================================================================================
+	Function	:sendTwfsMutation
+	Input		:struct ssl_session *session
+				 < ssl session held by caller >
+				 const struct twfs_mutation *mutation
+				 < mutation to send >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:call twitter operation of a mutation
+==================================================================================
+*/
+static int sendTwfsMutation( struct ssl_session *session,
+							 const struct twfs_mutation *mutation )
+{
+	const char		*arg1;
+	const char		*arg2;
+	const char		*arg3;
+
+	arg1 = mutation->arg[ 0 ];
+	arg2 = mutation->arg[ 1 ];
+	arg3 = mutation->arg[ 2 ];
+
+	switch( mutation->mut )
+	{
+	case	E_TWFS_MUT_TWEET:
+		return( tweetTwapi( session, mutation->msg, mutation->size ) );
+	case	E_TWFS_MUT_DM:
+		return( sendDirectMessage( session,
+								   arg1,
+								   mutation->msg,
+								   mutation->size ) );
+	case	E_TWFS_MUT_REMOVE_TWEET:
+		return( removeTweet( session, arg1 ) );
+	case	E_TWFS_MUT_REMOVE_DM:
+		return( removeDirectMessage( session, arg1 ) );
+	case	E_TWFS_MUT_FOLLOW:
+		return( requestFollow( session, arg1 ) );
+	case	E_TWFS_MUT_UNFOLLOW:
+		return( requestUnfollow( session, arg1 ) );
+	case	E_TWFS_MUT_FAVORITE:
+		return( requestFavorite( session, arg1 ) );
+	case	E_TWFS_MUT_UNFAVORITE:
+		return( requestUnFavorite( session, arg1 ) );
+	case	E_TWFS_MUT_BLOCK:
+		return( requestBlock( session, arg1 ) );
+	case	E_TWFS_MUT_UNBLOCK:
+		return( requestUnblock( session, arg1 ) );
+	case	E_TWFS_MUT_ADD_MEMBER:
+		return( createListsMembers( session, arg1, arg2, arg3 ) );
+	case	E_TWFS_MUT_REMOVE_MEMBER:
+		return( destroyListsMembers( session, arg1, arg2, arg3 ) );
+	case	E_TWFS_MUT_SUBSCRIBE:
+		return( subscribeLists( session, arg1, arg2 ) );
+	case	E_TWFS_MUT_UNSUBSCRIBE:
+		return( stopSubscribeLists( session, arg1, arg2 ) );
+	case	E_TWFS_MUT_DELETE_LISTS:
+		return( deleteLists( session, arg1, arg2 ) );
+	default:
+		break;
+	}
+
+	return( -1 );
+}
+
+/*
+==================================================================================
+	Function	:isTwfsRetryable
+	Input		:int status_code
+				 < http status of a failed mutation, 0:no response >
+	Output		:void
+	Return		:bool
+				 < true:may succeed when it is sent again >
+	Description	:errors of transport, rate limit and server are retried.
+				 other client errors are refused by twitter for good
+==================================================================================
+*/
+static bool isTwfsRetryable( int status_code )
+{
+	if( ( status_code < DEF_HTTPH_STATUS_BAD_REQUEST ) ||
+		( DEF_HTTPH_STATUS_INTERNAL_SERV_ERR <= status_code ) )
+	{
+		return( true );
+	}
+
+	return( ( status_code == DEF_HTTPH_STATUS_TOO_MANY_REQUESTS ) ||
+			( status_code == DEF_HTTPH_STATUS_REQUEST_TIMEOUT ) );
+}
+
+/*
+==================================================================================
+	Function	:replayTwfsJournal
+	Input		:void
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:queue mutations which are not finished in the journal.
+				 a record torn by a crash and the records after it are cut off
+==================================================================================
+*/
+static int replayTwfsJournal( void )
+{
+	struct stat				statbuf;
+	char					*buf;
+	char					*p;
+	char					*end;
+	char					*nl;
+	char					op[ 16 ];
+	char					arg[ 3 ][ DEF_TWFS_QUEUE_ARG_LEN ];
+	char					format[ 64 ];
+	unsigned long			seq;
+	int						attempts;
+	int						size;
+	E_TWFS_MUT				mut;
+	struct twfs_mutation	*mutation;
+	struct twfs_mutation	**link;
+
+	if( fstat( twfs_queue.fd, &statbuf ) < 0 )
+	{
+		return( -1 );
+	}
+
+	if( statbuf.st_size == 0 )
+	{
+		return( 0 );
+	}
+
+	if( !( buf = malloc( statbuf.st_size + 1 ) ) )
+	{
+		return( -1 );
+	}
+
+	if( preadFile( twfs_queue.fd, buf, statbuf.st_size, 0 ) != statbuf.st_size )
+	{
+		free( buf );
+		return( -1 );
+	}
+
+	buf[ statbuf.st_size ] = '\0';
+
+	snprintf( format, sizeof( format ), "+ %%lu %%15s %%%ds %%%ds %%%ds %%d",
+			  DEF_TWFS_QUEUE_ARG_LEN - 1,
+			  DEF_TWFS_QUEUE_ARG_LEN - 1,
+			  DEF_TWFS_QUEUE_ARG_LEN - 1 );
+
+	p	= buf;
+	end	= buf + statbuf.st_size;
+
+	while( ( p < end ) && ( nl = memchr( p, '\n', end - p ) ) )
+	{
+		*nl = '\0';
+
+		switch( *p )
+		{
+		case	'+':
+			if( sscanf( p, format, &seq, op, arg[ 0 ], arg[ 1 ], arg[ 2 ], &size )
+				!= 6 )
+			{
+				goto torn;
+			}
+
+			/* message and its new line follow the record					*/
+			if( ( size < 0 ) || ( end - ( nl + 1 ) < size + 1 ) ||
+				( nl[ 1 + size ] != '\n' ) )
+			{
+				goto torn;
+			}
+
+			if( ( mut = getTwfsMutationType( op ) ) == E_TWFS_MUT_NUM )
+			{
+				goto torn;
+			}
+
+			mutation = allocTwfsMutation( mut,
+										  arg[ 0 ], arg[ 1 ], arg[ 2 ],
+										  nl + 1, size );
+			if( !mutation )
+			{
+				free( buf );
+				return( -1 );
+			}
+
+			mutation->seq = seq;
+			pushTwfsMutation( mutation );
+
+			if( twfs_queue.next_seq <= seq )
+			{
+				twfs_queue.next_seq = seq + 1;
+			}
+
+			nl += 1 + size;
+			break;
+		case	'!':
+			if( sscanf( p, "! %lu %d", &seq, &attempts ) != 2 )
+			{
+				goto torn;
+			}
+
+			for( mutation = twfs_queue.head ; mutation ; mutation = mutation->next )
+			{
+				if( mutation->seq == seq )
+				{
+					mutation->attempts = attempts;
+				}
+			}
+			break;
+		case	'-':
+			if( sscanf( p, "- %lu", &seq ) != 1 )
+			{
+				goto torn;
+			}
+
+			for( link = &twfs_queue.head ; *link ; link = &( *link )->next )
+			{
+				if( ( *link )->seq == seq )
+				{
+					mutation	= *link;
+					*link		= mutation->next;
+					free( mutation );
+					break;
+				}
+			}
+			break;
+		default:
+			goto torn;
+		}
+
+		p = nl + 1;
+	}
+
+torn:
+	/* ------------------------------------------------------------------------ */
+	/* new records are appended right after the last complete one				*/
+	/* ------------------------------------------------------------------------ */
+	twfs_queue.tail = NULL;
+
+	for( mutation = twfs_queue.head ; mutation ; mutation = mutation->next )
+	{
+		twfs_queue.tail = mutation;
+	}
+
+	if( p < end )
+	{
+		logMessage( "journal is torn at %ld\n", ( long )( p - buf ) );
+
+		if( ftruncate( twfs_queue.fd, p - buf ) < 0 )
+		{
+			free( buf );
+			return( -1 );
+		}
+	}
+
+	free( buf );
+
+	lseek( twfs_queue.fd, 0, SEEK_END );
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:appendTwfsJournal
+	Input		:const char *record
+				 < record to append >
+				 size_t size
+				 < size of record >
+				 bool sync
+				 < true:wait until the record is on disk >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:append a record to the journal. caller holds the queue lock
+==================================================================================
+*/
+static int appendTwfsJournal( const char *record, size_t size, bool sync )
+{
+	int		result;
+	off_t	offset;
+
+	offset = lseek( twfs_queue.fd, 0, SEEK_END );
+
+	while( 0 < size )
+	{
+		if( ( result = pwriteFile( twfs_queue.fd, record, size, offset ) ) < 0 )
+		{
+			logMessage( "cannot write journal:%d\n", errno );
+			return( -1 );
+		}
+
+		record	+= result;
+		size	-= result;
+		offset	+= result;
+	}
+
+	if( sync && ( fdatasync( twfs_queue.fd ) < 0 ) )
+	{
+		logMessage( "cannot sync journal:%d\n", errno );
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+==================================================================================
+	Function	:allocTwfsMutation
+	Input		:E_TWFS_MUT mut
+				 < mutation >
+				 const char *arg1
+				 < first argument of operation, NULL:none >
+				 const char *arg2
+				 < second argument of operation, NULL:none >
+				 const char *arg3
+				 < third argument of operation, NULL:none >
+				 const char *msg
+				 < message of tweet or direct message, NULL:none >
+				 int size
+				 < size of message >
+	Output		:void
+	Return		:struct twfs_mutation*
+				 < mutation, NULL:invalid argument or no memory >
+	Description	:allocate a mutation
+==================================================================================
+*/
+static struct twfs_mutation* allocTwfsMutation( E_TWFS_MUT mut,
+												const char *arg1,
+												const char *arg2,
+												const char *arg3,
+												const char *msg,
+												int size )
+{
+	struct twfs_mutation	*mutation;
+	const char				*args[ 3 ];
+	int						i;
+
+	if( ( mut < 0 ) || ( E_TWFS_MUT_NUM <= mut ) )
+	{
+		return( NULL );
+	}
+
+	if( !msg || ( size < 0 ) )
+	{
+		size = 0;
+	}
+
+	if( !( mutation = malloc( sizeof( struct twfs_mutation ) + size + 1 ) ) )
+	{
+		return( NULL );
+	}
+
+	args[ 0 ] = arg1;
+	args[ 1 ] = arg2;
+	args[ 2 ] = arg3;
+
+	/* ------------------------------------------------------------------------ */
+	/* arguments are names and ids, which are written to journal as words		*/
+	/* ------------------------------------------------------------------------ */
+	for( i = 0 ; i < 3 ; i++ )
+	{
+		if( !args[ i ] || ( args[ i ][ 0 ] == '\0' ) )
+		{
+			args[ i ] = DEF_TWFS_QUEUE_NO_ARG;
+		}
+
+		if( ( DEF_TWFS_QUEUE_ARG_LEN <= strlen( args[ i ] ) ) ||
+			strpbrk( args[ i ], " \t\n" ) )
+		{
+			free( mutation );
+			return( NULL );
+		}
+
+		strcpy( mutation->arg[ i ], args[ i ] );
+	}
+
+	mutation->next		= NULL;
+	mutation->seq		= 0;
+	mutation->mut		= mut;
+	mutation->attempts	= 0;
+	mutation->queued	= time( NULL );
+	mutation->next_try	= 0;
+	mutation->single	= false;
+	mutation->size		= size;
+
+	if( size )
+	{
+		memcpy( mutation->msg, msg, size );
+	}
+
+	mutation->msg[ size ] = '\0';
+
+	return( mutation );
+}
+
+/*
+==================================================================================
+	Function	:pushTwfsMutation
+	Input		:struct twfs_mutation *mutation
+				 < mutation to queue >
+	Output		:void
+	Return		:void
+	Description	:put a mutation at the tail of queue. caller holds the lock
+==================================================================================
+*/
+static void pushTwfsMutation( struct twfs_mutation *mutation )
+{
+	mutation->next = NULL;
+
+	if( twfs_queue.tail )
+	{
+		twfs_queue.tail->next = mutation;
+	}
+	else
+	{
+		twfs_queue.head = mutation;
+	}
+
+	twfs_queue.tail = mutation;
+}
+
+/*
+==================================================================================
+	Function	:getTwfsMutationType
+	Input		:const char *name
+				 < name of mutation in journal >
+	Output		:void
+	Return		:E_TWFS_MUT
+				 < mutation, E_TWFS_MUT_NUM:unknown >
+	Description	:get mutation from its name
+==================================================================================
+*/
+static E_TWFS_MUT getTwfsMutationType( const char *name )
+{
+	int		i;
+
+	for( i = 0 ; i < E_TWFS_MUT_NUM ; i++ )
+	{
+		if( strcmp( twfs_mut_names[ i ], name ) == 0 )
+		{
+			return( ( E_TWFS_MUT )i );
+		}
+	}
+
+	return( E_TWFS_MUT_NUM );
+}
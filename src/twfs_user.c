@@ -0,0 +1,632 @@
+/*******************************************************************************
+ File:twfs_user.c
+ Description:Dictionary of twitter users
+
+ dictionary is a file of fixed records which is mapped while twfs is mounted.
+	[ head ][ record 0 ][ record 1 ] ... [ record capacity - 1 ]
+ records are chained by hashes of user id and screen name. a renamed user keeps
+ its record and only screen name of the record is rewritten.
+*******************************************************************************/
+#define	_GNU_SOURCE		// mremap
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "twfs.h"
+#include "twfs_user.h"
+#include "lib/log.h"
+#include "lib/utils.h"
+#include "net/twitter_api.h"
+
+/*
+================================================================================
+
+	Prototype Statements
+
+================================================================================
+*/
+static int mapTwfsUserDict( size_t capacity );
+static int growTwfsUserDict( void );
+static int findTwfsUserById( const char *user_id );
+static int findTwfsUserByName( const char *screen_name );
+static void linkTwfsUserName( int index );
+static void unlinkTwfsUserName( int index );
+static unsigned int hashTwfsUserKey( const char *key );
+
+/*
+================================================================================
+
+	DEFINES
+
+================================================================================
+*/
+#define	DEF_TWFS_DICT_MAGIC				"twfsusr1"
+#define	DEF_TWFS_DICT_MAGIC_LEN			8
+#define	DEF_TWFS_DICT_GROW				4096	// records added at once
+#define	DEF_TWFS_DICT_HASH_SIZE			16384	// must be power of 2
+#define	DEF_TWFS_DICT_NONE				-1		// end of hash chain
+
+/* head of dictionary file														*/
+struct twfs_dict_head
+{
+	char		magic[ DEF_TWFS_DICT_MAGIC_LEN ];
+	uint32_t	count;			// records in use
+	uint32_t	capacity;		// records the file can hold
+};
+
+/* record of a user																*/
+struct twfs_dict_rec
+{
+	char		id[ DEF_TWFS_ID_FIELD + 1 ];
+	char		sname[ DEF_TWFS_SNAME_FIELD + 1 ];
+};
+
+struct twfs_dict
+{
+	pthread_mutex_t			lock;		// protects all members below
+	int						fd;
+	struct twfs_dict_head	*head;		// mapping of whole file, NULL:closed
+	struct twfs_dict_rec	*recs;
+	size_t					len;
+	int32_t					*id_next;	// chains of hashes, by record
+	int32_t					*sname_next;
+	int32_t					id_hash[ DEF_TWFS_DICT_HASH_SIZE ];
+	int32_t					sname_hash[ DEF_TWFS_DICT_HASH_SIZE ];
+};
+
+/*
+================================================================================
+
+	Management
+
+================================================================================
+*/
+static struct twfs_dict twfs_dict =
+{
+	.lock	= PTHREAD_MUTEX_INITIALIZER,
+	.fd		= -1,
+};
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Open Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwfsUserDict
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:map dictionary of users and hash users in it
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwfsUserDict( const char *root_path )
+{
+	struct stat	statbuf;
+	char		path[ DEF_TWFS_PATH_MAX ];
+	size_t		capacity;
+	uint32_t	count;
+	int			i;
+
+	pthread_mutex_lock( &twfs_dict.lock );
+
+	if( twfs_dict.head )
+	{
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( 0 );
+	}
+
+	snprintf( path, sizeof( path ), "%s/%s", root_path, DEF_TWFS_USER_FILE );
+
+	if( ( twfs_dict.fd = openFile( path, O_RDWR | O_CREAT, 0644 ) ) < 0 )
+	{
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( -1 );
+	}
+
+	if( fstat( twfs_dict.fd, &statbuf ) < 0 )
+	{
+		close( twfs_dict.fd );
+		twfs_dict.fd = -1;
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* capacity is taken from size of file, head is checked after mapping		*/
+	/* ------------------------------------------------------------------------ */
+	capacity = 0;
+
+	if( sizeof( struct twfs_dict_head ) <= ( size_t )statbuf.st_size )
+	{
+		capacity = ( statbuf.st_size - sizeof( struct twfs_dict_head ) )
+				   / sizeof( struct twfs_dict_rec );
+	}
+
+	if( capacity == 0 )
+	{
+		capacity = DEF_TWFS_DICT_GROW;
+	}
+
+	if( mapTwfsUserDict( capacity ) < 0 )
+	{
+		close( twfs_dict.fd );
+		twfs_dict.fd = -1;
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* a file which is not a dictionary is started again						*/
+	/* ------------------------------------------------------------------------ */
+	if( ( memcmp( twfs_dict.head->magic,
+				  DEF_TWFS_DICT_MAGIC,
+				  DEF_TWFS_DICT_MAGIC_LEN ) != 0 ) ||
+		( twfs_dict.head->capacity != capacity ) ||
+		( capacity < twfs_dict.head->count ) )
+	{
+		if( twfs_dict.head->magic[ 0 ] != '\0' )
+		{
+			logMessage( "dictionary of users is broken:%s\n", path );
+		}
+
+		memset( twfs_dict.head, 0x00, twfs_dict.len );
+		memcpy( twfs_dict.head->magic,
+				DEF_TWFS_DICT_MAGIC,
+				DEF_TWFS_DICT_MAGIC_LEN );
+		twfs_dict.head->count		= 0;
+		twfs_dict.head->capacity	= capacity;
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* hash users. a screen name taken over by another user finds the newer		*/
+	/* ------------------------------------------------------------------------ */
+	for( i = 0 ; i < DEF_TWFS_DICT_HASH_SIZE ; i++ )
+	{
+		twfs_dict.id_hash[ i ]		= DEF_TWFS_DICT_NONE;
+		twfs_dict.sname_hash[ i ]	= DEF_TWFS_DICT_NONE;
+	}
+
+	count = twfs_dict.head->count;
+
+	for( i = 0 ; i < ( int )count ; i++ )
+	{
+		unsigned int	hash;
+
+		twfs_dict.recs[ i ].id[ DEF_TWFS_ID_FIELD ]			= '\0';
+		twfs_dict.recs[ i ].sname[ DEF_TWFS_SNAME_FIELD ]	= '\0';
+
+		hash = hashTwfsUserKey( twfs_dict.recs[ i ].id );
+		twfs_dict.id_next[ i ]		= twfs_dict.id_hash[ hash ];
+		twfs_dict.id_hash[ hash ]	= i;
+
+		linkTwfsUserName( i );
+	}
+
+	logMessage( "users in dictionary:%u\n", count );
+
+	pthread_mutex_unlock( &twfs_dict.lock );
+
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwfsUserDict
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:unmap dictionary of users
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwfsUserDict( void )
+{
+	pthread_mutex_lock( &twfs_dict.lock );
+
+	if( twfs_dict.head )
+	{
+		munmap( twfs_dict.head, twfs_dict.len );
+		close( twfs_dict.fd );
+	}
+
+	free( twfs_dict.id_next );
+	free( twfs_dict.sname_next );
+
+	twfs_dict.head			= NULL;
+	twfs_dict.recs			= NULL;
+	twfs_dict.len			= 0;
+	twfs_dict.id_next		= NULL;
+	twfs_dict.sname_next	= NULL;
+	twfs_dict.fd			= -1;
+
+	pthread_mutex_unlock( &twfs_dict.lock );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:internTwfsUser
+	Input		:const char *user_id
+				 < user id >
+				 const char *screen_name
+				 < current screen name of the user >
+				 char *old_sname
+				 < buffer of DEF_TWAPI_MAX_SCREEN_NAME_LEN >
+	Output		:char *old_sname
+				 < previous screen name if the user is renamed, or empty >
+	Return		:int
+				 < status >
+	Description	:look up a user by user id, adding the user if it is not
+				 known yet, and follow a change of its screen name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int internTwfsUser( const char *user_id,
+					const char *screen_name,
+					char *old_sname )
+{
+	struct twfs_dict_rec	*rec;
+	unsigned int			hash;
+	int						index;
+
+	old_sname[ 0 ] = '\0';
+
+	if( ( DEF_TWFS_ID_FIELD < strlen( user_id ) ) ||
+		( DEF_TWFS_SNAME_FIELD < strlen( screen_name ) ) )
+	{
+		return( -1 );
+	}
+
+	pthread_mutex_lock( &twfs_dict.lock );
+
+	if( !twfs_dict.head )
+	{
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( -1 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* known user, whose screen name may have been changed						*/
+	/* ------------------------------------------------------------------------ */
+	if( 0 <= ( index = findTwfsUserById( user_id ) ) )
+	{
+		rec = &twfs_dict.recs[ index ];
+
+		if( strcmp( rec->sname, screen_name ) != 0 )
+		{
+			snprintf( old_sname, DEF_TWAPI_MAX_SCREEN_NAME_LEN,
+					  "%s", rec->sname );
+
+			unlinkTwfsUserName( index );
+			memset( rec->sname, 0x00, sizeof( rec->sname ) );
+			memcpy( rec->sname, screen_name, strlen( screen_name ) );
+			linkTwfsUserName( index );
+
+			logMessage( "user %s is renamed:%s -> %s\n",
+						user_id, old_sname, screen_name );
+		}
+
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( 0 );
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* new user is added at end of records										*/
+	/* ------------------------------------------------------------------------ */
+	if( twfs_dict.head->count == twfs_dict.head->capacity )
+	{
+		if( growTwfsUserDict( ) < 0 )
+		{
+			pthread_mutex_unlock( &twfs_dict.lock );
+			return( -1 );
+		}
+	}
+
+	index	= twfs_dict.head->count;
+	rec		= &twfs_dict.recs[ index ];
+
+	memset( rec, 0x00, sizeof( struct twfs_dict_rec ) );
+	memcpy( rec->id, user_id, strlen( user_id ) );
+	memcpy( rec->sname, screen_name, strlen( screen_name ) );
+
+	hash = hashTwfsUserKey( rec->id );
+	twfs_dict.id_next[ index ]	= twfs_dict.id_hash[ hash ];
+	twfs_dict.id_hash[ hash ]	= index;
+
+	linkTwfsUserName( index );
+
+	/* record is filled before it is counted									*/
+	twfs_dict.head->count++;
+
+	pthread_mutex_unlock( &twfs_dict.lock );
+
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:getTwfsUserId
+	Input		:const char *screen_name
+				 < screen name >
+				 char *user_id
+				 < buffer of DEF_TWFS_ID_FIELD + 1 >
+	Output		:char *user_id
+				 < id of the user who has the screen name now >
+	Return		:int
+				 < status, -1:not known >
+	Description	:get id of a user by current screen name
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int getTwfsUserId( const char *screen_name, char *user_id )
+{
+	int		index;
+
+	pthread_mutex_lock( &twfs_dict.lock );
+
+	if( !twfs_dict.head ||
+		( ( index = findTwfsUserByName( screen_name ) ) < 0 ) )
+	{
+		pthread_mutex_unlock( &twfs_dict.lock );
+		return( -1 );
+	}
+
+	memcpy( user_id, twfs_dict.recs[ index ].id, DEF_TWFS_ID_FIELD + 1 );
+
+	pthread_mutex_unlock( &twfs_dict.lock );
+
+	return( 0 );
+}
+
+/*
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+	< Local Functions >
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+*/
+/*
+================================================================================
+	Function	:mapTwfsUserDict
+	Input		:size_t capacity
+				 < records the file holds >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:size dictionary file to the capacity and map it. chains of
+				 hashes are sized to the capacity as well. caller must hold
+				 twfs_dict.lock
+================================================================================
+*/
+static int mapTwfsUserDict( size_t capacity )
+{
+	void		*addr;
+	int32_t		*id_next;
+	int32_t		*sname_next;
+	size_t		len;
+
+	len = sizeof( struct twfs_dict_head )
+		  + capacity * sizeof( struct twfs_dict_rec );
+
+	if( ftruncate( twfs_dict.fd, len ) < 0 )
+	{
+		logMessage( "cannot size dictionary of users:%s\n", strerror( errno ) );
+		return( -1 );
+	}
+
+	if( !twfs_dict.head )
+	{
+		addr = mmap( NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED,
+					 twfs_dict.fd, 0 );
+	}
+	else
+	{
+		addr = mremap( twfs_dict.head, twfs_dict.len, len, MREMAP_MAYMOVE );
+	}
+
+	if( addr == MAP_FAILED )
+	{
+		logMessage( "cannot map dictionary of users:%s\n", strerror( errno ) );
+		return( -1 );
+	}
+
+	twfs_dict.head	= addr;
+	twfs_dict.recs	= ( struct twfs_dict_rec* )( twfs_dict.head + 1 );
+	twfs_dict.len	= len;
+
+	id_next		= realloc( twfs_dict.id_next, capacity * sizeof( int32_t ) );
+
+	if( id_next )
+	{
+		twfs_dict.id_next = id_next;
+	}
+
+	sname_next	= realloc( twfs_dict.sname_next, capacity * sizeof( int32_t ) );
+
+	if( sname_next )
+	{
+		twfs_dict.sname_next = sname_next;
+	}
+
+	if( !id_next || !sname_next )
+	{
+		return( -1 );
+	}
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:growTwfsUserDict
+	Input		:void
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:make room for more users. caller must hold twfs_dict.lock
+================================================================================
+*/
+static int growTwfsUserDict( void )
+{
+	size_t	capacity;
+
+	capacity = twfs_dict.head->capacity + DEF_TWFS_DICT_GROW;
+
+	if( INT32_MAX < capacity )
+	{
+		return( -1 );
+	}
+
+	if( mapTwfsUserDict( capacity ) < 0 )
+	{
+		return( -1 );
+	}
+
+	twfs_dict.head->capacity = capacity;
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:findTwfsUserById
+	Input		:const char *user_id
+				 < user id >
+	Output		:void
+	Return		:int
+				 < index of the user, -1:not known >
+	Description	:find a user by id. caller must hold twfs_dict.lock
+================================================================================
+*/
+static int findTwfsUserById( const char *user_id )
+{
+	int		index;
+
+	for( index = twfs_dict.id_hash[ hashTwfsUserKey( user_id ) ] ;
+		 index != DEF_TWFS_DICT_NONE ;
+		 index = twfs_dict.id_next[ index ] )
+	{
+		if( strcmp( twfs_dict.recs[ index ].id, user_id ) == 0 )
+		{
+			return( index );
+		}
+	}
+
+	return( -1 );
+}
+
+/*
+================================================================================
+	Function	:findTwfsUserByName
+	Input		:const char *screen_name
+				 < screen name >
+	Output		:void
+	Return		:int
+				 < index of the user, -1:not known >
+	Description	:find a user by screen name. caller must hold twfs_dict.lock
+================================================================================
+*/
+static int findTwfsUserByName( const char *screen_name )
+{
+	int		index;
+
+	for( index = twfs_dict.sname_hash[ hashTwfsUserKey( screen_name ) ] ;
+		 index != DEF_TWFS_DICT_NONE ;
+		 index = twfs_dict.sname_next[ index ] )
+	{
+		if( strcmp( twfs_dict.recs[ index ].sname, screen_name ) == 0 )
+		{
+			return( index );
+		}
+	}
+
+	return( -1 );
+}
+
+/*
+================================================================================
+	Function	:linkTwfsUserName
+	Input		:int index
+				 < index of the user >
+	Output		:void
+	Return		:void
+	Description	:chain a user to hash of its screen name. caller must hold
+				 twfs_dict.lock
+================================================================================
+*/
+static void linkTwfsUserName( int index )
+{
+	unsigned int	hash;
+
+	hash = hashTwfsUserKey( twfs_dict.recs[ index ].sname );
+
+	twfs_dict.sname_next[ index ]	= twfs_dict.sname_hash[ hash ];
+	twfs_dict.sname_hash[ hash ]	= index;
+}
+
+/*
+================================================================================
+	Function	:unlinkTwfsUserName
+	Input		:int index
+				 < index of the user >
+	Output		:void
+	Return		:void
+	Description	:remove a user from hash of its screen name. caller must hold
+				 twfs_dict.lock
+================================================================================
+*/
+static void unlinkTwfsUserName( int index )
+{
+	int32_t		*link;
+
+	link = &twfs_dict.sname_hash[ hashTwfsUserKey( twfs_dict.recs[ index ].sname ) ];
+
+	for( ; *link != DEF_TWFS_DICT_NONE ; link = &twfs_dict.sname_next[ *link ] )
+	{
+		if( *link == index )
+		{
+			*link = twfs_dict.sname_next[ index ];
+			return;
+		}
+	}
+}
+
+/*
+================================================================================
+	Function	:hashTwfsUserKey
+	Input		:const char *key
+				 < user id or screen name >
+	Output		:void
+	Return		:unsigned int
+				 < index of hash >
+	Description	:hash a key of the dictionary
+================================================================================
+*/
+static unsigned int hashTwfsUserKey( const char *key )
+{
+	uint32_t	hash;
+
+	/* ------------------------------------------------------------------------ */
+	/* fnv-1a of key															*/
+	/* ------------------------------------------------------------------------ */
+	hash = 2166136261u;
+
+	for( ; *key ; key++ )
+	{
+		hash ^= ( uint8_t )*key;
+		hash *= 16777619u;
+	}
+
+	return( hash & ( DEF_TWFS_DICT_HASH_SIZE - 1 ) );
+}
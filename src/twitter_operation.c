@@ -4,6 +4,10 @@
 
 *******************************************************************************/
 #include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -34,6 +38,13 @@
 static int
 twopeRecvHeaders( struct ssl_session *session, struct http_ctx *hctx );
 
+static int acquireTwopeLimit( E_TWOPE_LIMIT limit );
+static void updateTwopeLimit( E_TWOPE_LIMIT limit, struct http_ctx *hctx );
+static void writeTwopeLimitFile( void );
+static int twopeRecvLimitedHeaders( struct ssl_session *session,
+									struct http_ctx *hctx,
+									E_TWOPE_LIMIT limit );
+
 /*
 ================================================================================
 
@@ -41,6 +52,12 @@ twopeRecvHeaders( struct ssl_session *session, struct http_ctx *hctx );
 
 ================================================================================
 */
+/* ---------------------------------------------------------------------------- */
+/* rate limit windows of apis. background requests leave some calls of a		*/
+/* window to opens by users														*/
+/* ---------------------------------------------------------------------------- */
+#define	DEF_TWOPE_LIMIT_RESERVE			3
+#define	DEF_TWOPE_LIMIT_WINDOW			( 15 * 60 )	// when reset is not known
 
 /*
 ================================================================================
@@ -57,6 +74,40 @@ struct user
 
 static struct user user;
 
+struct twope_limit
+{
+	const char	*name;
+	int			limit;			// -1:not known yet
+	int			remaining;		// -1:not known yet
+	time_t		reset;
+};
+
+static struct twope_limit twope_limits[ E_TWOPE_LIMIT_NUM ] =
+{
+	{ "statuses/home_timeline",		-1, -1, 0 },
+	{ "statuses/mentions_timeline",	-1, -1, 0 },
+	{ "statuses/user_timeline",		-1, -1, 0 },
+	{ "statuses/retweets_of_me",	-1, -1, 0 },
+	{ "friends/list",				-1, -1, 0 },
+	{ "followers/list",				-1, -1, 0 },
+	{ "blocks/list",				-1, -1, 0 },
+	{ "users/show",					-1, -1, 0 },
+	{ "direct_messages",			-1, -1, 0 },
+	{ "direct_messages/sent",		-1, -1, 0 },
+	{ "favorites/list",				-1, -1, 0 },
+	{ "lists/statuses",				-1, -1, 0 },
+	{ "lists/ownerships",			-1, -1, 0 },
+	{ "lists/subscriptions",		-1, -1, 0 },
+	{ "lists/memberships",			-1, -1, 0 },
+	{ "lists/members",				-1, -1, 0 },
+	{ "lists/subscribers",			-1, -1, 0 },
+	{ "lists/show",					-1, -1, 0 },
+};
+
+static pthread_mutex_t		twope_limit_lock = PTHREAD_MUTEX_INITIALIZER;
+static int					twope_limit_fd = -1;
+static __thread bool		twope_background;
+
 /*
 ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -89,6 +140,76 @@ void initTwitterOperation( void )
 
 	initOauth( );
 }
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:initTwitterRateLimit
+	Input		:const char *root_path
+				 < path to root directory >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:open the file to monitor rate limit of apis
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int initTwitterRateLimit( const char *root_path )
+{
+	char	path[ DEF_TWFS_PATH_MAX ];
+
+	snprintf( path, sizeof( path ), "%s/%s", root_path, DEF_TWOPE_LIMIT_FILE );
+
+	twope_limit_fd = open( path, O_CREAT | O_RDWR | O_TRUNC, 0660 );
+
+	if( twope_limit_fd < 0 )
+	{
+		logMessage( "cannot open %s\n", path );
+		return( -1 );
+	}
+
+	pthread_mutex_lock( &twope_limit_lock );
+	writeTwopeLimitFile( );
+	pthread_mutex_unlock( &twope_limit_lock );
+
+	return( 0 );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyTwitterRateLimit
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:close the file to monitor rate limit of apis
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void destroyTwitterRateLimit( void )
+{
+	pthread_mutex_lock( &twope_limit_lock );
+
+	if( 0 <= twope_limit_fd )
+	{
+		close( twope_limit_fd );
+		twope_limit_fd = -1;
+	}
+
+	pthread_mutex_unlock( &twope_limit_lock );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:setTwitterOperationBackground
+	Input		:bool background
+				 < true:requests of the thread are for background >
+	Output		:void
+	Return		:void
+	Description	:background requests leave DEF_TWOPE_LIMIT_RESERVE calls of
+				 each rate limit window to opens by users
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+void setTwitterOperationBackground( bool background )
+{
+	twope_background = background;
+}
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:setTwapiUserId
@@ -668,8 +789,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -678,13 +803,20 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getHomeTimeLine( struct ssl_session *session,
 					 struct http_ctx *hctx,
-					 const char *last )
+					 const int count,
+					 const char *last,
+					 const char *max_id )
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_HOME_TL ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getStatusesHomeTimeLine( session,
-									  DEF_TWOPE_MAX_TWEET_COUNT,
-									  last, NULL,
+									  count,
+									  last, max_id,
 									  false, false, false, false );
 
 	if( result < 0 )
@@ -692,7 +824,7 @@ int getHomeTimeLine( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_HOME_TL );
 
 
 	return( result );
@@ -705,8 +837,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -715,13 +851,20 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getMentionsTimeLine( struct ssl_session *session,
 						 struct http_ctx *hctx,
-						 const char *last )
+						 const int count,
+						 const char *last,
+						 const char *max_id )
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_MENTIONS_TL ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getStatusesMentionsTimeLine( session,
-										  DEF_TWOPE_MAX_TWEET_COUNT,
-										  last, NULL,
+										  count,
+										  last, max_id,
 										  false, false, false );
 
 	if( result < 0 )
@@ -729,7 +872,7 @@ int getMentionsTimeLine( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_MENTIONS_TL );
 
 	return( result );
 }
@@ -743,8 +886,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < http context >
 				 const char *screen_name
 				 < screen name to get his timelin >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -754,15 +901,22 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 int getUserTimeLine( struct ssl_session *session,
 					 struct http_ctx *hctx,
 					 const char *screen_name,
-					 const char *last )
+					 const int count,
+					 const char *last,
+					 const char *max_id )
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_USER_TL ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getStatusesUserTimeLine( session,
 									  NULL,
 									  screen_name,
-									  DEF_TWOPE_MAX_TWEET_COUNT,
-									  last, NULL,
+									  count,
+									  last, max_id,
 									  false, false, false, true );
 
 	if( result < 0 )
@@ -770,7 +924,7 @@ int getUserTimeLine( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_USER_TL );
 
 	return( result );
 }
@@ -782,8 +936,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -792,21 +950,28 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int getRetweetOfMeTimeLine( struct ssl_session *session,
 							struct http_ctx *hctx,
-							const char *last )
+							const int count,
+							const char *last,
+							const char *max_id )
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_RTW_OF_ME ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getStatusesRetweetOfMe( session,
-									 DEF_TWOPE_MAX_TWEET_COUNT,
-									 last,
-									 false, false, false, false );
+									 count,
+									 last, max_id,
+									 false, false, false );
 
 	if( result < 0 )
 	{
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_RTW_OF_ME );
 
 	return( result );
 }
@@ -993,19 +1158,24 @@ int getFollowingList( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_FRIENDS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiFriendsList( session,
 								  NULL,
 								  screen_name,
 								  cursor,
-								  DEF_TWOPE_MAX_FF_COUNT,
-								  false, false );
+								  DEF_TWOPE_MAX_FF_PAGE_COUNT,
+								  true, false );
 	
 	if( result < 0 )
 	{
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_FRIENDS );
 	
 	return( result );
 }
@@ -1034,19 +1204,24 @@ int getFollowerList( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_FOLLOWERS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiFollowersList( session,
 									NULL,
 									screen_name,
 									cursor,
-									DEF_TWOPE_MAX_FF_COUNT,
-									false, false );
+									DEF_TWOPE_MAX_FF_PAGE_COUNT,
+									true, false );
 
 	if( result < 0 )
 	{
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_FOLLOWERS );
 	
 	return( result );
 }
@@ -1082,6 +1257,11 @@ int getBlockList( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_BLOCKS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiBlocksList( session,
 									cursor,
 									true, false );
@@ -1091,7 +1271,7 @@ int getBlockList( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_BLOCKS );
 	
 	return( result );
 }
@@ -1165,6 +1345,11 @@ int getUserProfile( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_USERS_SHOW ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiUsersShow( session,
 								 NULL,
 								 screen_name,
@@ -1175,7 +1360,7 @@ int getUserProfile( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_USERS_SHOW );
 
 	return( result );
 }
@@ -1241,6 +1426,11 @@ int getDirectMessages( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_DM ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiDirectMessages( session,
 									 DEF_TWOPE_MAX_DM_COUNT,
 									 last, NULL,
@@ -1251,7 +1441,7 @@ int getDirectMessages( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_DM );
 
 	return( result );
 }
@@ -1277,6 +1467,11 @@ int getDirectMessagesSent( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_DM_SENT ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiDirectMessagesSent( session,
 									 DEF_TWOPE_MAX_DM_COUNT,
 									 last, NULL,
@@ -1288,7 +1483,7 @@ int getDirectMessagesSent( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_DM_SENT );
 
 	return( result );
 }
@@ -1328,8 +1523,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < ssl session >
 				 struct http_ctx *hctx,
 				 < http context >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < latest tweet id which already has been received >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -1338,13 +1537,20 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 */
 int	getFavoritesList( struct ssl_session *session,
 					  struct http_ctx *hctx,
-					  const char *last )
+					  const int count,
+					  const char *last,
+					  const char *max_id )
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_FAV_LIST ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiFavoritesList( session,
-									DEF_TWOPE_MAX_FAV_COUNT,
-									last, NULL,
+									count,
+									last, max_id,
 									false );
 
 	if( result < 0 )
@@ -1352,7 +1558,7 @@ int	getFavoritesList( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_FAV_LIST );
 
 	return( result );
 }
@@ -1419,8 +1625,12 @@ _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 				 < slug for list >
 				 const char *owner
 				 < screen name for owner >
+				 const int count
+				 < number of tweets to get at once >
 				 const char *last
 				 < last tweet id >
+				 const char *max_id
+				 < oldest tweet id to get, NULL:latest >
 	Output		:void
 	Return		:int
 				 < status >
@@ -1431,7 +1641,9 @@ int getListsTimeLine( struct ssl_session *session,
 					  struct http_ctx *hctx,
 					  const char *slug,
 					  const char *owner,
-					  const char *last )
+					  const int count,
+					  const char *last,
+					  const char *max_id )
 {
 	int		result;
 
@@ -1439,11 +1651,16 @@ int getListsTimeLine( struct ssl_session *session,
 	logMessage( "owner:%s\n", owner );
 	logMessage( "last:%s\n", last );
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_TL ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsStatuses( session,
 									NULL, slug,
 									owner, NULL,
-									last, NULL,
-									DEF_TWOPE_MAX_LISTS_TWEET_COUNT,
+									last, max_id,
+									count,
 									false, false );
 
 	if( result < 0 )
@@ -1451,7 +1668,7 @@ int getListsTimeLine( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_TL );
 
 
 	return( result );
@@ -1481,6 +1698,11 @@ int getListsOwnerships( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_OWNERSHIPS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsOwnerships( session,
 									  NULL,
 									  screen_name,
@@ -1492,7 +1714,7 @@ int getListsOwnerships( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_OWNERSHIPS );
 
 	return( result );
 }
@@ -1521,6 +1743,11 @@ int getListsSubscriptions( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_SUBSCRIPTIONS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsSubscriptions( session,
 										 NULL,
 										 screen_name,
@@ -1532,7 +1759,7 @@ int getListsSubscriptions( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_SUBSCRIPTIONS );
 
 	return( result );
 }
@@ -1561,6 +1788,11 @@ int getListsMemberships( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_MEMBERSHIPS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsMemberships( session,
 										NULL,
 										screen_name,
@@ -1573,7 +1805,7 @@ int getListsMemberships( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_MEMBERSHIPS );
 
 	return( result );
 }
@@ -1605,6 +1837,11 @@ int getListsMembers( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_MEMBERS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsMembers( session,
 								   NULL,
 								   slug,
@@ -1619,7 +1856,7 @@ int getListsMembers( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_MEMBERS );
 
 	return( result );
 }
@@ -1651,6 +1888,11 @@ int getListsSubscribers( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_SUBSCRIBERS ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsSubscribers( session,
 									   NULL,
 									   slug,
@@ -1665,7 +1907,7 @@ int getListsSubscribers( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_SUBSCRIBERS );
 
 	return( result );
 }
@@ -1740,6 +1982,76 @@ int destroyListsMembers( struct ssl_session *session,
 	return( result );
 }
 
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:createAllListsMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *slug
+				 < slug of list to create members >
+				 const char *owner_screen_name
+				 < owner of the list >
+				 const char *screen_names
+				 < screen names to create, separated by comma >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:create members of list at once
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int createAllListsMembers( struct ssl_session *session,
+						   const char *slug,
+						   const char *owner_screen_name,
+						   const char *screen_names )
+{
+	int		result;
+
+	result = postTwapiListsCreateAllMembers( session,
+											 NULL,
+											 slug,
+											 NULL,
+											 screen_names,
+											 owner_screen_name,
+											 NULL );
+
+	return( result );
+}
+
+/*
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+	Function	:destroyAllListsMembers
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 const char *slug
+				 < slug of list to destroy members >
+				 const char *owner_screen_name
+				 < owner of the list >
+				 const char *screen_names
+				 < screen names to destroy, separated by comma >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:destroy members of list at once
+_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+*/
+int destroyAllListsMembers( struct ssl_session *session,
+							const char *slug,
+							const char *owner_screen_name,
+							const char *screen_names )
+{
+	int		result;
+
+	result = postTwapiListsDestroyAllMembers( session,
+											  NULL,
+											  slug,
+											  NULL,
+											  screen_names,
+											  owner_screen_name,
+											  NULL );
+
+	return( result );
+}
+
 /*
 _/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 	Function	:subscribeLists
@@ -1893,6 +2205,11 @@ int showLists( struct ssl_session *session,
 {
 	int		result;
 
+	if( acquireTwopeLimit( E_TWOPE_LIMIT_LISTS_SHOW ) < 0 )
+	{
+		return( -1 );
+	}
+
 	result = getTwapiListsShow( session,
 								owner_screen_name,
 								NULL,
@@ -1904,7 +2221,7 @@ int showLists( struct ssl_session *session,
 		return( result );
 	}
 
-	result = twopeRecvHeaders( session, hctx );
+	result = twopeRecvLimitedHeaders( session, hctx, E_TWOPE_LIMIT_LISTS_SHOW );
 
 	return( result );
 }
@@ -2053,6 +2370,176 @@ twopeRecvHeaders( struct ssl_session *session, struct http_ctx *hctx )
 	return( result );
 }
 
+/*
+================================================================================
+	Function	:twopeRecvLimitedHeaders
+	Input		:struct ssl_session *session
+				 < ssl session >
+				 struct http_ctx *hctx
+				 < http context >
+				 E_TWOPE_LIMIT limit
+				 < api of the request >
+	Output		:void
+	Return		:int
+				 < status >
+	Description	:receive http headers and keep rate limit of the api
+================================================================================
+*/
+static int twopeRecvLimitedHeaders( struct ssl_session *session,
+									struct http_ctx *hctx,
+									E_TWOPE_LIMIT limit )
+{
+	int		result;
+
+	result = twopeRecvHeaders( session, hctx );
+
+	updateTwopeLimit( limit, hctx );
+
+	return( result );
+}
+
+/*
+================================================================================
+	Function	:acquireTwopeLimit
+	Input		:E_TWOPE_LIMIT limit
+				 < api to request >
+	Output		:void
+	Return		:int
+				 < -1:request is known to fail, local data should be used >
+	Description	:take a call from rate limit window of the api. background
+				 requests leave DEF_TWOPE_LIMIT_RESERVE calls to opens
+================================================================================
+*/
+static int acquireTwopeLimit( E_TWOPE_LIMIT limit )
+{
+	struct twope_limit	*api;
+	time_t				now;
+	int					reserve;
+
+	api			= &twope_limits[ limit ];
+	now			= time( NULL );
+	reserve		= twope_background ? DEF_TWOPE_LIMIT_RESERVE : 0;
+
+	pthread_mutex_lock( &twope_limit_lock );
+
+	/* ------------------------------------------------------------------------ */
+	/* a new window starts after reset											*/
+	/* ------------------------------------------------------------------------ */
+	if( ( 0 <= api->remaining ) && ( api->reset <= now ) )
+	{
+		api->remaining = api->limit;
+	}
+
+	if( 0 <= api->remaining )
+	{
+		if( api->remaining <= reserve )
+		{
+			pthread_mutex_unlock( &twope_limit_lock );
+			logMessage( "rate limit of %s until %ld\n",
+						api->name, ( long )api->reset );
+			return( -1 );
+		}
+
+		api->remaining--;
+	}
+
+	pthread_mutex_unlock( &twope_limit_lock );
+
+	return( 0 );
+}
+
+/*
+================================================================================
+	Function	:updateTwopeLimit
+	Input		:E_TWOPE_LIMIT limit
+				 < api of the response >
+				 struct http_ctx *hctx
+				 < http context of the response >
+	Output		:void
+	Return		:void
+	Description	:keep rate limit of the api told by the response
+================================================================================
+*/
+static void updateTwopeLimit( E_TWOPE_LIMIT limit, struct http_ctx *hctx )
+{
+	struct twope_limit	*api;
+
+	api = &twope_limits[ limit ];
+
+	pthread_mutex_lock( &twope_limit_lock );
+
+	if( 0 <= hctx->rate_limit )
+	{
+		api->limit = hctx->rate_limit;
+	}
+
+	if( 0 <= hctx->rate_remaining )
+	{
+		api->remaining = hctx->rate_remaining;
+	}
+
+	if( hctx->rate_reset )
+	{
+		api->reset = hctx->rate_reset;
+	}
+
+	/* ------------------------------------------------------------------------ */
+	/* no more calls in this window												*/
+	/* ------------------------------------------------------------------------ */
+	if( hctx->status_code == DEF_HTTPH_STATUS_TOO_MANY_REQUESTS )
+	{
+		api->remaining = 0;
+
+		if( api->reset <= time( NULL ) )
+		{
+			api->reset = time( NULL ) + DEF_TWOPE_LIMIT_WINDOW;
+		}
+	}
+
+	writeTwopeLimitFile( );
+
+	pthread_mutex_unlock( &twope_limit_lock );
+}
+
+/*
+================================================================================
+	Function	:writeTwopeLimitFile
+	Input		:void
+	Output		:void
+	Return		:void
+	Description	:write rate limit of apis to the file for monitoring.
+				 twope_limit_lock is held by caller
+================================================================================
+*/
+static void writeTwopeLimitFile( void )
+{
+	char	buffer[ 128 * E_TWOPE_LIMIT_NUM ];
+	int		len;
+	int		i;
+
+	if( twope_limit_fd < 0 )
+	{
+		return;
+	}
+
+	len = 0;
+
+	for( i = 0 ; i < E_TWOPE_LIMIT_NUM ; i++ )
+	{
+		len += snprintf( &buffer[ len ], sizeof( buffer ) - len,
+						 "%-28s remaining:%-5d limit:%-5d reset:%ld\n",
+						 twope_limits[ i ].name,
+						 twope_limits[ i ].remaining,
+						 twope_limits[ i ].limit,
+						 ( long )twope_limits[ i ].reset );
+	}
+
+	if( pwrite( twope_limit_fd, buffer, len, 0 ) == len )
+	{
+		ftruncate( twope_limit_fd, len );
+	}
+}
+
 /*
 ================================================================================
 	Function	:void